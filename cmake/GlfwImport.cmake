@@ -30,6 +30,8 @@ if(NOT glfw3_FOUND AND NOT USE_EXTERNAL_GLFW STREQUAL "ON" AND "${PLATFORM}" MAT
     include_directories(BEFORE SYSTEM external/glfw/include)
 elseif("${PLATFORM}" STREQUAL "DRM")
     MESSAGE(STATUS "No GLFW required on PLATFORM_DRM")
+elseif("${PLATFORM}" STREQUAL "Headless")
+    MESSAGE(STATUS "No GLFW required on PLATFORM_HEADLESS")
 else()
     MESSAGE(STATUS "Using external GLFW")
     set(GLFW_PKG_DEPS glfw3)
@@ -97,6 +97,27 @@ elseif ("${PLATFORM}" MATCHES "SDL")
     set(PLATFORM_CPP "PLATFORM_DESKTOP_SDL")
     set(LIBS_PRIVATE SDL2::SDL2)
 
+elseif ("${PLATFORM}" MATCHES "Headless")
+    set(PLATFORM_CPP "PLATFORM_HEADLESS")
+    set(GRAPHICS "GRAPHICS_API_OPENGL_33")
+
+    add_definitions(-D_DEFAULT_SOURCE)
+    add_definitions(-DEGL_NO_X11)
+
+    if (${OPENGL_VERSION} MATCHES "Software")
+        # Software renderer (rlsw) does not require any graphics library
+        set(LIBS_PRIVATE pthread m dl)
+    else ()
+        find_library(EGL EGL)
+        if (${OPENGL_VERSION} MATCHES "ES")
+            find_library(GLESV2 GLESv2)
+            set(LIBS_PRIVATE ${EGL} ${GLESV2} pthread m dl)
+        else ()
+            find_library(GL GL)
+            set(LIBS_PRIVATE ${EGL} ${GL} pthread m dl)
+        endif ()
+    endif ()
+
 endif ()
 
 if (NOT ${OPENGL_VERSION} MATCHES "OFF")
@@ -114,6 +135,8 @@ if (NOT ${OPENGL_VERSION} MATCHES "OFF")
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
     elseif (${OPENGL_VERSION} MATCHES "ES 3.0")
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES3")
+    elseif (${OPENGL_VERSION} MATCHES "Software")
+        set(GRAPHICS "GRAPHICS_API_SOFTWARE")
     endif ()
     if (NOT "${SUGGESTED_GRAPHICS}" STREQUAL "" AND NOT "${SUGGESTED_GRAPHICS}" STREQUAL "${GRAPHICS}")
         message(WARNING "You are overriding the suggested GRAPHICS=${SUGGESTED_GRAPHICS} with ${GRAPHICS}! This may fail.")
@@ -92,6 +92,9 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+// Screenshot file type for automatic screenshots (KEY_F12), faster to save formats: .qoi, .bmp, .tga, .raw
+#define SCREENSHOT_FILE_TYPE           ".png"
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -188,6 +191,11 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_IMAGE_POOL_BUFFERS         32       // Max number of pixel buffers retained by image pool for reuse (SetImagePoolSize())
+#define MAX_VIRTUAL_TEXTURE_LOADS      16       // Max number of virtual texture tiles loading at the same time (per virtual texture)
+
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -229,6 +237,8 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Particles module is included (rparticles.h): emitters simulated with compute shaders (OpenGL 4.3) or SIMD CPU loop
+#define SUPPORT_PARTICLES_SYSTEM        1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
@@ -269,9 +279,17 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Allow CPU-heavy functions (i.e. image processing) to split work across multiple threads
+// NOTE: Requires threads support (pthreads or Win32 threads), if not available, work runs on calling thread
+#define SUPPORT_THREADING               1
+// Allow large files to be accessed through memory mapping (i.e. MappedImage)
+// NOTE: Requires mmap() or Win32 file mapping support, if not available, mapping fails
+#define SUPPORT_FILE_MAPPING            1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_THREADING_WORKERS          16       // Max number of threads used by ParallelFor(), including calling thread
+#define MAX_ASYNC_LOAD_REQUESTS       256       // Max number of async load requests in flight (LoadTextureAsync()...)
 
 #endif // CONFIG_H
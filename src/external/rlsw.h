@@ -0,0 +1,2984 @@
+/**********************************************************************************************
+*
+*   rlsw v1.0 - Software rasterizer implementing the OpenGL 1.1 subset required by rlgl
+*
+*   FEATURES:
+*       - Fixed-function pipeline: matrix stacks, immediate mode and client-side vertex arrays
+*       - Textured and vertex-colored triangles, quads, lines (with width) and points
+*       - Depth test, blending (factors + equations), scissor, face culling, color mask
+*       - Framebuffer objects with color and depth texture attachments (render textures)
+*       - Sort-middle tiled rasterization: primitives are binned into screen tiles and the tiles
+*         are rasterized in parallel by a worker pool, every tile processes its primitives in
+*         submission order so results are deterministic and independent of thread count
+*       - Pixel pipeline evaluates 4 pixels at a time using SSE2 or NEON when available
+*
+*   LIMITATIONS:
+*       - No shaders, only the default pipeline: fragment color = vertex color * texture color
+*       - No lighting, fog, stencil, alpha test or texture matrix
+*       - Textures are stored as RGBA8 and only mipmap level 0 is used for sampling
+*       - Compressed texture formats are not supported
+*
+*   ADDITIONAL NOTES:
+*       Vertex processing, clipping and triangle setup run on the calling thread, rasterization
+*       is deferred until swFlush(), that is called automatically when rendered pixels are read
+*       back (swReadPixels(), swGetTexImage()), when the render target changes, when a texture
+*       is modified or deleted, on swClear() and when the internal primitives buffer is full
+*
+*       Pixel coordinates follow OpenGL conventions: (0, 0) is the bottom-left corner of the
+*       framebuffer and rows are stored bottom-up, textures row 0 maps to texcoord v = 0
+*
+*   CONFIGURATION:
+*       #define RLSW_IMPLEMENTATION
+*           Generates the implementation of the library into the included file
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation
+*
+*       #define RLSW_NO_THREADS
+*           Rasterize on the calling thread only, no worker threads are created
+*
+*       #define RLSW_NO_SIMD
+*           Disable SSE2/NEON code paths, portable scalar code is used instead
+*
+*       rlsw capabilities could be customized defining some internal values before
+*       library inclusion (default values listed):
+*
+*       #define RLSW_MAX_THREADS                  16    // Maximum number of rasterization threads
+*       #define RLSW_TILE_SIZE                    64    // Screen tile size in pixels (power of two)
+*       #define RLSW_MAX_PENDING_TRIANGLES     65536    // Triangles accumulated before forcing a flush
+*       #define RLSW_MAX_MATRIX_STACK_SIZE        32    // Maximum size of every matrix stack
+*
+*   DEPENDENCIES:
+*       - pthreads (POSIX) or Win32 threads, only if threading is enabled
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLSW_H
+#define RLSW_H
+
+#include <stdbool.h>                // Required for: bool
+
+#ifndef RLSWAPI
+    #define RLSWAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// NOTE: Values match the OpenGL ones, so they can be used interchangeably
+#define SW_FALSE                            0
+#define SW_TRUE                             1
+
+// Primitives
+#define SW_POINTS                           0x0000
+#define SW_LINES                            0x0001
+#define SW_TRIANGLES                        0x0004
+#define SW_QUADS                            0x0007
+
+// Matrix modes and queries
+#define SW_MODELVIEW                        0x1700
+#define SW_PROJECTION                       0x1701
+#define SW_TEXTURE                          0x1702
+#define SW_MODELVIEW_MATRIX                 0x0BA6
+#define SW_PROJECTION_MATRIX                0x0BA7
+#define SW_LINE_WIDTH                       0x0B21
+#define SW_POINT_SIZE                       0x0B11
+#define SW_VIEWPORT                         0x0BA2
+#define SW_DRAW_FRAMEBUFFER_BINDING         0x8CA6
+
+// Capabilities
+#define SW_TEXTURE_2D                       0x0DE1
+#define SW_BLEND                            0x0BE2
+#define SW_DEPTH_TEST                       0x0B71
+#define SW_CULL_FACE                        0x0B44
+#define SW_SCISSOR_TEST                     0x0C11
+#define SW_LINE_SMOOTH                      0x0B20
+#define SW_PROGRAM_POINT_SIZE               0x8642
+
+// Faces and polygon modes
+#define SW_FRONT                            0x0404
+#define SW_BACK                             0x0405
+#define SW_FRONT_AND_BACK                   0x0408
+#define SW_CW                               0x0900
+#define SW_CCW                              0x0901
+#define SW_POINT                            0x1B00
+#define SW_LINE                             0x1B01
+#define SW_FILL                             0x1B02
+
+// Depth functions
+#define SW_NEVER                            0x0200
+#define SW_LESS                             0x0201
+#define SW_EQUAL                            0x0202
+#define SW_LEQUAL                           0x0203
+#define SW_GREATER                          0x0204
+#define SW_NOTEQUAL                         0x0205
+#define SW_GEQUAL                           0x0206
+#define SW_ALWAYS                           0x0207
+
+// Blending factors and equations
+#define SW_ZERO                             0
+#define SW_ONE                              1
+#define SW_SRC_COLOR                        0x0300
+#define SW_ONE_MINUS_SRC_COLOR              0x0301
+#define SW_SRC_ALPHA                        0x0302
+#define SW_ONE_MINUS_SRC_ALPHA              0x0303
+#define SW_DST_ALPHA                        0x0304
+#define SW_ONE_MINUS_DST_ALPHA              0x0305
+#define SW_DST_COLOR                        0x0306
+#define SW_ONE_MINUS_DST_COLOR              0x0307
+#define SW_SRC_ALPHA_SATURATE               0x0308
+#define SW_FUNC_ADD                         0x8006
+#define SW_MIN                              0x8007
+#define SW_MAX                              0x8008
+#define SW_FUNC_SUBTRACT                    0x800A
+#define SW_FUNC_REVERSE_SUBTRACT            0x800B
+
+// Clear buffer bits
+#define SW_DEPTH_BUFFER_BIT                 0x00000100
+#define SW_COLOR_BUFFER_BIT                 0x00004000
+
+// Data types
+#define SW_UNSIGNED_BYTE                    0x1401
+#define SW_UNSIGNED_SHORT                   0x1403
+#define SW_UNSIGNED_INT                     0x1405
+#define SW_FLOAT                            0x1406
+#define SW_UNSIGNED_SHORT_4_4_4_4           0x8033
+#define SW_UNSIGNED_SHORT_5_5_5_1           0x8034
+#define SW_UNSIGNED_SHORT_5_6_5             0x8363
+
+// Pixel formats
+#define SW_DEPTH_COMPONENT                  0x1902
+#define SW_ALPHA                            0x1906
+#define SW_RGB                              0x1907
+#define SW_RGBA                             0x1908
+#define SW_LUMINANCE                        0x1909
+#define SW_LUMINANCE_ALPHA                  0x190A
+
+// Texture parameters
+#define SW_TEXTURE_MAG_FILTER               0x2800
+#define SW_TEXTURE_MIN_FILTER               0x2801
+#define SW_TEXTURE_WRAP_S                   0x2802
+#define SW_TEXTURE_WRAP_T                   0x2803
+#define SW_NEAREST                          0x2600
+#define SW_LINEAR                           0x2601
+#define SW_NEAREST_MIPMAP_NEAREST           0x2700
+#define SW_LINEAR_MIPMAP_NEAREST            0x2701
+#define SW_NEAREST_MIPMAP_LINEAR            0x2702
+#define SW_LINEAR_MIPMAP_LINEAR             0x2703
+#define SW_REPEAT                           0x2901
+#define SW_CLAMP_TO_EDGE                    0x812F
+#define SW_MIRRORED_REPEAT                  0x8370
+
+// Pixel storage
+#define SW_UNPACK_ALIGNMENT                 0x0CF5
+#define SW_PACK_ALIGNMENT                   0x0D05
+
+// Strings and hints
+#define SW_VENDOR                           0x1F00
+#define SW_RENDERER                         0x1F01
+#define SW_VERSION                          0x1F02
+#define SW_EXTENSIONS                       0x1F03
+#define SW_PERSPECTIVE_CORRECTION_HINT      0x0C50
+#define SW_NICEST                           0x1102
+#define SW_FLAT                             0x1D00
+#define SW_SMOOTH                           0x1D01
+
+// Client-side vertex arrays
+#define SW_VERTEX_ARRAY                     0x8074
+#define SW_NORMAL_ARRAY                     0x8075
+#define SW_COLOR_ARRAY                      0x8076
+#define SW_TEXTURE_COORD_ARRAY              0x8078
+
+// Framebuffer objects
+#define SW_FRAMEBUFFER                      0x8D40
+#define SW_COLOR_ATTACHMENT0                0x8CE0
+#define SW_DEPTH_ATTACHMENT                 0x8D00
+#define SW_FRAMEBUFFER_COMPLETE             0x8CD5
+#define SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT 0x8CD6
+#define SW_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT 0x8CD7
+#define SW_FRAMEBUFFER_UNSUPPORTED          0x8CDD
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Context management
+RLSWAPI bool swInit(int width, int height);                 // Initialize software renderer, default framebuffer of given size
+RLSWAPI void swClose(void);                                 // Close software renderer, all objects are unloaded
+RLSWAPI void swResize(int width, int height);               // Resize default framebuffer
+RLSWAPI void swSetThreadCount(int count);                   // Set number of rasterization threads (0 = one per CPU core)
+RLSWAPI int swGetThreadCount(void);                         // Get number of rasterization threads (including calling thread)
+RLSWAPI void swFlush(void);                                 // Rasterize all pending primitives
+RLSWAPI void swFinish(void);                                // Rasterize all pending primitives (same as swFlush())
+RLSWAPI const unsigned char *swGetColorBuffer(int *width, int *height);   // Get default framebuffer RGBA8 pixels (bottom-up rows)
+
+// Render state
+RLSWAPI void swEnable(int cap);
+RLSWAPI void swDisable(int cap);
+RLSWAPI void swViewport(int x, int y, int width, int height);
+RLSWAPI void swScissor(int x, int y, int width, int height);
+RLSWAPI void swClearColor(float r, float g, float b, float a);
+RLSWAPI void swClearDepth(double depth);
+RLSWAPI void swClear(unsigned int mask);
+RLSWAPI void swBlendFunc(int sfactor, int dfactor);
+RLSWAPI void swBlendEquation(int mode);
+RLSWAPI void swDepthFunc(int func);
+RLSWAPI void swDepthMask(unsigned char flag);
+RLSWAPI void swColorMask(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+RLSWAPI void swCullFace(int mode);
+RLSWAPI void swFrontFace(int mode);
+RLSWAPI void swPolygonMode(int face, int mode);
+RLSWAPI void swLineWidth(float width);
+RLSWAPI void swPointSize(float size);
+RLSWAPI void swHint(int target, int mode);
+RLSWAPI void swShadeModel(int mode);
+RLSWAPI void swPixelStorei(int pname, int param);
+RLSWAPI void swGetFloatv(int pname, float *params);
+RLSWAPI void swGetIntegerv(int pname, int *params);
+RLSWAPI const unsigned char *swGetString(int name);
+
+// Matrix operations
+RLSWAPI void swMatrixMode(int mode);
+RLSWAPI void swPushMatrix(void);
+RLSWAPI void swPopMatrix(void);
+RLSWAPI void swLoadIdentity(void);
+RLSWAPI void swTranslatef(float x, float y, float z);
+RLSWAPI void swRotatef(float angle, float x, float y, float z);
+RLSWAPI void swScalef(float x, float y, float z);
+RLSWAPI void swMultMatrixf(const float *mat);
+RLSWAPI void swFrustum(double left, double right, double bottom, double top, double znear, double zfar);
+RLSWAPI void swOrtho(double left, double right, double bottom, double top, double znear, double zfar);
+
+// Immediate mode vertex submission
+RLSWAPI void swBegin(int mode);
+RLSWAPI void swEnd(void);
+RLSWAPI void swVertex2i(int x, int y);
+RLSWAPI void swVertex2f(float x, float y);
+RLSWAPI void swVertex3f(float x, float y, float z);
+RLSWAPI void swTexCoord2f(float u, float v);
+RLSWAPI void swNormal3f(float x, float y, float z);
+RLSWAPI void swColor3f(float r, float g, float b);
+RLSWAPI void swColor4f(float r, float g, float b, float a);
+RLSWAPI void swColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+
+// Client-side vertex arrays
+RLSWAPI void swEnableClientState(int array);
+RLSWAPI void swDisableClientState(int array);
+RLSWAPI void swVertexPointer(int size, int type, int stride, const void *pointer);
+RLSWAPI void swTexCoordPointer(int size, int type, int stride, const void *pointer);
+RLSWAPI void swNormalPointer(int type, int stride, const void *pointer);
+RLSWAPI void swColorPointer(int size, int type, int stride, const void *pointer);
+RLSWAPI void swDrawArrays(int mode, int first, int count);
+RLSWAPI void swDrawElements(int mode, int count, int type, const void *indices);
+
+// Textures
+RLSWAPI void swGenTextures(int count, unsigned int *textures);
+RLSWAPI void swDeleteTextures(int count, const unsigned int *textures);
+RLSWAPI void swBindTexture(int target, unsigned int id);
+RLSWAPI void swTexImage2D(int target, int level, int internalFormat, int width, int height, int border, int format, int type, const void *data);
+RLSWAPI void swTexSubImage2D(int target, int level, int offsetX, int offsetY, int width, int height, int format, int type, const void *data);
+RLSWAPI void swTexParameteri(int target, int pname, int param);
+RLSWAPI void swGetTexImage(int target, int level, int format, int type, void *pixels);
+RLSWAPI void swReadPixels(int x, int y, int width, int height, int format, int type, void *pixels);
+
+// Framebuffer objects (render to texture)
+RLSWAPI void swGenFramebuffers(int count, unsigned int *framebuffers);
+RLSWAPI void swDeleteFramebuffers(int count, const unsigned int *framebuffers);
+RLSWAPI void swBindFramebuffer(int target, unsigned int id);
+RLSWAPI void swFramebufferTexture2D(int target, int attachment, int textarget, unsigned int texture, int level);
+RLSWAPI int swCheckFramebufferStatus(int target);
+RLSWAPI void swGetFramebufferAttachments(unsigned int id, unsigned int *colorTexture, unsigned int *depthTexture);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLSW_H
+
+/***********************************************************************************
+*
+*   RLSW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLSW_IMPLEMENTATION)
+
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>                 // Required for: memset(), memcpy()
+#include <math.h>                   // Required for: sqrtf(), floorf(), ceilf(), sinf(), cosf()
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__) && !defined(RLSW_NO_THREADS)
+    #define RLSW_NO_THREADS
+#endif
+
+#if !defined(RLSW_NO_THREADS)
+    #if defined(_WIN32)
+        // NOTE: Required Win32 API declared manually to avoid including windows.h,
+        // it conflicts with some raylib symbols (Rectangle, CloseWindow, DrawText...)
+        #if !defined(_WINDOWS_)
+            __declspec(dllimport) void __stdcall InitializeSRWLock(void *lock);
+            __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void *lock);
+            __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void *lock);
+            __declspec(dllimport) void __stdcall InitializeConditionVariable(void *cond);
+            __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void *cond, void *lock, unsigned long ms, unsigned long flags);
+            __declspec(dllimport) void __stdcall WakeAllConditionVariable(void *cond);
+            __declspec(dllimport) void *__stdcall CreateThread(void *attribs, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+            __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+            __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+            __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+        #endif
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_mutex_*(), pthread_cond_*()
+        #include <unistd.h>         // Required for: sysconf()
+    #endif
+#endif
+
+#if !defined(RLSW_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RLSW_SIMD_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define RLSW_SIMD_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+    #endif
+#endif
+
+#ifndef RLSW_MAX_THREADS
+    #define RLSW_MAX_THREADS                16      // Maximum number of rasterization threads
+#endif
+#ifndef RLSW_TILE_SIZE
+    #define RLSW_TILE_SIZE                  64      // Screen tile size in pixels (power of two)
+#endif
+#ifndef RLSW_MAX_PENDING_TRIANGLES
+    #define RLSW_MAX_PENDING_TRIANGLES   65536      // Triangles accumulated before forcing a flush
+#endif
+#ifndef RLSW_MAX_MATRIX_STACK_SIZE
+    #define RLSW_MAX_MATRIX_STACK_SIZE      32      // Maximum size of every matrix stack
+#endif
+
+#ifndef RL_MALLOC
+    #define RL_MALLOC(sz)       malloc(sz)
+#endif
+#ifndef RL_CALLOC
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+#endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(n,sz)    realloc(n,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(p)          free(p)
+#endif
+
+#define SW_GUARD_BAND          16.0f        // Clip-space guard band, only primitives crossing it are clipped on x/y
+#define SW_CLIP_MAX_VERTICES      16        // Maximum vertex count of a clipped polygon
+#define SW_ATTRIB_COUNT            6        // Interpolated attributes: u, v, r, g, b, a
+
+#define RLSW_MIN(a, b)    (((a) < (b))? (a) : (b))
+#define RLSW_MAX(a, b)    (((a) > (b))? (a) : (b))
+#define RLSW_CLAMP(x, lo, hi) (((x) < (lo))? (lo) : (((x) > (hi))? (hi) : (x)))
+
+//----------------------------------------------------------------------------------
+// SIMD abstraction: 4 lanes of floats (swf4) and 32-bit masks/integers (swi4)
+//----------------------------------------------------------------------------------
+#if defined(RLSW_SIMD_SSE2)
+typedef __m128 swf4;
+typedef __m128i swi4;
+
+static inline swf4 swf4Set1(float a) { return _mm_set1_ps(a); }
+static inline swf4 swf4Set(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+static inline swf4 swf4Load(const float *p) { return _mm_loadu_ps(p); }
+static inline void swf4Store(float *p, swf4 a) { _mm_storeu_ps(p, a); }
+static inline swf4 swf4Add(swf4 a, swf4 b) { return _mm_add_ps(a, b); }
+static inline swf4 swf4Sub(swf4 a, swf4 b) { return _mm_sub_ps(a, b); }
+static inline swf4 swf4Mul(swf4 a, swf4 b) { return _mm_mul_ps(a, b); }
+static inline swf4 swf4Div(swf4 a, swf4 b) { return _mm_div_ps(a, b); }
+static inline swf4 swf4Min(swf4 a, swf4 b) { return _mm_min_ps(a, b); }
+static inline swf4 swf4Max(swf4 a, swf4 b) { return _mm_max_ps(a, b); }
+static inline swi4 swf4CmpGe(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmpge_ps(a, b)); }
+static inline swi4 swf4CmpGt(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmpgt_ps(a, b)); }
+static inline swi4 swf4CmpLe(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmple_ps(a, b)); }
+static inline swi4 swf4CmpLt(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmplt_ps(a, b)); }
+static inline swi4 swf4CmpEq(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmpeq_ps(a, b)); }
+static inline swi4 swf4CmpNeq(swf4 a, swf4 b) { return _mm_castps_si128(_mm_cmpneq_ps(a, b)); }
+static inline swf4 swf4Select(swi4 m, swf4 a, swf4 b) { __m128 mf = _mm_castsi128_ps(m); return _mm_or_ps(_mm_and_ps(mf, a), _mm_andnot_ps(mf, b)); }
+
+static inline swi4 swi4Set1(unsigned int a) { return _mm_set1_epi32((int)a); }
+static inline swi4 swi4Load(const unsigned int *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline void swi4Store(unsigned int *p, swi4 a) { _mm_storeu_si128((__m128i *)p, a); }
+static inline swi4 swi4And(swi4 a, swi4 b) { return _mm_and_si128(a, b); }
+static inline swi4 swi4Or(swi4 a, swi4 b) { return _mm_or_si128(a, b); }
+static inline swi4 swi4Select(swi4 m, swi4 a, swi4 b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+static inline int swi4MoveMask(swi4 m) { return _mm_movemask_ps(_mm_castsi128_ps(m)); }
+
+// Unpack 4 RGBA8 pixels into normalized channels
+static inline void swUnpackRGBA(swi4 p, swf4 *r, swf4 *g, swf4 *b, swf4 *a)
+{
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 scale = _mm_set1_ps(1.0f/255.0f);
+    *r = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, mask)), scale);
+    *g = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 8), mask)), scale);
+    *b = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 16), mask)), scale);
+    *a = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(p, 24)), scale);
+}
+
+// Pack 4 normalized colors into RGBA8 pixels (values are clamped)
+static inline swi4 swPackRGBA(swf4 r, swf4 g, swf4 b, swf4 a)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128i ri = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(r, zero), one), scale), half));
+    __m128i gi = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(g, zero), one), scale), half));
+    __m128i bi = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(b, zero), one), scale), half));
+    __m128i ai = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(a, zero), one), scale), half));
+    return _mm_or_si128(_mm_or_si128(ri, _mm_slli_epi32(gi, 8)), _mm_or_si128(_mm_slli_epi32(bi, 16), _mm_slli_epi32(ai, 24)));
+}
+#elif defined(RLSW_SIMD_NEON)
+typedef float32x4_t swf4;
+typedef uint32x4_t swi4;
+
+static inline swf4 swf4Set1(float a) { return vdupq_n_f32(a); }
+static inline swf4 swf4Set(float a, float b, float c, float d) { const float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+static inline swf4 swf4Load(const float *p) { return vld1q_f32(p); }
+static inline void swf4Store(float *p, swf4 a) { vst1q_f32(p, a); }
+static inline swf4 swf4Add(swf4 a, swf4 b) { return vaddq_f32(a, b); }
+static inline swf4 swf4Sub(swf4 a, swf4 b) { return vsubq_f32(a, b); }
+static inline swf4 swf4Mul(swf4 a, swf4 b) { return vmulq_f32(a, b); }
+#if defined(__aarch64__) || defined(_M_ARM64)
+static inline swf4 swf4Div(swf4 a, swf4 b) { return vdivq_f32(a, b); }
+#else
+static inline swf4 swf4Div(swf4 a, swf4 b)
+{
+    // Reciprocal estimate refined with two Newton-Raphson steps
+    float32x4_t r = vrecpeq_f32(b);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    return vmulq_f32(a, r);
+}
+#endif
+static inline swf4 swf4Min(swf4 a, swf4 b) { return vminq_f32(a, b); }
+static inline swf4 swf4Max(swf4 a, swf4 b) { return vmaxq_f32(a, b); }
+static inline swi4 swf4CmpGe(swf4 a, swf4 b) { return vcgeq_f32(a, b); }
+static inline swi4 swf4CmpGt(swf4 a, swf4 b) { return vcgtq_f32(a, b); }
+static inline swi4 swf4CmpLe(swf4 a, swf4 b) { return vcleq_f32(a, b); }
+static inline swi4 swf4CmpLt(swf4 a, swf4 b) { return vcltq_f32(a, b); }
+static inline swi4 swf4CmpEq(swf4 a, swf4 b) { return vceqq_f32(a, b); }
+static inline swi4 swf4CmpNeq(swf4 a, swf4 b) { return vmvnq_u32(vceqq_f32(a, b)); }
+static inline swf4 swf4Select(swi4 m, swf4 a, swf4 b) { return vbslq_f32(m, a, b); }
+
+static inline swi4 swi4Set1(unsigned int a) { return vdupq_n_u32(a); }
+static inline swi4 swi4Load(const unsigned int *p) { return vld1q_u32(p); }
+static inline void swi4Store(unsigned int *p, swi4 a) { vst1q_u32(p, a); }
+static inline swi4 swi4And(swi4 a, swi4 b) { return vandq_u32(a, b); }
+static inline swi4 swi4Or(swi4 a, swi4 b) { return vorrq_u32(a, b); }
+static inline swi4 swi4Select(swi4 m, swi4 a, swi4 b) { return vbslq_u32(m, a, b); }
+static inline int swi4MoveMask(swi4 m)
+{
+    return (int)((vgetq_lane_u32(m, 0) >> 31) | ((vgetq_lane_u32(m, 1) >> 31) << 1) |
+                 ((vgetq_lane_u32(m, 2) >> 31) << 2) | ((vgetq_lane_u32(m, 3) >> 31) << 3));
+}
+
+static inline void swUnpackRGBA(swi4 p, swf4 *r, swf4 *g, swf4 *b, swf4 *a)
+{
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const float32x4_t scale = vdupq_n_f32(1.0f/255.0f);
+    *r = vmulq_f32(vcvtq_f32_u32(vandq_u32(p, mask)), scale);
+    *g = vmulq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(p, 8), mask)), scale);
+    *b = vmulq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(p, 16), mask)), scale);
+    *a = vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(p, 24)), scale);
+}
+
+static inline swi4 swPackRGBA(swf4 r, swf4 g, swf4 b, swf4 a)
+{
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    uint32x4_t ri = vcvtq_u32_f32(vaddq_f32(vmulq_f32(vminq_f32(vmaxq_f32(r, zero), one), scale), half));
+    uint32x4_t gi = vcvtq_u32_f32(vaddq_f32(vmulq_f32(vminq_f32(vmaxq_f32(g, zero), one), scale), half));
+    uint32x4_t bi = vcvtq_u32_f32(vaddq_f32(vmulq_f32(vminq_f32(vmaxq_f32(b, zero), one), scale), half));
+    uint32x4_t ai = vcvtq_u32_f32(vaddq_f32(vmulq_f32(vminq_f32(vmaxq_f32(a, zero), one), scale), half));
+    return vorrq_u32(vorrq_u32(ri, vshlq_n_u32(gi, 8)), vorrq_u32(vshlq_n_u32(bi, 16), vshlq_n_u32(ai, 24)));
+}
+#else
+// Portable fallback, compilers are usually able to auto-vectorize these loops
+typedef struct { float v[4]; } swf4;
+typedef struct { unsigned int v[4]; } swi4;
+
+static inline swf4 swf4Set1(float a) { swf4 r = { { a, a, a, a } }; return r; }
+static inline swf4 swf4Set(float a, float b, float c, float d) { swf4 r = { { a, b, c, d } }; return r; }
+static inline swf4 swf4Load(const float *p) { swf4 r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline void swf4Store(float *p, swf4 a) { memcpy(p, a.v, sizeof(a.v)); }
+static inline swf4 swf4Add(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline swf4 swf4Sub(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+static inline swf4 swf4Mul(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+static inline swf4 swf4Div(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] /= b.v[i]; return a; }
+static inline swf4 swf4Min(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] = RLSW_MIN(a.v[i], b.v[i]); return a; }
+static inline swf4 swf4Max(swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] = RLSW_MAX(a.v[i], b.v[i]); return a; }
+static inline swi4 swf4CmpGe(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] >= b.v[i])? 0xffffffffu : 0; return r; }
+static inline swi4 swf4CmpGt(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] > b.v[i])? 0xffffffffu : 0; return r; }
+static inline swi4 swf4CmpLe(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] <= b.v[i])? 0xffffffffu : 0; return r; }
+static inline swi4 swf4CmpLt(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] < b.v[i])? 0xffffffffu : 0; return r; }
+static inline swi4 swf4CmpEq(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] == b.v[i])? 0xffffffffu : 0; return r; }
+static inline swi4 swf4CmpNeq(swf4 a, swf4 b) { swi4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] != b.v[i])? 0xffffffffu : 0; return r; }
+static inline swf4 swf4Select(swi4 m, swf4 a, swf4 b) { for (int i = 0; i < 4; i++) a.v[i] = m.v[i]? a.v[i] : b.v[i]; return a; }
+
+static inline swi4 swi4Set1(unsigned int a) { swi4 r = { { a, a, a, a } }; return r; }
+static inline swi4 swi4Load(const unsigned int *p) { swi4 r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline void swi4Store(unsigned int *p, swi4 a) { memcpy(p, a.v, sizeof(a.v)); }
+static inline swi4 swi4And(swi4 a, swi4 b) { for (int i = 0; i < 4; i++) a.v[i] &= b.v[i]; return a; }
+static inline swi4 swi4Or(swi4 a, swi4 b) { for (int i = 0; i < 4; i++) a.v[i] |= b.v[i]; return a; }
+static inline swi4 swi4Select(swi4 m, swi4 a, swi4 b) { for (int i = 0; i < 4; i++) a.v[i] = (m.v[i] & a.v[i]) | (~m.v[i] & b.v[i]); return a; }
+static inline int swi4MoveMask(swi4 m) { return (int)((m.v[0] >> 31) | ((m.v[1] >> 31) << 1) | ((m.v[2] >> 31) << 2) | ((m.v[3] >> 31) << 3)); }
+
+static inline void swUnpackRGBA(swi4 p, swf4 *r, swf4 *g, swf4 *b, swf4 *a)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        r->v[i] = (float)(p.v[i] & 0xff)/255.0f;
+        g->v[i] = (float)((p.v[i] >> 8) & 0xff)/255.0f;
+        b->v[i] = (float)((p.v[i] >> 16) & 0xff)/255.0f;
+        a->v[i] = (float)(p.v[i] >> 24)/255.0f;
+    }
+}
+
+static inline swi4 swPackRGBA(swf4 r, swf4 g, swf4 b, swf4 a)
+{
+    swi4 result;
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned int ri = (unsigned int)(RLSW_CLAMP(r.v[i], 0.0f, 1.0f)*255.0f + 0.5f);
+        unsigned int gi = (unsigned int)(RLSW_CLAMP(g.v[i], 0.0f, 1.0f)*255.0f + 0.5f);
+        unsigned int bi = (unsigned int)(RLSW_CLAMP(b.v[i], 0.0f, 1.0f)*255.0f + 0.5f);
+        unsigned int ai = (unsigned int)(RLSW_CLAMP(a.v[i], 0.0f, 1.0f)*255.0f + 0.5f);
+        result.v[i] = ri | (gi << 8) | (bi << 16) | (ai << 24);
+    }
+    return result;
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Texture object, color textures are stored as RGBA8, depth textures as float
+typedef struct swTexture {
+    int width;                      // Texture width
+    int height;                     // Texture height
+    bool isDepth;                   // Depth texture (float storage)
+    unsigned int *pixels;           // Color data (RGBA8, one uint per pixel)
+    float *depth;                   // Depth data (one float per pixel)
+    int minFilter;                  // Minification filter
+    int magFilter;                  // Magnification filter
+    int wrapS;                      // Wrap mode horizontal
+    int wrapT;                      // Wrap mode vertical
+} swTexture;
+
+// Framebuffer object
+typedef struct swFramebuffer {
+    bool used;                      // Framebuffer id is in use
+    unsigned int colorTexture;      // Color attachment texture id
+    unsigned int depthTexture;      // Depth attachment texture id
+} swFramebuffer;
+
+// Render target resolved from current framebuffer binding
+typedef struct swTarget {
+    unsigned int *color;            // Color buffer (RGBA8), NULL if no color attachment
+    float *depth;                   // Depth buffer, NULL if no depth attachment
+    int width;                      // Target width
+    int height;                     // Target height
+} swTarget;
+
+// Processed vertex: clip-space position, window-space after projection (x, y, z, 1/w)
+typedef struct swVertex {
+    float position[4];              // Vertex position
+    float texcoord[2];              // Vertex texture coordinates
+    float color[4];                 // Vertex color (normalized)
+} swVertex;
+
+// Render state snapshot, shared by all triangles submitted with same state
+typedef struct swDrawState {
+    const swTexture *texture;       // Texture to sample, NULL if texturing disabled
+    bool blend;                     // Color blending enabled
+    int blendSrc;                   // Blending source factor
+    int blendDst;                   // Blending destination factor
+    int blendEquation;              // Blending equation
+    bool depthTest;                 // Depth test enabled
+    int depthFunc;                  // Depth test function
+    bool depthWrite;                // Depth writes enabled
+    unsigned int colorWriteMask;    // Color channels write mask (RGBA8 bits)
+} swDrawState;
+
+// Triangle ready for rasterization (window space)
+typedef struct swTriangle {
+    float edgeA[3];                 // Edge functions: E(x, y) = A*x + B*y + C, inside if E >= 0
+    float edgeB[3];
+    float edgeC[3];
+    bool edgeInclusive[3];          // Edge owns pixels exactly on it (top-left fill rule)
+    float depth[3];                 // Depth plane: z = depth[0]*x + depth[1]*y + depth[2]
+    float invw[3];                  // 1/w plane, required for perspective correction
+    float attribs[SW_ATTRIB_COUNT][3];  // Attributes planes: u, v, r, g, b, a (divided by w if perspective)
+    int xmin, ymin, xmax, ymax;     // Pixels bounds [min, max)
+    int state;                      // Draw state index
+    bool perspective;               // Perspective correction required
+} swTriangle;
+
+// Screen tile bin: list of triangles overlapping the tile
+typedef struct swTileBin {
+    int *triangles;                 // Triangle indices, in submission order
+    int count;                      // Triangles count
+    int capacity;                   // Triangles capacity
+} swTileBin;
+
+// Client-side vertex array
+typedef struct swClientArray {
+    bool enabled;                   // Array enabled
+    int size;                       // Components per vertex
+    int type;                       // Components data type
+    int stride;                     // Stride in bytes (0 = tightly packed)
+    const void *pointer;            // Array data
+} swClientArray;
+
+#if !defined(RLSW_NO_THREADS)
+#if defined(_WIN32)
+typedef struct { void *ptr; } swMutex;      // Equivalent to SRWLOCK
+typedef struct { void *ptr; } swCondition;  // Equivalent to CONDITION_VARIABLE
+typedef void *swThread;
+#else
+typedef pthread_mutex_t swMutex;
+typedef pthread_cond_t swCondition;
+typedef pthread_t swThread;
+#endif
+#endif
+
+// Parallel job function
+typedef void (*swJobFunc)(int index, void *userData);
+
+// Worker threads pool, jobs are split in indexed items consumed by all threads
+typedef struct swThreadPool {
+    int threadCount;                // Total threads count, including calling thread
+#if !defined(RLSW_NO_THREADS)
+    swThread threads[RLSW_MAX_THREADS];
+    swMutex mutex;
+    swCondition wakeCond;           // Signaled when a new job is available or on shutdown
+    swCondition doneCond;           // Signaled when all job items are processed
+    swJobFunc job;                  // Current job function
+    void *jobData;                  // Current job user data
+    int jobCount;                   // Current job items count
+    int jobNext;                    // Next item to process
+    int jobDone;                    // Items processed
+    unsigned int generation;        // Job generation counter
+    bool quit;                      // Workers exit request
+#endif
+} swThreadPool;
+
+// Software renderer context
+typedef struct swContext {
+    bool ready;                     // Context initialized
+
+    // Default framebuffer
+    unsigned int *colorBuffer;      // Default color buffer (RGBA8)
+    float *depthBuffer;             // Default depth buffer
+    int width;                      // Default framebuffer width
+    int height;                     // Default framebuffer height
+
+    swTarget target;                // Current render target
+    unsigned int boundFramebuffer;  // Current framebuffer object id (0 = default framebuffer)
+
+    // Transformation
+    int matrixMode;                 // Current matrix mode (0: modelview, 1: projection, 2: texture)
+    float stack[3][RLSW_MAX_MATRIX_STACK_SIZE][16];   // Matrix stacks (column-major)
+    int stackDepth[3];              // Matrix stacks depth
+    float mvp[16];                  // Combined projection*modelview matrix
+    bool mvpDirty;                  // Combined matrix requires update
+
+    int viewport[4];                // Viewport (x, y, width, height)
+    int scissor[4];                 // Scissor rectangle (x, y, width, height)
+    float clearColor[4];            // Clear color
+    float clearDepth;               // Clear depth
+
+    // Current vertex attributes
+    float texcoord[2];              // Current texture coordinates
+    float color[4];                 // Current color
+
+    // Primitive assembly
+    int primitiveMode;              // Current primitive mode, -1 outside swBegin()/swEnd()
+    swVertex primitive[4];          // Vertex accumulated for current primitive
+    int primitiveCount;             // Vertex count accumulated for current primitive
+
+    swClientArray vertexArray;      // Client vertex positions array
+    swClientArray texcoordArray;    // Client texture coordinates array
+    swClientArray colorArray;       // Client colors array
+
+    // Render state
+    unsigned int boundTexture;      // Currently bound texture id
+    bool texture2D;                 // Texturing enabled
+    bool blend;                     // Color blending enabled
+    bool depthTest;                 // Depth test enabled
+    bool depthMask;                 // Depth writes enabled
+    bool cullFace;                  // Face culling enabled
+    bool scissorTest;               // Scissor test enabled
+    int blendSrc;                   // Blending source factor
+    int blendDst;                   // Blending destination factor
+    int blendEquation;              // Blending equation
+    int depthFunc;                  // Depth test function
+    int cullMode;                   // Culled faces
+    int frontFace;                  // Front faces winding
+    int polygonMode;                // Polygon rasterization mode
+    unsigned int colorWriteMask;    // Color channels write mask
+    float lineWidth;                // Lines width
+    float pointSize;                // Points size
+    int unpackAlignment;            // Pixel rows alignment on uploads
+    int packAlignment;              // Pixel rows alignment on readbacks
+
+    // Deferred rasterization
+    swDrawState *states;            // Draw states of pending triangles
+    int stateCount;
+    int stateCapacity;
+    bool stateDirty;                // Render state changed since last draw state snapshot
+    swTriangle *triangles;          // Pending triangles
+    int triangleCount;
+    int triangleCapacity;
+    swTileBin *bins;                // Screen tiles bins
+    int binCapacity;
+    int tilesX;                     // Tiles count horizontal (current target)
+    int tilesY;                     // Tiles count vertical (current target)
+    int *activeTiles;               // Tiles with pending triangles (flush list)
+
+    // Objects
+    swTexture **textures;           // Textures (index = id)
+    int textureCapacity;
+    swFramebuffer *framebuffers;    // Framebuffer objects (index = id)
+    int framebufferCapacity;
+
+    swThreadPool pool;              // Rasterization threads
+} swContext;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static swContext RLSW = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void swThreadPoolInit(swThreadPool *pool, int threadCount);
+static void swThreadPoolClose(swThreadPool *pool);
+static void swParallelFor(int count, swJobFunc func, void *userData);
+
+static void swUpdateTarget(void);
+static void swFlushIfPending(void);
+static void swEmitVertex(float x, float y, float z);
+static void swProcessTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2);
+static void swProcessLine(const swVertex *v0, const swVertex *v1);
+static void swProcessPoint(const swVertex *v);
+static void swSetupTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2, bool cull);
+static void swRasterTileJob(int index, void *userData);
+
+static swTexture *swGetTexture(unsigned int id);
+static void swConvertToRGBA(const void *src, int format, int type, int count, unsigned int *dst);
+static void swConvertFromRGBA(const unsigned int *src, int count, int format, int type, void *dst);
+static int swGetPixelSize(int format, int type);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Context management
+//----------------------------------------------------------------------------------
+// Initialize software renderer
+bool swInit(int width, int height)
+{
+    if (RLSW.ready) swClose();
+
+    RLSW.width = width;
+    RLSW.height = height;
+    RLSW.colorBuffer = (unsigned int *)RL_CALLOC((size_t)width*height, sizeof(unsigned int));
+    RLSW.depthBuffer = (float *)RL_MALLOC((size_t)width*height*sizeof(float));
+
+    if ((RLSW.colorBuffer == NULL) || (RLSW.depthBuffer == NULL))
+    {
+        RL_FREE(RLSW.colorBuffer);
+        RL_FREE(RLSW.depthBuffer);
+        memset(&RLSW, 0, sizeof(RLSW));
+        return false;
+    }
+
+    for (int i = 0; i < width*height; i++) RLSW.depthBuffer[i] = 1.0f;
+
+    for (int m = 0; m < 3; m++)
+    {
+        memset(RLSW.stack[m][0], 0, 16*sizeof(float));
+        RLSW.stack[m][0][0] = RLSW.stack[m][0][5] = RLSW.stack[m][0][10] = RLSW.stack[m][0][15] = 1.0f;
+        RLSW.stackDepth[m] = 0;
+    }
+    RLSW.matrixMode = 0;
+    RLSW.mvpDirty = true;
+
+    RLSW.viewport[0] = 0;
+    RLSW.viewport[1] = 0;
+    RLSW.viewport[2] = width;
+    RLSW.viewport[3] = height;
+    RLSW.scissor[0] = 0;
+    RLSW.scissor[1] = 0;
+    RLSW.scissor[2] = width;
+    RLSW.scissor[3] = height;
+    RLSW.clearDepth = 1.0f;
+
+    RLSW.color[0] = RLSW.color[1] = RLSW.color[2] = RLSW.color[3] = 1.0f;
+    RLSW.primitiveMode = -1;
+
+    RLSW.blendSrc = SW_ONE;
+    RLSW.blendDst = SW_ZERO;
+    RLSW.blendEquation = SW_FUNC_ADD;
+    RLSW.depthFunc = SW_LESS;
+    RLSW.depthMask = true;
+    RLSW.cullMode = SW_BACK;
+    RLSW.frontFace = SW_CCW;
+    RLSW.polygonMode = SW_FILL;
+    RLSW.colorWriteMask = 0xffffffff;
+    RLSW.lineWidth = 1.0f;
+    RLSW.pointSize = 1.0f;
+    RLSW.unpackAlignment = 4;
+    RLSW.packAlignment = 4;
+    RLSW.stateDirty = true;
+
+    // Texture id 0 and framebuffer id 0 are reserved
+    RLSW.textureCapacity = 64;
+    RLSW.textures = (swTexture **)RL_CALLOC(RLSW.textureCapacity, sizeof(swTexture *));
+    RLSW.framebufferCapacity = 8;
+    RLSW.framebuffers = (swFramebuffer *)RL_CALLOC(RLSW.framebufferCapacity, sizeof(swFramebuffer));
+
+    RLSW.ready = true;
+    swUpdateTarget();
+
+    if (RLSW.pool.threadCount == 0) swThreadPoolInit(&RLSW.pool, 0);
+
+    return true;
+}
+
+// Close software renderer
+void swClose(void)
+{
+    if (!RLSW.ready) return;
+
+    swThreadPoolClose(&RLSW.pool);
+
+    for (int i = 0; i < RLSW.textureCapacity; i++)
+    {
+        if (RLSW.textures[i] != NULL)
+        {
+            RL_FREE(RLSW.textures[i]->pixels);
+            RL_FREE(RLSW.textures[i]->depth);
+            RL_FREE(RLSW.textures[i]);
+        }
+    }
+
+    for (int i = 0; i < RLSW.binCapacity; i++) RL_FREE(RLSW.bins[i].triangles);
+
+    RL_FREE(RLSW.textures);
+    RL_FREE(RLSW.framebuffers);
+    RL_FREE(RLSW.bins);
+    RL_FREE(RLSW.activeTiles);
+    RL_FREE(RLSW.triangles);
+    RL_FREE(RLSW.states);
+    RL_FREE(RLSW.colorBuffer);
+    RL_FREE(RLSW.depthBuffer);
+
+    memset(&RLSW, 0, sizeof(RLSW));
+}
+
+// Resize default framebuffer, contents are not preserved
+void swResize(int width, int height)
+{
+    if (!RLSW.ready || ((width == RLSW.width) && (height == RLSW.height))) return;
+
+    swFlush();
+
+    unsigned int *colorBuffer = (unsigned int *)RL_CALLOC((size_t)width*height, sizeof(unsigned int));
+    float *depthBuffer = (float *)RL_MALLOC((size_t)width*height*sizeof(float));
+
+    if ((colorBuffer == NULL) || (depthBuffer == NULL))
+    {
+        RL_FREE(colorBuffer);
+        RL_FREE(depthBuffer);
+        return;
+    }
+
+    for (int i = 0; i < width*height; i++) depthBuffer[i] = 1.0f;
+
+    RL_FREE(RLSW.colorBuffer);
+    RL_FREE(RLSW.depthBuffer);
+    RLSW.colorBuffer = colorBuffer;
+    RLSW.depthBuffer = depthBuffer;
+    RLSW.width = width;
+    RLSW.height = height;
+
+    swUpdateTarget();
+}
+
+// Set number of rasterization threads, including calling thread
+void swSetThreadCount(int count)
+{
+    swFlush();
+    swThreadPoolClose(&RLSW.pool);
+    swThreadPoolInit(&RLSW.pool, count);
+}
+
+// Get number of rasterization threads, including calling thread
+int swGetThreadCount(void)
+{
+    return RLSW.pool.threadCount;
+}
+
+// Rasterize all pending triangles
+void swFlush(void)
+{
+    if (RLSW.triangleCount == 0) return;
+
+    int activeCount = 0;
+    for (int i = 0; i < RLSW.tilesX*RLSW.tilesY; i++)
+    {
+        if (RLSW.bins[i].count > 0) RLSW.activeTiles[activeCount++] = i;
+    }
+
+    swParallelFor(activeCount, swRasterTileJob, NULL);
+
+    for (int i = 0; i < activeCount; i++) RLSW.bins[RLSW.activeTiles[i]].count = 0;
+
+    RLSW.triangleCount = 0;
+    RLSW.stateCount = 0;
+    RLSW.stateDirty = true;
+}
+
+// Rasterize all pending triangles
+void swFinish(void)
+{
+    swFlush();
+}
+
+// Get default framebuffer color data
+const unsigned char *swGetColorBuffer(int *width, int *height)
+{
+    swFlush();
+
+    if (width != NULL) *width = RLSW.width;
+    if (height != NULL) *height = RLSW.height;
+
+    return (const unsigned char *)RLSW.colorBuffer;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Render state
+//----------------------------------------------------------------------------------
+void swEnable(int cap)
+{
+    switch (cap)
+    {
+        case SW_TEXTURE_2D: RLSW.texture2D = true; break;
+        case SW_BLEND: RLSW.blend = true; break;
+        case SW_DEPTH_TEST: RLSW.depthTest = true; break;
+        case SW_CULL_FACE: RLSW.cullFace = true; break;
+        case SW_SCISSOR_TEST: RLSW.scissorTest = true; break;
+        default: break;
+    }
+
+    RLSW.stateDirty = true;
+}
+
+void swDisable(int cap)
+{
+    switch (cap)
+    {
+        case SW_TEXTURE_2D: RLSW.texture2D = false; break;
+        case SW_BLEND: RLSW.blend = false; break;
+        case SW_DEPTH_TEST: RLSW.depthTest = false; break;
+        case SW_CULL_FACE: RLSW.cullFace = false; break;
+        case SW_SCISSOR_TEST: RLSW.scissorTest = false; break;
+        default: break;
+    }
+
+    RLSW.stateDirty = true;
+}
+
+void swViewport(int x, int y, int width, int height)
+{
+    RLSW.viewport[0] = x;
+    RLSW.viewport[1] = y;
+    RLSW.viewport[2] = width;
+    RLSW.viewport[3] = height;
+}
+
+void swScissor(int x, int y, int width, int height)
+{
+    RLSW.scissor[0] = x;
+    RLSW.scissor[1] = y;
+    RLSW.scissor[2] = width;
+    RLSW.scissor[3] = height;
+}
+
+void swClearColor(float r, float g, float b, float a)
+{
+    RLSW.clearColor[0] = r;
+    RLSW.clearColor[1] = g;
+    RLSW.clearColor[2] = b;
+    RLSW.clearColor[3] = a;
+}
+
+void swClearDepth(double depth)
+{
+    RLSW.clearDepth = RLSW_CLAMP((float)depth, 0.0f, 1.0f);
+}
+
+// Clear job data, rows are split in bands processed in parallel
+typedef struct swClearJob {
+    int x0, y0, x1, y1;             // Region to clear [min, max)
+    bool color;                     // Clear color buffer
+    bool depth;                     // Clear depth buffer
+    unsigned int colorValue;        // Packed clear color
+    float depthValue;               // Clear depth
+} swClearJob;
+
+#define SW_CLEAR_BAND_ROWS      32
+
+static void swClearJobFunc(int index, void *userData)
+{
+    const swClearJob *job = (const swClearJob *)userData;
+    const swTarget *target = &RLSW.target;
+    const unsigned int keepMask = ~RLSW.colorWriteMask;
+
+    int y0 = job->y0 + index*SW_CLEAR_BAND_ROWS;
+    int y1 = RLSW_MIN(y0 + SW_CLEAR_BAND_ROWS, job->y1);
+
+    for (int y = y0; y < y1; y++)
+    {
+        if (job->color && (target->color != NULL))
+        {
+            unsigned int *row = target->color + (size_t)y*target->width;
+
+            if (keepMask == 0) for (int x = job->x0; x < job->x1; x++) row[x] = job->colorValue;
+            else for (int x = job->x0; x < job->x1; x++) row[x] = (row[x] & keepMask) | (job->colorValue & ~keepMask);
+        }
+
+        if (job->depth && (target->depth != NULL))
+        {
+            float *row = target->depth + (size_t)y*target->width;
+            for (int x = job->x0; x < job->x1; x++) row[x] = job->depthValue;
+        }
+    }
+}
+
+// Clear current render target buffers, scissor and color mask are applied
+void swClear(unsigned int mask)
+{
+    swFlush();
+
+    swClearJob job = { 0 };
+    job.x1 = RLSW.target.width;
+    job.y1 = RLSW.target.height;
+
+    if (RLSW.scissorTest)
+    {
+        job.x0 = RLSW_MAX(job.x0, RLSW.scissor[0]);
+        job.y0 = RLSW_MAX(job.y0, RLSW.scissor[1]);
+        job.x1 = RLSW_MIN(job.x1, RLSW.scissor[0] + RLSW.scissor[2]);
+        job.y1 = RLSW_MIN(job.y1, RLSW.scissor[1] + RLSW.scissor[3]);
+    }
+
+    if ((job.x0 >= job.x1) || (job.y0 >= job.y1)) return;
+
+    job.color = (mask & SW_COLOR_BUFFER_BIT) != 0;
+    job.depth = ((mask & SW_DEPTH_BUFFER_BIT) != 0) && RLSW.depthMask;
+
+    unsigned int r = (unsigned int)(RLSW_CLAMP(RLSW.clearColor[0], 0.0f, 1.0f)*255.0f + 0.5f);
+    unsigned int g = (unsigned int)(RLSW_CLAMP(RLSW.clearColor[1], 0.0f, 1.0f)*255.0f + 0.5f);
+    unsigned int b = (unsigned int)(RLSW_CLAMP(RLSW.clearColor[2], 0.0f, 1.0f)*255.0f + 0.5f);
+    unsigned int a = (unsigned int)(RLSW_CLAMP(RLSW.clearColor[3], 0.0f, 1.0f)*255.0f + 0.5f);
+    job.colorValue = r | (g << 8) | (b << 16) | (a << 24);
+    job.depthValue = RLSW.clearDepth;
+
+    swParallelFor((job.y1 - job.y0 + SW_CLEAR_BAND_ROWS - 1)/SW_CLEAR_BAND_ROWS, swClearJobFunc, &job);
+}
+
+void swBlendFunc(int sfactor, int dfactor)
+{
+    RLSW.blendSrc = sfactor;
+    RLSW.blendDst = dfactor;
+    RLSW.stateDirty = true;
+}
+
+void swBlendEquation(int mode)
+{
+    RLSW.blendEquation = mode;
+    RLSW.stateDirty = true;
+}
+
+void swDepthFunc(int func)
+{
+    RLSW.depthFunc = func;
+    RLSW.stateDirty = true;
+}
+
+void swDepthMask(unsigned char flag)
+{
+    RLSW.depthMask = (flag != 0);
+    RLSW.stateDirty = true;
+}
+
+void swColorMask(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    RLSW.colorWriteMask = (r? 0x000000ff : 0) | (g? 0x0000ff00 : 0) | (b? 0x00ff0000 : 0) | (a? 0xff000000 : 0);
+    RLSW.stateDirty = true;
+}
+
+void swCullFace(int mode) { RLSW.cullMode = mode; }
+void swFrontFace(int mode) { RLSW.frontFace = mode; }
+void swLineWidth(float width) { RLSW.lineWidth = (width > 0.0f)? width : 1.0f; }
+void swPointSize(float size) { RLSW.pointSize = (size > 0.0f)? size : 1.0f; }
+void swHint(int target, int mode) { (void)target; (void)mode; }
+void swShadeModel(int mode) { (void)mode; }
+
+void swPolygonMode(int face, int mode)
+{
+    // NOTE: Polygon mode is applied to both faces
+    (void)face;
+    RLSW.polygonMode = mode;
+}
+
+void swPixelStorei(int pname, int param)
+{
+    if ((param != 1) && (param != 2) && (param != 4) && (param != 8)) return;
+
+    if (pname == SW_UNPACK_ALIGNMENT) RLSW.unpackAlignment = param;
+    else if (pname == SW_PACK_ALIGNMENT) RLSW.packAlignment = param;
+}
+
+void swGetFloatv(int pname, float *params)
+{
+    switch (pname)
+    {
+        case SW_MODELVIEW_MATRIX: memcpy(params, RLSW.stack[0][RLSW.stackDepth[0]], 16*sizeof(float)); break;
+        case SW_PROJECTION_MATRIX: memcpy(params, RLSW.stack[1][RLSW.stackDepth[1]], 16*sizeof(float)); break;
+        case SW_LINE_WIDTH: params[0] = RLSW.lineWidth; break;
+        case SW_POINT_SIZE: params[0] = RLSW.pointSize; break;
+        case SW_VIEWPORT: for (int i = 0; i < 4; i++) params[i] = (float)RLSW.viewport[i]; break;
+        default: break;
+    }
+}
+
+void swGetIntegerv(int pname, int *params)
+{
+    switch (pname)
+    {
+        case SW_VIEWPORT: for (int i = 0; i < 4; i++) params[i] = RLSW.viewport[i]; break;
+        case SW_DRAW_FRAMEBUFFER_BINDING: params[0] = (int)RLSW.boundFramebuffer; break;
+        default: break;
+    }
+}
+
+const unsigned char *swGetString(int name)
+{
+    const char *result = "";
+
+    switch (name)
+    {
+        case SW_VENDOR: result = "raylib"; break;
+        case SW_RENDERER: result = "rlsw (software rasterizer)"; break;
+        case SW_VERSION: result = "1.1 rlsw 1.0"; break;
+        case SW_EXTENSIONS: result = "GL_EXT_framebuffer_object"; break;
+        default: break;
+    }
+
+    return (const unsigned char *)result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Matrix operations
+//----------------------------------------------------------------------------------
+// Multiply current matrix by provided one: current = current*mat (column-major)
+static void swMultiplyCurrent(const float *mat)
+{
+    float *current = RLSW.stack[RLSW.matrixMode][RLSW.stackDepth[RLSW.matrixMode]];
+    float result[16] = { 0 };
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (int r = 0; r < 4; r++)
+        {
+            result[c*4 + r] = current[r]*mat[c*4] + current[4 + r]*mat[c*4 + 1] + current[8 + r]*mat[c*4 + 2] + current[12 + r]*mat[c*4 + 3];
+        }
+    }
+
+    memcpy(current, result, sizeof(result));
+    RLSW.mvpDirty = true;
+}
+
+void swMatrixMode(int mode)
+{
+    switch (mode)
+    {
+        case SW_MODELVIEW: RLSW.matrixMode = 0; break;
+        case SW_PROJECTION: RLSW.matrixMode = 1; break;
+        case SW_TEXTURE: RLSW.matrixMode = 2; break;
+        default: break;
+    }
+}
+
+void swPushMatrix(void)
+{
+    int mode = RLSW.matrixMode;
+
+    if (RLSW.stackDepth[mode] < (RLSW_MAX_MATRIX_STACK_SIZE - 1))
+    {
+        memcpy(RLSW.stack[mode][RLSW.stackDepth[mode] + 1], RLSW.stack[mode][RLSW.stackDepth[mode]], 16*sizeof(float));
+        RLSW.stackDepth[mode]++;
+    }
+}
+
+void swPopMatrix(void)
+{
+    int mode = RLSW.matrixMode;
+
+    if (RLSW.stackDepth[mode] > 0)
+    {
+        RLSW.stackDepth[mode]--;
+        RLSW.mvpDirty = true;
+    }
+}
+
+void swLoadIdentity(void)
+{
+    float *current = RLSW.stack[RLSW.matrixMode][RLSW.stackDepth[RLSW.matrixMode]];
+
+    memset(current, 0, 16*sizeof(float));
+    current[0] = current[5] = current[10] = current[15] = 1.0f;
+    RLSW.mvpDirty = true;
+}
+
+void swTranslatef(float x, float y, float z)
+{
+    const float mat[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, x, y, z, 1.0f };
+    swMultiplyCurrent(mat);
+}
+
+void swRotatef(float angle, float x, float y, float z)
+{
+    float length = sqrtf(x*x + y*y + z*z);
+    if (length == 0.0f) return;
+
+    x /= length;
+    y /= length;
+    z /= length;
+
+    float radians = angle*3.14159265358979323846f/180.0f;
+    float s = sinf(radians);
+    float c = cosf(radians);
+    float t = 1.0f - c;
+
+    const float mat[16] = {
+        x*x*t + c, y*x*t + z*s, z*x*t - y*s, 0.0f,
+        x*y*t - z*s, y*y*t + c, z*y*t + x*s, 0.0f,
+        x*z*t + y*s, y*z*t - x*s, z*z*t + c, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    swMultiplyCurrent(mat);
+}
+
+void swScalef(float x, float y, float z)
+{
+    const float mat[16] = { x, 0.0f, 0.0f, 0.0f, 0.0f, y, 0.0f, 0.0f, 0.0f, 0.0f, z, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    swMultiplyCurrent(mat);
+}
+
+void swMultMatrixf(const float *mat)
+{
+    swMultiplyCurrent(mat);
+}
+
+void swFrustum(double left, double right, double bottom, double top, double znear, double zfar)
+{
+    float rl = (float)(right - left);
+    float tb = (float)(top - bottom);
+    float fn = (float)(zfar - znear);
+
+    const float mat[16] = {
+        ((float)znear*2.0f)/rl, 0.0f, 0.0f, 0.0f,
+        0.0f, ((float)znear*2.0f)/tb, 0.0f, 0.0f,
+        ((float)right + (float)left)/rl, ((float)top + (float)bottom)/tb, -((float)zfar + (float)znear)/fn, -1.0f,
+        0.0f, 0.0f, -((float)zfar*(float)znear*2.0f)/fn, 0.0f
+    };
+    swMultiplyCurrent(mat);
+}
+
+void swOrtho(double left, double right, double bottom, double top, double znear, double zfar)
+{
+    float rl = (float)(right - left);
+    float tb = (float)(top - bottom);
+    float fn = (float)(zfar - znear);
+
+    const float mat[16] = {
+        2.0f/rl, 0.0f, 0.0f, 0.0f,
+        0.0f, 2.0f/tb, 0.0f, 0.0f,
+        0.0f, 0.0f, -2.0f/fn, 0.0f,
+        -((float)left + (float)right)/rl, -((float)top + (float)bottom)/tb, -((float)zfar + (float)znear)/fn, 1.0f
+    };
+    swMultiplyCurrent(mat);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vertex submission
+//----------------------------------------------------------------------------------
+void swBegin(int mode)
+{
+    RLSW.primitiveMode = mode;
+    RLSW.primitiveCount = 0;
+}
+
+void swEnd(void)
+{
+    // NOTE: Incomplete primitives are discarded
+    RLSW.primitiveMode = -1;
+    RLSW.primitiveCount = 0;
+}
+
+void swVertex2i(int x, int y) { swEmitVertex((float)x, (float)y, 0.0f); }
+void swVertex2f(float x, float y) { swEmitVertex(x, y, 0.0f); }
+void swVertex3f(float x, float y, float z) { swEmitVertex(x, y, z); }
+
+void swTexCoord2f(float u, float v)
+{
+    RLSW.texcoord[0] = u;
+    RLSW.texcoord[1] = v;
+}
+
+void swNormal3f(float x, float y, float z)
+{
+    // NOTE: Lighting not supported, normals are ignored
+    (void)x; (void)y; (void)z;
+}
+
+void swColor3f(float r, float g, float b) { swColor4f(r, g, b, 1.0f); }
+
+void swColor4f(float r, float g, float b, float a)
+{
+    RLSW.color[0] = r;
+    RLSW.color[1] = g;
+    RLSW.color[2] = b;
+    RLSW.color[3] = a;
+}
+
+void swColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    RLSW.color[0] = (float)r/255.0f;
+    RLSW.color[1] = (float)g/255.0f;
+    RLSW.color[2] = (float)b/255.0f;
+    RLSW.color[3] = (float)a/255.0f;
+}
+
+void swEnableClientState(int array)
+{
+    switch (array)
+    {
+        case SW_VERTEX_ARRAY: RLSW.vertexArray.enabled = true; break;
+        case SW_TEXTURE_COORD_ARRAY: RLSW.texcoordArray.enabled = true; break;
+        case SW_COLOR_ARRAY: RLSW.colorArray.enabled = true; break;
+        default: break;
+    }
+}
+
+void swDisableClientState(int array)
+{
+    switch (array)
+    {
+        case SW_VERTEX_ARRAY: RLSW.vertexArray.enabled = false; break;
+        case SW_TEXTURE_COORD_ARRAY: RLSW.texcoordArray.enabled = false; break;
+        case SW_COLOR_ARRAY: RLSW.colorArray.enabled = false; break;
+        default: break;
+    }
+}
+
+void swVertexPointer(int size, int type, int stride, const void *pointer)
+{
+    RLSW.vertexArray.size = size;
+    RLSW.vertexArray.type = type;
+    RLSW.vertexArray.stride = stride;
+    RLSW.vertexArray.pointer = pointer;
+}
+
+void swTexCoordPointer(int size, int type, int stride, const void *pointer)
+{
+    RLSW.texcoordArray.size = size;
+    RLSW.texcoordArray.type = type;
+    RLSW.texcoordArray.stride = stride;
+    RLSW.texcoordArray.pointer = pointer;
+}
+
+void swNormalPointer(int type, int stride, const void *pointer)
+{
+    // NOTE: Lighting not supported, normals are ignored
+    (void)type; (void)stride; (void)pointer;
+}
+
+void swColorPointer(int size, int type, int stride, const void *pointer)
+{
+    RLSW.colorArray.size = size;
+    RLSW.colorArray.type = type;
+    RLSW.colorArray.stride = stride;
+    RLSW.colorArray.pointer = pointer;
+}
+
+// Read one component from a client array (float or unsigned byte normalized)
+static inline float swReadArrayComponent(const swClientArray *array, int index, int component, int defaultSize)
+{
+    int size = (array->size > 0)? array->size : defaultSize;
+    const unsigned char *base = (const unsigned char *)array->pointer;
+
+    if (array->type == SW_UNSIGNED_BYTE)
+    {
+        int stride = (array->stride > 0)? array->stride : size;
+        return (float)base[(size_t)index*stride + component]/255.0f;
+    }
+    else
+    {
+        int stride = (array->stride > 0)? array->stride : size*(int)sizeof(float);
+        return ((const float *)(base + (size_t)index*stride))[component];
+    }
+}
+
+// Submit one vertex from enabled client arrays
+static void swEmitArrayVertex(int index)
+{
+    if (RLSW.texcoordArray.enabled && (RLSW.texcoordArray.pointer != NULL))
+    {
+        RLSW.texcoord[0] = swReadArrayComponent(&RLSW.texcoordArray, index, 0, 2);
+        RLSW.texcoord[1] = swReadArrayComponent(&RLSW.texcoordArray, index, 1, 2);
+    }
+
+    if (RLSW.colorArray.enabled && (RLSW.colorArray.pointer != NULL))
+    {
+        RLSW.color[0] = swReadArrayComponent(&RLSW.colorArray, index, 0, 4);
+        RLSW.color[1] = swReadArrayComponent(&RLSW.colorArray, index, 1, 4);
+        RLSW.color[2] = swReadArrayComponent(&RLSW.colorArray, index, 2, 4);
+        RLSW.color[3] = (RLSW.colorArray.size == 3)? 1.0f : swReadArrayComponent(&RLSW.colorArray, index, 3, 4);
+    }
+
+    float x = swReadArrayComponent(&RLSW.vertexArray, index, 0, 3);
+    float y = swReadArrayComponent(&RLSW.vertexArray, index, 1, 3);
+    float z = (RLSW.vertexArray.size == 2)? 0.0f : swReadArrayComponent(&RLSW.vertexArray, index, 2, 3);
+
+    swEmitVertex(x, y, z);
+}
+
+void swDrawArrays(int mode, int first, int count)
+{
+    if (!RLSW.vertexArray.enabled || (RLSW.vertexArray.pointer == NULL)) return;
+
+    swBegin(mode);
+    for (int i = 0; i < count; i++) swEmitArrayVertex(first + i);
+    swEnd();
+}
+
+void swDrawElements(int mode, int count, int type, const void *indices)
+{
+    if (!RLSW.vertexArray.enabled || (RLSW.vertexArray.pointer == NULL) || (indices == NULL)) return;
+
+    swBegin(mode);
+    for (int i = 0; i < count; i++)
+    {
+        int index = 0;
+
+        if (type == SW_UNSIGNED_BYTE) index = ((const unsigned char *)indices)[i];
+        else if (type == SW_UNSIGNED_SHORT) index = ((const unsigned short *)indices)[i];
+        else if (type == SW_UNSIGNED_INT) index = (int)((const unsigned int *)indices)[i];
+
+        swEmitArrayVertex(index);
+    }
+    swEnd();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Textures
+//----------------------------------------------------------------------------------
+void swGenTextures(int count, unsigned int *textures)
+{
+    for (int n = 0; n < count; n++)
+    {
+        unsigned int id = 0;
+
+        for (int i = 1; i < RLSW.textureCapacity; i++)
+        {
+            if (RLSW.textures[i] == NULL) { id = (unsigned int)i; break; }
+        }
+
+        if (id == 0)
+        {
+            int capacity = RLSW.textureCapacity*2;
+            swTexture **objects = (swTexture **)RL_REALLOC(RLSW.textures, capacity*sizeof(swTexture *));
+            if (objects == NULL) { textures[n] = 0; continue; }
+
+            memset(objects + RLSW.textureCapacity, 0, (capacity - RLSW.textureCapacity)*sizeof(swTexture *));
+            id = (unsigned int)RLSW.textureCapacity;
+            RLSW.textures = objects;
+            RLSW.textureCapacity = capacity;
+        }
+
+        swTexture *texture = (swTexture *)RL_CALLOC(1, sizeof(swTexture));
+        texture->minFilter = SW_NEAREST_MIPMAP_LINEAR;
+        texture->magFilter = SW_LINEAR;
+        texture->wrapS = SW_REPEAT;
+        texture->wrapT = SW_REPEAT;
+        RLSW.textures[id] = texture;
+
+        textures[n] = id;
+    }
+}
+
+void swDeleteTextures(int count, const unsigned int *textures)
+{
+    swFlushIfPending();
+
+    for (int n = 0; n < count; n++)
+    {
+        swTexture *texture = swGetTexture(textures[n]);
+        if (texture == NULL) continue;
+
+        // Detach texture from framebuffers using it
+        for (int i = 1; i < RLSW.framebufferCapacity; i++)
+        {
+            if (RLSW.framebuffers[i].colorTexture == textures[n]) RLSW.framebuffers[i].colorTexture = 0;
+            if (RLSW.framebuffers[i].depthTexture == textures[n]) RLSW.framebuffers[i].depthTexture = 0;
+        }
+
+        RL_FREE(texture->pixels);
+        RL_FREE(texture->depth);
+        RL_FREE(texture);
+        RLSW.textures[textures[n]] = NULL;
+
+        if (RLSW.boundTexture == textures[n]) RLSW.boundTexture = 0;
+    }
+
+    swUpdateTarget();
+    RLSW.stateDirty = true;
+}
+
+void swBindTexture(int target, unsigned int id)
+{
+    if (target != SW_TEXTURE_2D) return;
+
+    RLSW.boundTexture = id;
+    RLSW.stateDirty = true;
+}
+
+void swTexImage2D(int target, int level, int internalFormat, int width, int height, int border, int format, int type, const void *data)
+{
+    (void)border;
+
+    swTexture *texture = swGetTexture(RLSW.boundTexture);
+
+    // NOTE: Only mipmap level 0 is stored, other levels are ignored
+    if ((target != SW_TEXTURE_2D) || (texture == NULL) || (level != 0) || (width <= 0) || (height <= 0)) return;
+
+    swFlushIfPending();
+
+    bool isDepth = (internalFormat == SW_DEPTH_COMPONENT) || (format == SW_DEPTH_COMPONENT);
+    size_t count = (size_t)width*height;
+
+    RL_FREE(texture->pixels);
+    RL_FREE(texture->depth);
+    texture->pixels = NULL;
+    texture->depth = NULL;
+    texture->width = width;
+    texture->height = height;
+    texture->isDepth = isDepth;
+
+    if (isDepth)
+    {
+        texture->depth = (float *)RL_MALLOC(count*sizeof(float));
+        for (size_t i = 0; i < count; i++) texture->depth[i] = 1.0f;
+    }
+    else
+    {
+        texture->pixels = (unsigned int *)RL_CALLOC(count, sizeof(unsigned int));
+
+        if (data != NULL)
+        {
+            int pixelSize = swGetPixelSize(format, type);
+            int rowSize = ((width*pixelSize + RLSW.unpackAlignment - 1)/RLSW.unpackAlignment)*RLSW.unpackAlignment;
+
+            for (int y = 0; y < height; y++)
+            {
+                swConvertToRGBA((const unsigned char *)data + (size_t)y*rowSize, format, type, width, texture->pixels + (size_t)y*width);
+            }
+        }
+    }
+
+    // Texture could be attached to current framebuffer
+    swUpdateTarget();
+}
+
+void swTexSubImage2D(int target, int level, int offsetX, int offsetY, int width, int height, int format, int type, const void *data)
+{
+    swTexture *texture = swGetTexture(RLSW.boundTexture);
+
+    if ((target != SW_TEXTURE_2D) || (texture == NULL) || (texture->pixels == NULL) || (level != 0) || (data == NULL)) return;
+    if ((offsetX < 0) || (offsetY < 0) || ((offsetX + width) > texture->width) || ((offsetY + height) > texture->height)) return;
+
+    swFlushIfPending();
+
+    int pixelSize = swGetPixelSize(format, type);
+    int rowSize = ((width*pixelSize + RLSW.unpackAlignment - 1)/RLSW.unpackAlignment)*RLSW.unpackAlignment;
+
+    for (int y = 0; y < height; y++)
+    {
+        swConvertToRGBA((const unsigned char *)data + (size_t)y*rowSize, format, type, width,
+            texture->pixels + (size_t)(offsetY + y)*texture->width + offsetX);
+    }
+}
+
+void swTexParameteri(int target, int pname, int param)
+{
+    swTexture *texture = swGetTexture(RLSW.boundTexture);
+    if ((target != SW_TEXTURE_2D) || (texture == NULL)) return;
+
+    swFlushIfPending();
+
+    switch (pname)
+    {
+        case SW_TEXTURE_MIN_FILTER: texture->minFilter = param; break;
+        case SW_TEXTURE_MAG_FILTER: texture->magFilter = param; break;
+        case SW_TEXTURE_WRAP_S: texture->wrapS = param; break;
+        case SW_TEXTURE_WRAP_T: texture->wrapT = param; break;
+        default: break;
+    }
+}
+
+void swGetTexImage(int target, int level, int format, int type, void *pixels)
+{
+    swTexture *texture = swGetTexture(RLSW.boundTexture);
+    if ((target != SW_TEXTURE_2D) || (level != 0) || (texture == NULL) || (texture->pixels == NULL) || (pixels == NULL)) return;
+
+    swFlush();
+
+    int pixelSize = swGetPixelSize(format, type);
+    int rowSize = ((texture->width*pixelSize + RLSW.packAlignment - 1)/RLSW.packAlignment)*RLSW.packAlignment;
+
+    for (int y = 0; y < texture->height; y++)
+    {
+        swConvertFromRGBA(texture->pixels + (size_t)y*texture->width, texture->width, format, type, (unsigned char *)pixels + (size_t)y*rowSize);
+    }
+}
+
+void swReadPixels(int x, int y, int width, int height, int format, int type, void *pixels)
+{
+    if ((RLSW.target.color == NULL) || (pixels == NULL)) return;
+
+    swFlush();
+
+    int pixelSize = swGetPixelSize(format, type);
+    int rowSize = ((width*pixelSize + RLSW.packAlignment - 1)/RLSW.packAlignment)*RLSW.packAlignment;
+
+    for (int row = 0; row < height; row++)
+    {
+        int sy = y + row;
+        if ((sy < 0) || (sy >= RLSW.target.height)) continue;
+
+        // Pixels out of the framebuffer are left untouched
+        int x0 = RLSW_MAX(x, 0);
+        int x1 = RLSW_MIN(x + width, RLSW.target.width);
+        if (x0 >= x1) continue;
+
+        swConvertFromRGBA(RLSW.target.color + (size_t)sy*RLSW.target.width + x0, x1 - x0, format, type,
+            (unsigned char *)pixels + (size_t)row*rowSize + (size_t)(x0 - x)*pixelSize);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Framebuffer objects
+//----------------------------------------------------------------------------------
+void swGenFramebuffers(int count, unsigned int *framebuffers)
+{
+    for (int n = 0; n < count; n++)
+    {
+        unsigned int id = 0;
+
+        for (int i = 1; i < RLSW.framebufferCapacity; i++)
+        {
+            if (!RLSW.framebuffers[i].used) { id = (unsigned int)i; break; }
+        }
+
+        if (id == 0)
+        {
+            int capacity = RLSW.framebufferCapacity*2;
+            swFramebuffer *buffers = (swFramebuffer *)RL_REALLOC(RLSW.framebuffers, capacity*sizeof(swFramebuffer));
+            if (buffers == NULL) { framebuffers[n] = 0; continue; }
+
+            memset(buffers + RLSW.framebufferCapacity, 0, (capacity - RLSW.framebufferCapacity)*sizeof(swFramebuffer));
+            id = (unsigned int)RLSW.framebufferCapacity;
+            RLSW.framebuffers = buffers;
+            RLSW.framebufferCapacity = capacity;
+        }
+
+        RLSW.framebuffers[id].used = true;
+        RLSW.framebuffers[id].colorTexture = 0;
+        RLSW.framebuffers[id].depthTexture = 0;
+
+        framebuffers[n] = id;
+    }
+}
+
+void swDeleteFramebuffers(int count, const unsigned int *framebuffers)
+{
+    for (int n = 0; n < count; n++)
+    {
+        unsigned int id = framebuffers[n];
+        if ((id == 0) || ((int)id >= RLSW.framebufferCapacity) || !RLSW.framebuffers[id].used) continue;
+
+        // NOTE: Attached textures are not deleted, same as OpenGL
+        if (RLSW.boundFramebuffer == id) swBindFramebuffer(SW_FRAMEBUFFER, 0);
+        memset(&RLSW.framebuffers[id], 0, sizeof(swFramebuffer));
+    }
+}
+
+void swBindFramebuffer(int target, unsigned int id)
+{
+    (void)target;
+
+    if ((id != 0) && (((int)id >= RLSW.framebufferCapacity) || !RLSW.framebuffers[id].used)) return;
+    if (id == RLSW.boundFramebuffer) return;
+
+    swFlush();
+
+    RLSW.boundFramebuffer = id;
+    swUpdateTarget();
+}
+
+void swFramebufferTexture2D(int target, int attachment, int textarget, unsigned int texture, int level)
+{
+    (void)target;
+    (void)textarget;
+    (void)level;
+
+    unsigned int id = RLSW.boundFramebuffer;
+    if (id == 0) return;
+
+    if (id == RLSW.boundFramebuffer) swFlush();
+
+    if (attachment == SW_COLOR_ATTACHMENT0) RLSW.framebuffers[id].colorTexture = texture;
+    else if (attachment == SW_DEPTH_ATTACHMENT) RLSW.framebuffers[id].depthTexture = texture;
+
+    swUpdateTarget();
+}
+
+int swCheckFramebufferStatus(int target)
+{
+    (void)target;
+
+    unsigned int id = RLSW.boundFramebuffer;
+    if (id == 0) return SW_FRAMEBUFFER_COMPLETE;
+
+    swTexture *color = swGetTexture(RLSW.framebuffers[id].colorTexture);
+    swTexture *depth = swGetTexture(RLSW.framebuffers[id].depthTexture);
+
+    if ((color == NULL) && (depth == NULL)) return SW_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT;
+    if ((color != NULL) && ((color->pixels == NULL) || color->isDepth)) return SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+    if ((depth != NULL) && ((depth->depth == NULL) || !depth->isDepth)) return SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+    if ((color != NULL) && (depth != NULL) && ((color->width != depth->width) || (color->height != depth->height))) return SW_FRAMEBUFFER_UNSUPPORTED;
+
+    return SW_FRAMEBUFFER_COMPLETE;
+}
+
+void swGetFramebufferAttachments(unsigned int id, unsigned int *colorTexture, unsigned int *depthTexture)
+{
+    unsigned int color = 0, depth = 0;
+
+    if ((id > 0) && ((int)id < RLSW.framebufferCapacity) && RLSW.framebuffers[id].used)
+    {
+        color = RLSW.framebuffers[id].colorTexture;
+        depth = RLSW.framebuffers[id].depthTexture;
+    }
+
+    if (colorTexture != NULL) *colorTexture = color;
+    if (depthTexture != NULL) *depthTexture = depth;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Threads pool
+//----------------------------------------------------------------------------------
+#if !defined(RLSW_NO_THREADS)
+#if defined(_WIN32)
+static void swMutexInit(swMutex *mutex) { InitializeSRWLock(mutex); }
+static void swMutexDestroy(swMutex *mutex) { (void)mutex; }
+static void swMutexLock(swMutex *mutex) { AcquireSRWLockExclusive(mutex); }
+static void swMutexUnlock(swMutex *mutex) { ReleaseSRWLockExclusive(mutex); }
+static void swConditionInit(swCondition *cond) { InitializeConditionVariable(cond); }
+static void swConditionDestroy(swCondition *cond) { (void)cond; }
+static void swConditionWait(swCondition *cond, swMutex *mutex) { SleepConditionVariableSRW(cond, mutex, 0xffffffff, 0); }
+static void swConditionBroadcast(swCondition *cond) { WakeAllConditionVariable(cond); }
+#else
+static void swMutexInit(swMutex *mutex) { pthread_mutex_init(mutex, NULL); }
+static void swMutexDestroy(swMutex *mutex) { pthread_mutex_destroy(mutex); }
+static void swMutexLock(swMutex *mutex) { pthread_mutex_lock(mutex); }
+static void swMutexUnlock(swMutex *mutex) { pthread_mutex_unlock(mutex); }
+static void swConditionInit(swCondition *cond) { pthread_cond_init(cond, NULL); }
+static void swConditionDestroy(swCondition *cond) { pthread_cond_destroy(cond); }
+static void swConditionWait(swCondition *cond, swMutex *mutex) { pthread_cond_wait(cond, mutex); }
+static void swConditionBroadcast(swCondition *cond) { pthread_cond_broadcast(cond); }
+#endif
+
+// Process items of current job until none left, mutex must be locked
+static void swThreadPoolWork(swThreadPool *pool)
+{
+    while (pool->jobNext < pool->jobCount)
+    {
+        int index = pool->jobNext++;
+
+        swMutexUnlock(&pool->mutex);
+        pool->job(index, pool->jobData);
+        swMutexLock(&pool->mutex);
+
+        pool->jobDone++;
+        if (pool->jobDone == pool->jobCount) swConditionBroadcast(&pool->doneCond);
+    }
+}
+
+// Worker thread main loop
+#if defined(_WIN32)
+static unsigned long __stdcall swWorkerThread(void *param)
+#else
+static void *swWorkerThread(void *param)
+#endif
+{
+    swThreadPool *pool = (swThreadPool *)param;
+    unsigned int generation = 0;
+
+    swMutexLock(&pool->mutex);
+
+    while (true)
+    {
+        while (!pool->quit && (pool->generation == generation)) swConditionWait(&pool->wakeCond, &pool->mutex);
+        if (pool->quit) break;
+
+        generation = pool->generation;
+        swThreadPoolWork(pool);
+    }
+
+    swMutexUnlock(&pool->mutex);
+
+    return 0;
+}
+#endif
+
+// Get number of logical processors available
+static int swGetProcessorCount(void)
+{
+    int count = 1;
+
+#if !defined(RLSW_NO_THREADS)
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #elif defined(_SC_NPROCESSORS_ONLN)
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Initialize threads pool, threadCount includes calling thread (0 = one per processor)
+static void swThreadPoolInit(swThreadPool *pool, int threadCount)
+{
+    if (threadCount <= 0) threadCount = swGetProcessorCount();
+    threadCount = RLSW_CLAMP(threadCount, 1, RLSW_MAX_THREADS);
+
+#if defined(RLSW_NO_THREADS)
+    pool->threadCount = 1;
+#else
+    swMutexInit(&pool->mutex);
+    swConditionInit(&pool->wakeCond);
+    swConditionInit(&pool->doneCond);
+    pool->generation = 0;
+    pool->quit = false;
+    pool->threadCount = 1;
+
+    for (int i = 0; i < (threadCount - 1); i++)
+    {
+    #if defined(_WIN32)
+        pool->threads[i] = CreateThread(NULL, 0, swWorkerThread, pool, 0, NULL);
+        if (pool->threads[i] == NULL) break;
+    #else
+        if (pthread_create(&pool->threads[i], NULL, swWorkerThread, pool) != 0) break;
+    #endif
+        pool->threadCount++;
+    }
+#endif
+}
+
+// Close threads pool, waiting for workers to exit
+static void swThreadPoolClose(swThreadPool *pool)
+{
+    if (pool->threadCount == 0) return;
+
+#if !defined(RLSW_NO_THREADS)
+    swMutexLock(&pool->mutex);
+    pool->quit = true;
+    swConditionBroadcast(&pool->wakeCond);
+    swMutexUnlock(&pool->mutex);
+
+    for (int i = 0; i < (pool->threadCount - 1); i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(pool->threads[i], 0xffffffff);
+        CloseHandle(pool->threads[i]);
+    #else
+        pthread_join(pool->threads[i], NULL);
+    #endif
+    }
+
+    swConditionDestroy(&pool->wakeCond);
+    swConditionDestroy(&pool->doneCond);
+    swMutexDestroy(&pool->mutex);
+#endif
+
+    pool->threadCount = 0;
+}
+
+// Run job items [0, count) on all threads, returns when all items are processed
+static void swParallelFor(int count, swJobFunc func, void *userData)
+{
+    if (count <= 0) return;
+
+#if !defined(RLSW_NO_THREADS)
+    swThreadPool *pool = &RLSW.pool;
+
+    if ((pool->threadCount > 1) && (count > 1))
+    {
+        swMutexLock(&pool->mutex);
+
+        pool->job = func;
+        pool->jobData = userData;
+        pool->jobCount = count;
+        pool->jobNext = 0;
+        pool->jobDone = 0;
+        pool->generation++;
+        swConditionBroadcast(&pool->wakeCond);
+
+        // Calling thread also processes items
+        swThreadPoolWork(pool);
+        while (pool->jobDone < pool->jobCount) swConditionWait(&pool->doneCond, &pool->mutex);
+
+        pool->jobCount = 0;
+        pool->jobNext = 0;
+        swMutexUnlock(&pool->mutex);
+
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) func(i, userData);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Geometry processing
+//----------------------------------------------------------------------------------
+// Get texture object from id
+static swTexture *swGetTexture(unsigned int id)
+{
+    if ((id == 0) || ((int)id >= RLSW.textureCapacity)) return NULL;
+    return RLSW.textures[id];
+}
+
+// Flush pending triangles, required before modifying objects they could reference
+static void swFlushIfPending(void)
+{
+    if (RLSW.triangleCount > 0) swFlush();
+}
+
+// Resolve current render target from framebuffer binding and setup tiles grid
+static void swUpdateTarget(void)
+{
+    swTarget target = { 0 };
+
+    if (RLSW.boundFramebuffer == 0)
+    {
+        target.color = RLSW.colorBuffer;
+        target.depth = RLSW.depthBuffer;
+        target.width = RLSW.width;
+        target.height = RLSW.height;
+    }
+    else
+    {
+        swTexture *color = swGetTexture(RLSW.framebuffers[RLSW.boundFramebuffer].colorTexture);
+        swTexture *depth = swGetTexture(RLSW.framebuffers[RLSW.boundFramebuffer].depthTexture);
+
+        if ((color != NULL) && (color->pixels != NULL))
+        {
+            target.color = color->pixels;
+            target.width = color->width;
+            target.height = color->height;
+        }
+
+        if ((depth != NULL) && (depth->depth != NULL))
+        {
+            if (target.color == NULL)
+            {
+                target.width = depth->width;
+                target.height = depth->height;
+            }
+
+            // NOTE: Depth attachment is only used if it matches color attachment size
+            if ((depth->width == target.width) && (depth->height == target.height)) target.depth = depth->depth;
+        }
+    }
+
+    RLSW.target = target;
+
+    RLSW.tilesX = (target.width + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+    RLSW.tilesY = (target.height + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+
+    int tileCount = RLSW.tilesX*RLSW.tilesY;
+
+    if (tileCount > RLSW.binCapacity)
+    {
+        swTileBin *bins = (swTileBin *)RL_REALLOC(RLSW.bins, tileCount*sizeof(swTileBin));
+        int *activeTiles = (int *)RL_REALLOC(RLSW.activeTiles, tileCount*sizeof(int));
+
+        if (bins != NULL) RLSW.bins = bins;
+        if (activeTiles != NULL) RLSW.activeTiles = activeTiles;
+
+        if ((bins == NULL) || (activeTiles == NULL))
+        {
+            // Not enough memory, nothing is rendered to this target
+            RLSW.tilesX = 0;
+            RLSW.tilesY = 0;
+            return;
+        }
+
+        memset(RLSW.bins + RLSW.binCapacity, 0, (tileCount - RLSW.binCapacity)*sizeof(swTileBin));
+        RLSW.binCapacity = tileCount;
+    }
+}
+
+// Transform vertex with current state and push it to primitive assembly
+static void swEmitVertex(float x, float y, float z)
+{
+    if (RLSW.primitiveMode < 0) return;
+
+    if (RLSW.mvpDirty)
+    {
+        const float *mv = RLSW.stack[0][RLSW.stackDepth[0]];
+        const float *p = RLSW.stack[1][RLSW.stackDepth[1]];
+
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                RLSW.mvp[c*4 + r] = p[r]*mv[c*4] + p[4 + r]*mv[c*4 + 1] + p[8 + r]*mv[c*4 + 2] + p[12 + r]*mv[c*4 + 3];
+            }
+        }
+
+        RLSW.mvpDirty = false;
+    }
+
+    const float *m = RLSW.mvp;
+    swVertex *vertex = &RLSW.primitive[RLSW.primitiveCount];
+
+    vertex->position[0] = m[0]*x + m[4]*y + m[8]*z + m[12];
+    vertex->position[1] = m[1]*x + m[5]*y + m[9]*z + m[13];
+    vertex->position[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+    vertex->position[3] = m[3]*x + m[7]*y + m[11]*z + m[15];
+    vertex->texcoord[0] = RLSW.texcoord[0];
+    vertex->texcoord[1] = RLSW.texcoord[1];
+    memcpy(vertex->color, RLSW.color, 4*sizeof(float));
+
+    RLSW.primitiveCount++;
+
+    switch (RLSW.primitiveMode)
+    {
+        case SW_POINTS:
+        {
+            swProcessPoint(&RLSW.primitive[0]);
+            RLSW.primitiveCount = 0;
+        } break;
+        case SW_LINES:
+        {
+            if (RLSW.primitiveCount == 2)
+            {
+                swProcessLine(&RLSW.primitive[0], &RLSW.primitive[1]);
+                RLSW.primitiveCount = 0;
+            }
+        } break;
+        case SW_TRIANGLES:
+        {
+            if (RLSW.primitiveCount == 3)
+            {
+                swProcessTriangle(&RLSW.primitive[0], &RLSW.primitive[1], &RLSW.primitive[2]);
+                RLSW.primitiveCount = 0;
+            }
+        } break;
+        case SW_QUADS:
+        {
+            if (RLSW.primitiveCount == 4)
+            {
+                swProcessTriangle(&RLSW.primitive[0], &RLSW.primitive[1], &RLSW.primitive[2]);
+                swProcessTriangle(&RLSW.primitive[0], &RLSW.primitive[2], &RLSW.primitive[3]);
+                RLSW.primitiveCount = 0;
+            }
+        } break;
+        default: RLSW.primitiveCount = 0; break;
+    }
+}
+
+// Clip planes in clip space: dot(plane, position) >= 0 is inside
+static const float swClipPlanes[7][4] = {
+    { 0.0f, 0.0f, 1.0f, 1.0f },             // Near: z >= -w
+    { 0.0f, 0.0f, -1.0f, 1.0f },            // Far: z <= w
+    { 0.0f, 0.0f, 0.0f, 1.0f },             // Positive w (offset applied on distance)
+    { 1.0f, 0.0f, 0.0f, SW_GUARD_BAND },    // Left guard band
+    { -1.0f, 0.0f, 0.0f, SW_GUARD_BAND },   // Right guard band
+    { 0.0f, 1.0f, 0.0f, SW_GUARD_BAND },    // Bottom guard band
+    { 0.0f, -1.0f, 0.0f, SW_GUARD_BAND },   // Top guard band
+};
+
+static inline float swClipDistance(const swVertex *v, int plane)
+{
+    const float *p = swClipPlanes[plane];
+    float distance = p[0]*v->position[0] + p[1]*v->position[1] + p[2]*v->position[2] + p[3]*v->position[3];
+    if (plane == 2) distance -= 1e-6f;
+    return distance;
+}
+
+// Interpolate all vertex attributes
+static inline void swLerpVertex(const swVertex *a, const swVertex *b, float t, swVertex *out)
+{
+    for (int i = 0; i < 4; i++) out->position[i] = a->position[i] + (b->position[i] - a->position[i])*t;
+    for (int i = 0; i < 2; i++) out->texcoord[i] = a->texcoord[i] + (b->texcoord[i] - a->texcoord[i])*t;
+    for (int i = 0; i < 4; i++) out->color[i] = a->color[i] + (b->color[i] - a->color[i])*t;
+}
+
+// Project clip-space vertex to window space: (x, y, z, 1/w)
+static inline void swProjectVertex(swVertex *v)
+{
+    float invw = 1.0f/v->position[3];
+
+    v->position[0] = (float)RLSW.viewport[0] + (v->position[0]*invw + 1.0f)*0.5f*(float)RLSW.viewport[2];
+    v->position[1] = (float)RLSW.viewport[1] + (v->position[1]*invw + 1.0f)*0.5f*(float)RLSW.viewport[3];
+    v->position[2] = (v->position[2]*invw + 1.0f)*0.5f;
+    v->position[3] = invw;
+}
+
+// Process triangle: polygon mode, clipping, projection and setup
+static void swProcessTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2)
+{
+    if (RLSW.polygonMode == SW_LINE)
+    {
+        swProcessLine(v0, v1);
+        swProcessLine(v1, v2);
+        swProcessLine(v2, v0);
+        return;
+    }
+    else if (RLSW.polygonMode == SW_POINT)
+    {
+        swProcessPoint(v0);
+        swProcessPoint(v1);
+        swProcessPoint(v2);
+        return;
+    }
+
+    // Check clipping requirements
+    int clipMask = 0;
+    for (int p = 0; p < 7; p++)
+    {
+        int outside = (swClipDistance(v0, p) < 0.0f) + (swClipDistance(v1, p) < 0.0f) + (swClipDistance(v2, p) < 0.0f);
+
+        if (outside == 3) return;   // Fully outside one plane, rejected
+        if (outside > 0) clipMask |= (1 << p);
+    }
+
+    if (clipMask == 0)
+    {
+        swVertex a = *v0, b = *v1, c = *v2;
+        swProjectVertex(&a);
+        swProjectVertex(&b);
+        swProjectVertex(&c);
+        swSetupTriangle(&a, &b, &c, true);
+        return;
+    }
+
+    // Clip polygon against required planes (Sutherland-Hodgman)
+    swVertex buffers[2][SW_CLIP_MAX_VERTICES];
+    swVertex *input = buffers[0];
+    swVertex *output = buffers[1];
+    int count = 3;
+
+    input[0] = *v0;
+    input[1] = *v1;
+    input[2] = *v2;
+
+    for (int p = 0; (p < 7) && (count >= 3); p++)
+    {
+        if (!(clipMask & (1 << p))) continue;
+
+        int outCount = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const swVertex *current = &input[i];
+            const swVertex *next = &input[(i + 1)%count];
+            float dc = swClipDistance(current, p);
+            float dn = swClipDistance(next, p);
+
+            if (dc >= 0.0f) output[outCount++] = *current;
+            if (((dc >= 0.0f) != (dn >= 0.0f)) && (outCount < SW_CLIP_MAX_VERTICES)) swLerpVertex(current, next, dc/(dc - dn), &output[outCount++]);
+            if (outCount >= SW_CLIP_MAX_VERTICES) break;
+        }
+
+        swVertex *temp = input;
+        input = output;
+        output = temp;
+        count = outCount;
+    }
+
+    if (count < 3) return;
+
+    for (int i = 0; i < count; i++) swProjectVertex(&input[i]);
+    for (int i = 1; i < (count - 1); i++) swSetupTriangle(&input[0], &input[i], &input[i + 1], true);
+}
+
+// Process line: clipping, projection and expansion to a screen-space quad
+static void swProcessLine(const swVertex *v0, const swVertex *v1)
+{
+    swVertex a = *v0, b = *v1;
+
+    for (int p = 0; p < 7; p++)
+    {
+        float da = swClipDistance(&a, p);
+        float db = swClipDistance(&b, p);
+
+        if ((da < 0.0f) && (db < 0.0f)) return;
+        if (da < 0.0f) swLerpVertex(&a, &b, da/(da - db), &a);
+        else if (db < 0.0f) swLerpVertex(&b, &a, db/(db - da), &b);
+    }
+
+    swProjectVertex(&a);
+    swProjectVertex(&b);
+
+    float dx = b.position[0] - a.position[0];
+    float dy = b.position[1] - a.position[1];
+    if ((dx == 0.0f) && (dy == 0.0f)) return;
+
+    // NOTE: Following OpenGL wide lines rasterization, lines are offset along the minor axis,
+    // so every column (x-major) or row (y-major) gets lineWidth pixels
+    float halfWidth = RLSW.lineWidth*0.5f;
+    float ox = 0.0f, oy = 0.0f;
+
+    if (fabsf(dx) >= fabsf(dy)) oy = halfWidth;
+    else ox = halfWidth;
+
+    swVertex q[4] = { a, a, b, b };
+    q[0].position[0] -= ox; q[0].position[1] -= oy;
+    q[1].position[0] += ox; q[1].position[1] += oy;
+    q[2].position[0] += ox; q[2].position[1] += oy;
+    q[3].position[0] -= ox; q[3].position[1] -= oy;
+
+    swSetupTriangle(&q[0], &q[1], &q[2], false);
+    swSetupTriangle(&q[0], &q[2], &q[3], false);
+}
+
+// Process point: clipping, projection and expansion to a screen-space square
+static void swProcessPoint(const swVertex *v)
+{
+    for (int p = 0; p < 3; p++) if (swClipDistance(v, p) < 0.0f) return;
+
+    swVertex a = *v;
+    swProjectVertex(&a);
+
+    float half = RLSW.pointSize*0.5f;
+    swVertex q[4] = { a, a, a, a };
+    q[0].position[0] -= half; q[0].position[1] -= half;
+    q[1].position[0] += half; q[1].position[1] -= half;
+    q[2].position[0] += half; q[2].position[1] += half;
+    q[3].position[0] -= half; q[3].position[1] += half;
+
+    swSetupTriangle(&q[0], &q[1], &q[2], false);
+    swSetupTriangle(&q[0], &q[2], &q[3], false);
+}
+
+// Compute attribute plane: value = plane[0]*x + plane[1]*y + plane[2]
+static inline void swSetupPlane(const swVertex *a, const swVertex *b, const swVertex *c, float fa, float fb, float fc, float invArea, float *plane)
+{
+    float e1x = b->position[0] - a->position[0], e1y = b->position[1] - a->position[1];
+    float e2x = c->position[0] - a->position[0], e2y = c->position[1] - a->position[1];
+
+    plane[0] = ((fb - fa)*e2y - (fc - fa)*e1y)*invArea;
+    plane[1] = ((fc - fa)*e1x - (fb - fa)*e2x)*invArea;
+    plane[2] = fa - plane[0]*a->position[0] - plane[1]*a->position[1];
+}
+
+// Compute edge function for edge p -> q: E(x, y) = A*x + B*y + C
+// NOTE: Formulation is exactly antisymmetric, shared edges produce the same values with opposite sign,
+// together with the top-left rule every pixel on a shared edge is rasterized exactly once
+static inline void swSetupEdge(const swVertex *p, const swVertex *q, swTriangle *tri, int index)
+{
+    float a = p->position[1] - q->position[1];
+    float b = q->position[0] - p->position[0];
+
+    tri->edgeA[index] = a;
+    tri->edgeB[index] = b;
+    tri->edgeC[index] = p->position[0]*q->position[1] - p->position[1]*q->position[0];
+    tri->edgeInclusive[index] = (a > 0.0f) || ((a == 0.0f) && (b < 0.0f));
+}
+
+// Setup triangle in window space and bin it into screen tiles
+static void swSetupTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2, bool cull)
+{
+    if ((RLSW.tilesX == 0) || ((RLSW.target.color == NULL) && (RLSW.target.depth == NULL))) return;
+
+    const swVertex *a = v0, *b = v1, *c = v2;
+    float area = (b->position[0] - a->position[0])*(c->position[1] - a->position[1]) - (b->position[1] - a->position[1])*(c->position[0] - a->position[0]);
+
+    if (!(area != 0.0f) || (area != area)) return;     // Degenerated or NaN
+
+    if (cull && RLSW.cullFace)
+    {
+        bool front = (RLSW.frontFace == SW_CCW)? (area > 0.0f) : (area < 0.0f);
+
+        if (RLSW.cullMode == SW_FRONT_AND_BACK) return;
+        if ((RLSW.cullMode == SW_BACK) && !front) return;
+        if ((RLSW.cullMode == SW_FRONT) && front) return;
+    }
+
+    // Make winding counter-clockwise, inside is E >= 0 for all edges
+    if (area < 0.0f)
+    {
+        const swVertex *temp = b;
+        b = c;
+        c = temp;
+        area = -area;
+    }
+
+    // Bounding box, clipped to viewport, target and scissor
+    float minX = RLSW_MIN(a->position[0], RLSW_MIN(b->position[0], c->position[0]));
+    float maxX = RLSW_MAX(a->position[0], RLSW_MAX(b->position[0], c->position[0]));
+    float minY = RLSW_MIN(a->position[1], RLSW_MIN(b->position[1], c->position[1]));
+    float maxY = RLSW_MAX(a->position[1], RLSW_MAX(b->position[1], c->position[1]));
+
+    int clipX0 = RLSW_MAX(0, RLSW.viewport[0]);
+    int clipY0 = RLSW_MAX(0, RLSW.viewport[1]);
+    int clipX1 = RLSW_MIN(RLSW.target.width, RLSW.viewport[0] + RLSW.viewport[2]);
+    int clipY1 = RLSW_MIN(RLSW.target.height, RLSW.viewport[1] + RLSW.viewport[3]);
+
+    if (RLSW.scissorTest)
+    {
+        clipX0 = RLSW_MAX(clipX0, RLSW.scissor[0]);
+        clipY0 = RLSW_MAX(clipY0, RLSW.scissor[1]);
+        clipX1 = RLSW_MIN(clipX1, RLSW.scissor[0] + RLSW.scissor[2]);
+        clipY1 = RLSW_MIN(clipY1, RLSW.scissor[1] + RLSW.scissor[3]);
+    }
+
+    if ((maxX < (float)clipX0) || (minX > (float)clipX1) || (maxY < (float)clipY0) || (minY > (float)clipY1)) return;
+
+    int xmin = RLSW_MAX(clipX0, (int)floorf(minX));
+    int xmax = RLSW_MIN(clipX1, (int)ceilf(maxX) + 1);
+    int ymin = RLSW_MAX(clipY0, (int)floorf(minY));
+    int ymax = RLSW_MIN(clipY1, (int)ceilf(maxY) + 1);
+
+    if ((xmin >= xmax) || (ymin >= ymax)) return;
+
+    // Make room for the new triangle and its state
+    if (RLSW.triangleCount >= RLSW_MAX_PENDING_TRIANGLES) swFlush();
+
+    if (RLSW.triangleCount >= RLSW.triangleCapacity)
+    {
+        int capacity = (RLSW.triangleCapacity == 0)? 1024 : RLSW.triangleCapacity*2;
+        swTriangle *triangles = (swTriangle *)RL_REALLOC(RLSW.triangles, capacity*sizeof(swTriangle));
+        if (triangles == NULL) return;
+
+        RLSW.triangles = triangles;
+        RLSW.triangleCapacity = capacity;
+    }
+
+    if (RLSW.stateDirty || (RLSW.stateCount == 0))
+    {
+        if (RLSW.stateCount >= RLSW.stateCapacity)
+        {
+            int capacity = (RLSW.stateCapacity == 0)? 64 : RLSW.stateCapacity*2;
+            swDrawState *states = (swDrawState *)RL_REALLOC(RLSW.states, capacity*sizeof(swDrawState));
+            if (states == NULL) return;
+
+            RLSW.states = states;
+            RLSW.stateCapacity = capacity;
+        }
+
+        swDrawState *state = &RLSW.states[RLSW.stateCount++];
+        const swTexture *texture = RLSW.texture2D? swGetTexture(RLSW.boundTexture) : NULL;
+
+        state->texture = ((texture != NULL) && (texture->pixels != NULL))? texture : NULL;
+        state->blend = RLSW.blend && !((RLSW.blendSrc == SW_ONE) && (RLSW.blendDst == SW_ZERO) && (RLSW.blendEquation == SW_FUNC_ADD));
+        state->blendSrc = RLSW.blendSrc;
+        state->blendDst = RLSW.blendDst;
+        state->blendEquation = RLSW.blendEquation;
+        state->depthTest = RLSW.depthTest;
+        state->depthFunc = RLSW.depthFunc;
+        state->depthWrite = RLSW.depthTest && RLSW.depthMask;
+        state->colorWriteMask = RLSW.colorWriteMask;
+
+        RLSW.stateDirty = false;
+    }
+
+    int index = RLSW.triangleCount;
+    swTriangle *tri = &RLSW.triangles[index];
+    float invArea = 1.0f/area;
+
+    swSetupEdge(b, c, tri, 0);
+    swSetupEdge(c, a, tri, 1);
+    swSetupEdge(a, b, tri, 2);
+
+    tri->perspective = !((a->position[3] == b->position[3]) && (b->position[3] == c->position[3]));
+
+    swSetupPlane(a, b, c, a->position[2], b->position[2], c->position[2], invArea, tri->depth);
+    swSetupPlane(a, b, c, a->position[3], b->position[3], c->position[3], invArea, tri->invw);
+
+    float wa = tri->perspective? a->position[3] : 1.0f;
+    float wb = tri->perspective? b->position[3] : 1.0f;
+    float wc = tri->perspective? c->position[3] : 1.0f;
+
+    swSetupPlane(a, b, c, a->texcoord[0]*wa, b->texcoord[0]*wb, c->texcoord[0]*wc, invArea, tri->attribs[0]);
+    swSetupPlane(a, b, c, a->texcoord[1]*wa, b->texcoord[1]*wb, c->texcoord[1]*wc, invArea, tri->attribs[1]);
+    for (int i = 0; i < 4; i++) swSetupPlane(a, b, c, a->color[i]*wa, b->color[i]*wb, c->color[i]*wc, invArea, tri->attribs[2 + i]);
+
+    tri->xmin = xmin;
+    tri->xmax = xmax;
+    tri->ymin = ymin;
+    tri->ymax = ymax;
+    tri->state = RLSW.stateCount - 1;
+
+    // Bin triangle into every tile overlapped by the triangle (not only by its bounding box)
+    int tx0 = xmin/RLSW_TILE_SIZE, tx1 = (xmax - 1)/RLSW_TILE_SIZE;
+    int ty0 = ymin/RLSW_TILE_SIZE, ty1 = (ymax - 1)/RLSW_TILE_SIZE;
+    bool binned = false;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        float y0 = (float)(ty*RLSW_TILE_SIZE), y1 = (float)((ty + 1)*RLSW_TILE_SIZE);
+
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            float x0 = (float)(tx*RLSW_TILE_SIZE), x1 = (float)((tx + 1)*RLSW_TILE_SIZE);
+            bool outside = false;
+
+            if ((tx0 != tx1) || (ty0 != ty1))
+            {
+                for (int e = 0; e < 3; e++)
+                {
+                    // Tile corner maximizing edge function
+                    float cx = (tri->edgeA[e] > 0.0f)? x1 : x0;
+                    float cy = (tri->edgeB[e] > 0.0f)? y1 : y0;
+                    if ((tri->edgeA[e]*cx + tri->edgeB[e]*cy + tri->edgeC[e]) < 0.0f) { outside = true; break; }
+                }
+            }
+
+            if (outside) continue;
+
+            swTileBin *bin = &RLSW.bins[ty*RLSW.tilesX + tx];
+
+            if (bin->count >= bin->capacity)
+            {
+                int capacity = (bin->capacity == 0)? 256 : bin->capacity*2;
+                int *triangles = (int *)RL_REALLOC(bin->triangles, capacity*sizeof(int));
+                if (triangles == NULL) continue;
+
+                bin->triangles = triangles;
+                bin->capacity = capacity;
+            }
+
+            bin->triangles[bin->count++] = index;
+            binned = true;
+        }
+    }
+
+    if (binned) RLSW.triangleCount++;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Rasterization
+//----------------------------------------------------------------------------------
+// Wrap texel coordinate depending on wrap mode
+static inline int swWrapCoord(int i, int size, int mode)
+{
+    switch (mode)
+    {
+        case SW_CLAMP_TO_EDGE: return RLSW_CLAMP(i, 0, size - 1);
+        case SW_MIRRORED_REPEAT:
+        {
+            int period = size*2;
+            i %= period;
+            if (i < 0) i += period;
+            return (i < size)? i : (period - 1 - i);
+        }
+        default:
+        {
+            i %= size;
+            return (i < 0)? (i + size) : i;
+        }
+    }
+}
+
+// Sample texture at normalized coordinates, returns packed RGBA8 texel
+static inline unsigned int swSampleTexture(const swTexture *texture, float u, float v)
+{
+    // NOTE: Without mipmaps, minification uses the base level linear/nearest filter
+    bool linear = (texture->magFilter == SW_LINEAR) || (texture->minFilter == SW_LINEAR) ||
+        (texture->minFilter == SW_LINEAR_MIPMAP_NEAREST) || (texture->minFilter == SW_LINEAR_MIPMAP_LINEAR);
+
+    float fu = u*(float)texture->width;
+    float fv = v*(float)texture->height;
+
+    if (!linear)
+    {
+        int x = swWrapCoord((int)floorf(fu), texture->width, texture->wrapS);
+        int y = swWrapCoord((int)floorf(fv), texture->height, texture->wrapT);
+
+        return texture->pixels[(size_t)y*texture->width + x];
+    }
+
+    fu -= 0.5f;
+    fv -= 0.5f;
+
+    float flu = floorf(fu), flv = floorf(fv);
+    int x0 = swWrapCoord((int)flu, texture->width, texture->wrapS);
+    int x1 = swWrapCoord((int)flu + 1, texture->width, texture->wrapS);
+    int y0 = swWrapCoord((int)flv, texture->height, texture->wrapT);
+    int y1 = swWrapCoord((int)flv + 1, texture->height, texture->wrapT);
+
+    unsigned int wx = (unsigned int)((fu - flu)*256.0f);
+    unsigned int wy = (unsigned int)((fv - flv)*256.0f);
+
+    unsigned int p00 = texture->pixels[(size_t)y0*texture->width + x0];
+    unsigned int p10 = texture->pixels[(size_t)y0*texture->width + x1];
+    unsigned int p01 = texture->pixels[(size_t)y1*texture->width + x0];
+    unsigned int p11 = texture->pixels[(size_t)y1*texture->width + x1];
+
+    // Bilinear filter with 8-bit fixed point weights, two channels at a time
+    unsigned int result = 0;
+
+    for (int shift = 0; shift < 16; shift += 8)
+    {
+        unsigned int a = (p00 >> shift) & 0x00ff00ff;
+        unsigned int b = (p10 >> shift) & 0x00ff00ff;
+        unsigned int c = (p01 >> shift) & 0x00ff00ff;
+        unsigned int d = (p11 >> shift) & 0x00ff00ff;
+
+        unsigned int top = ((a*(256 - wx) + b*wx) >> 8) & 0x00ff00ff;
+        unsigned int bottom = ((c*(256 - wx) + d*wx) >> 8) & 0x00ff00ff;
+        result |= (((top*(256 - wy) + bottom*wy) >> 8) & 0x00ff00ff) << shift;
+    }
+
+    return result;
+}
+
+// Compute blending factor for 4 pixels
+static inline void swBlendFactor(int factor, const swf4 *src, const swf4 *dst, swf4 *out)
+{
+    const swf4 one = swf4Set1(1.0f);
+
+    switch (factor)
+    {
+        case SW_ZERO: out[0] = out[1] = out[2] = out[3] = swf4Set1(0.0f); break;
+        case SW_ONE: out[0] = out[1] = out[2] = out[3] = one; break;
+        case SW_SRC_COLOR: for (int i = 0; i < 4; i++) out[i] = src[i]; break;
+        case SW_ONE_MINUS_SRC_COLOR: for (int i = 0; i < 4; i++) out[i] = swf4Sub(one, src[i]); break;
+        case SW_SRC_ALPHA: out[0] = out[1] = out[2] = out[3] = src[3]; break;
+        case SW_ONE_MINUS_SRC_ALPHA: out[0] = out[1] = out[2] = out[3] = swf4Sub(one, src[3]); break;
+        case SW_DST_ALPHA: out[0] = out[1] = out[2] = out[3] = dst[3]; break;
+        case SW_ONE_MINUS_DST_ALPHA: out[0] = out[1] = out[2] = out[3] = swf4Sub(one, dst[3]); break;
+        case SW_DST_COLOR: for (int i = 0; i < 4; i++) out[i] = dst[i]; break;
+        case SW_ONE_MINUS_DST_COLOR: for (int i = 0; i < 4; i++) out[i] = swf4Sub(one, dst[i]); break;
+        case SW_SRC_ALPHA_SATURATE:
+        {
+            out[0] = out[1] = out[2] = swf4Min(src[3], swf4Sub(one, dst[3]));
+            out[3] = one;
+        } break;
+        default: out[0] = out[1] = out[2] = out[3] = one; break;
+    }
+}
+
+// Shade and write a group of 4 horizontal pixels, mask defines covered pixels
+static inline void swShadeQuad(const swTriangle *tri, const swDrawState *state, const swTarget *target,
+                               int x, int y, int count, swf4 px, float py, swi4 mask)
+{
+    size_t offset = (size_t)y*target->width + x;
+
+    // Depth test
+    //----------------------------------------------------------------
+    swf4 z = swf4Add(swf4Mul(swf4Set1(tri->depth[0]), px), swf4Set1(tri->depth[1]*py + tri->depth[2]));
+    float *depthPtr = (target->depth != NULL)? (target->depth + offset) : NULL;
+    float depthTemp[4] = { 0 };
+
+    if ((depthPtr != NULL) && state->depthTest)
+    {
+        swf4 stored;
+        if (count == 4) stored = swf4Load(depthPtr);
+        else
+        {
+            for (int i = 0; i < count; i++) depthTemp[i] = depthPtr[i];
+            stored = swf4Load(depthTemp);
+        }
+
+        swi4 pass = mask;
+        switch (state->depthFunc)
+        {
+            case SW_NEVER: pass = swi4Set1(0); break;
+            case SW_LESS: pass = swf4CmpLt(z, stored); break;
+            case SW_EQUAL: pass = swf4CmpEq(z, stored); break;
+            case SW_LEQUAL: pass = swf4CmpLe(z, stored); break;
+            case SW_GREATER: pass = swf4CmpGt(z, stored); break;
+            case SW_NOTEQUAL: pass = swf4CmpNeq(z, stored); break;
+            case SW_GEQUAL: pass = swf4CmpGe(z, stored); break;
+            default: break;
+        }
+
+        mask = swi4And(mask, pass);
+        if (swi4MoveMask(mask) == 0) return;
+
+        if (state->depthWrite)
+        {
+            swf4 result = swf4Select(mask, z, stored);
+
+            if (count == 4) swf4Store(depthPtr, result);
+            else
+            {
+                swf4Store(depthTemp, result);
+                for (int i = 0; i < count; i++) depthPtr[i] = depthTemp[i];
+            }
+        }
+    }
+
+    if ((target->color == NULL) || (state->colorWriteMask == 0)) return;
+
+    // Attributes interpolation
+    //----------------------------------------------------------------
+    swf4 attribs[SW_ATTRIB_COUNT];
+    for (int i = 0; i < SW_ATTRIB_COUNT; i++)
+    {
+        attribs[i] = swf4Add(swf4Mul(swf4Set1(tri->attribs[i][0]), px), swf4Set1(tri->attribs[i][1]*py + tri->attribs[i][2]));
+    }
+
+    if (tri->perspective)
+    {
+        swf4 invw = swf4Add(swf4Mul(swf4Set1(tri->invw[0]), px), swf4Set1(tri->invw[1]*py + tri->invw[2]));
+        swf4 w = swf4Div(swf4Set1(1.0f), invw);
+        for (int i = 0; i < SW_ATTRIB_COUNT; i++) attribs[i] = swf4Mul(attribs[i], w);
+    }
+
+    swf4 src[4] = { attribs[2], attribs[3], attribs[4], attribs[5] };
+
+    // Texture sampling
+    //----------------------------------------------------------------
+    if (state->texture != NULL)
+    {
+        float u[4], v[4];
+        unsigned int texels[4] = { 0 };
+        int bits = swi4MoveMask(mask);
+
+        swf4Store(u, attribs[0]);
+        swf4Store(v, attribs[1]);
+
+        for (int i = 0; i < 4; i++) if (bits & (1 << i)) texels[i] = swSampleTexture(state->texture, u[i], v[i]);
+
+        swf4 tr, tg, tb, ta;
+        swUnpackRGBA(swi4Load(texels), &tr, &tg, &tb, &ta);
+
+        src[0] = swf4Mul(src[0], tr);
+        src[1] = swf4Mul(src[1], tg);
+        src[2] = swf4Mul(src[2], tb);
+        src[3] = swf4Mul(src[3], ta);
+    }
+
+    // Blending and write
+    //----------------------------------------------------------------
+    unsigned int *colorPtr = target->color + offset;
+    unsigned int colorTemp[4] = { 0 };
+    swi4 stored;
+
+    if (count == 4) stored = swi4Load(colorPtr);
+    else
+    {
+        for (int i = 0; i < count; i++) colorTemp[i] = colorPtr[i];
+        stored = swi4Load(colorTemp);
+    }
+
+    swf4 out[4] = { src[0], src[1], src[2], src[3] };
+
+    if (state->blend)
+    {
+        swf4 dst[4];
+        swUnpackRGBA(stored, &dst[0], &dst[1], &dst[2], &dst[3]);
+
+        if ((state->blendSrc == SW_SRC_ALPHA) && (state->blendDst == SW_ONE_MINUS_SRC_ALPHA) && (state->blendEquation == SW_FUNC_ADD))
+        {
+            // Most common case: out = dst + (src - dst)*srcAlpha
+            for (int i = 0; i < 4; i++) out[i] = swf4Add(dst[i], swf4Mul(swf4Sub(src[i], dst[i]), src[3]));
+        }
+        else
+        {
+            swf4 sf[4], df[4];
+            swBlendFactor(state->blendSrc, src, dst, sf);
+            swBlendFactor(state->blendDst, src, dst, df);
+
+            for (int i = 0; i < 4; i++)
+            {
+                swf4 s = swf4Mul(src[i], sf[i]);
+                swf4 d = swf4Mul(dst[i], df[i]);
+
+                switch (state->blendEquation)
+                {
+                    case SW_FUNC_SUBTRACT: out[i] = swf4Sub(s, d); break;
+                    case SW_FUNC_REVERSE_SUBTRACT: out[i] = swf4Sub(d, s); break;
+                    case SW_MIN: out[i] = swf4Min(src[i], dst[i]); break;
+                    case SW_MAX: out[i] = swf4Max(src[i], dst[i]); break;
+                    default: out[i] = swf4Add(s, d); break;
+                }
+            }
+        }
+    }
+
+    swi4 result = swPackRGBA(out[0], out[1], out[2], out[3]);
+    if (state->colorWriteMask != 0xffffffff) result = swi4Select(swi4Set1(state->colorWriteMask), result, stored);
+    result = swi4Select(mask, result, stored);
+
+    if (count == 4) swi4Store(colorPtr, result);
+    else
+    {
+        swi4Store(colorTemp, result);
+        for (int i = 0; i < count; i++) colorPtr[i] = colorTemp[i];
+    }
+}
+
+// Rasterize triangle region overlapping a tile
+static void swRasterTriangle(const swTriangle *tri, const swDrawState *state, const swTarget *target, int tileX0, int tileY0, int tileX1, int tileY1)
+{
+    int x0 = RLSW_MAX(tri->xmin, tileX0);
+    int x1 = RLSW_MIN(tri->xmax, tileX1);
+    int y0 = RLSW_MAX(tri->ymin, tileY0);
+    int y1 = RLSW_MIN(tri->ymax, tileY1);
+
+    if ((x0 >= x1) || (y0 >= y1)) return;
+
+    const swf4 zero = swf4Set1(0.0f);
+    const swf4 laneIndex = swf4Set(0.0f, 1.0f, 2.0f, 3.0f);
+    const swf4 laneCenter = swf4Set(0.5f, 1.5f, 2.5f, 3.5f);
+    const swf4 edgeA[3] = { swf4Set1(tri->edgeA[0]), swf4Set1(tri->edgeA[1]), swf4Set1(tri->edgeA[2]) };
+
+    for (int y = y0; y < y1; y++)
+    {
+        float py = (float)y + 0.5f;
+        float rowE[3];
+        for (int e = 0; e < 3; e++) rowE[e] = tri->edgeB[e]*py + tri->edgeC[e];
+
+        // Row span from edge equations (conservative, exact test is done per pixel)
+        float spanX0 = (float)x0, spanX1 = (float)x1;
+        for (int e = 0; e < 3; e++)
+        {
+            float a = tri->edgeA[e];
+
+            if (a > 0.0f) spanX0 = RLSW_MAX(spanX0, -rowE[e]/a - 1.0f);
+            else if (a < 0.0f) spanX1 = RLSW_MIN(spanX1, -rowE[e]/a + 1.0f);
+            else if (rowE[e] < 0.0f) spanX1 = spanX0;
+        }
+
+        if (spanX0 >= spanX1) continue;
+
+        int sx0 = RLSW_MAX(x0, (int)spanX0);
+        int sx1 = RLSW_MIN(x1, (int)spanX1 + 1);
+
+        for (int x = sx0; x < sx1; x += 4)
+        {
+            swf4 px = swf4Add(swf4Set1((float)x), laneCenter);
+            swi4 mask = swi4Set1(0xffffffff);
+
+            for (int e = 0; e < 3; e++)
+            {
+                swf4 value = swf4Add(swf4Mul(edgeA[e], px), swf4Set1(rowE[e]));
+                mask = swi4And(mask, tri->edgeInclusive[e]? swf4CmpGe(value, zero) : swf4CmpGt(value, zero));
+            }
+
+            int count = RLSW_MIN(4, sx1 - x);
+            if (count < 4) mask = swi4And(mask, swf4CmpLt(laneIndex, swf4Set1((float)count)));
+
+            if (swi4MoveMask(mask) != 0) swShadeQuad(tri, state, target, x, y, count, px, py, mask);
+        }
+    }
+}
+
+// Rasterize all triangles binned in a tile, in submission order
+static void swRasterTileJob(int index, void *userData)
+{
+    (void)userData;
+
+    int tile = RLSW.activeTiles[index];
+    const swTileBin *bin = &RLSW.bins[tile];
+
+    int tileX0 = (tile%RLSW.tilesX)*RLSW_TILE_SIZE;
+    int tileY0 = (tile/RLSW.tilesX)*RLSW_TILE_SIZE;
+    int tileX1 = RLSW_MIN(tileX0 + RLSW_TILE_SIZE, RLSW.target.width);
+    int tileY1 = RLSW_MIN(tileY0 + RLSW_TILE_SIZE, RLSW.target.height);
+
+    for (int i = 0; i < bin->count; i++)
+    {
+        const swTriangle *tri = &RLSW.triangles[bin->triangles[i]];
+        swRasterTriangle(tri, &RLSW.states[tri->state], &RLSW.target, tileX0, tileY0, tileX1, tileY1);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition - Pixel formats conversion
+//----------------------------------------------------------------------------------
+// Get size in bytes of one pixel for provided format and type
+static int swGetPixelSize(int format, int type)
+{
+    int components = 4;
+
+    switch (format)
+    {
+        case SW_ALPHA:
+        case SW_LUMINANCE:
+        case SW_DEPTH_COMPONENT: components = 1; break;
+        case SW_LUMINANCE_ALPHA: components = 2; break;
+        case SW_RGB: components = 3; break;
+        default: break;
+    }
+
+    switch (type)
+    {
+        case SW_UNSIGNED_SHORT_5_6_5:
+        case SW_UNSIGNED_SHORT_5_5_5_1:
+        case SW_UNSIGNED_SHORT_4_4_4_4: return 2;
+        case SW_UNSIGNED_SHORT: return components*2;
+        case SW_UNSIGNED_INT:
+        case SW_FLOAT: return components*4;
+        default: return components;
+    }
+}
+
+// Convert pixels from provided format and type to RGBA8
+static void swConvertToRGBA(const void *src, int format, int type, int count, unsigned int *dst)
+{
+    const unsigned char *bytes = (const unsigned char *)src;
+    const unsigned short *shorts = (const unsigned short *)src;
+    const float *floats = (const float *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int r = 0, g = 0, b = 0, a = 255;
+
+        if (type == SW_UNSIGNED_SHORT_5_6_5)
+        {
+            unsigned short value = shorts[i];
+            r = (((value >> 11) & 0x1f)*255 + 15)/31;
+            g = (((value >> 5) & 0x3f)*255 + 31)/63;
+            b = ((value & 0x1f)*255 + 15)/31;
+        }
+        else if (type == SW_UNSIGNED_SHORT_5_5_5_1)
+        {
+            unsigned short value = shorts[i];
+            r = (((value >> 11) & 0x1f)*255 + 15)/31;
+            g = (((value >> 6) & 0x1f)*255 + 15)/31;
+            b = (((value >> 1) & 0x1f)*255 + 15)/31;
+            a = (value & 0x1)? 255 : 0;
+        }
+        else if (type == SW_UNSIGNED_SHORT_4_4_4_4)
+        {
+            unsigned short value = shorts[i];
+            r = ((value >> 12) & 0xf)*17;
+            g = ((value >> 8) & 0xf)*17;
+            b = ((value >> 4) & 0xf)*17;
+            a = (value & 0xf)*17;
+        }
+        else
+        {
+            float c[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+            int components = (type == SW_FLOAT)? swGetPixelSize(format, type)/4 : swGetPixelSize(format, type);
+
+            for (int k = 0; k < components; k++)
+            {
+                c[k] = (type == SW_FLOAT)? RLSW_CLAMP(floats[i*components + k], 0.0f, 1.0f) : (float)bytes[i*components + k]/255.0f;
+            }
+
+            switch (format)
+            {
+                case SW_ALPHA: c[3] = c[0]; c[0] = c[1] = c[2] = 0.0f; break;
+                case SW_LUMINANCE: c[1] = c[2] = c[0]; break;
+                case SW_LUMINANCE_ALPHA: c[3] = c[1]; c[1] = c[2] = c[0]; break;
+                default: break;
+            }
+
+            r = (unsigned int)(c[0]*255.0f + 0.5f);
+            g = (unsigned int)(c[1]*255.0f + 0.5f);
+            b = (unsigned int)(c[2]*255.0f + 0.5f);
+            a = (unsigned int)(c[3]*255.0f + 0.5f);
+        }
+
+        dst[i] = r | (g << 8) | (b << 16) | (a << 24);
+    }
+}
+
+// Convert RGBA8 pixels to provided format and type
+static void swConvertFromRGBA(const unsigned int *src, int count, int format, int type, void *dst)
+{
+    unsigned char *bytes = (unsigned char *)dst;
+    unsigned short *shorts = (unsigned short *)dst;
+    float *floats = (float *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int r = src[i] & 0xff;
+        unsigned int g = (src[i] >> 8) & 0xff;
+        unsigned int b = (src[i] >> 16) & 0xff;
+        unsigned int a = src[i] >> 24;
+
+        if (type == SW_UNSIGNED_SHORT_5_6_5) shorts[i] = (unsigned short)(((r*31 + 127)/255 << 11) | ((g*63 + 127)/255 << 5) | ((b*31 + 127)/255));
+        else if (type == SW_UNSIGNED_SHORT_5_5_5_1) shorts[i] = (unsigned short)(((r*31 + 127)/255 << 11) | ((g*31 + 127)/255 << 6) | ((b*31 + 127)/255 << 1) | ((a > 127)? 1 : 0));
+        else if (type == SW_UNSIGNED_SHORT_4_4_4_4) shorts[i] = (unsigned short)(((r*15 + 127)/255 << 12) | ((g*15 + 127)/255 << 8) | ((b*15 + 127)/255 << 4) | ((a*15 + 127)/255));
+        else
+        {
+            unsigned int c[4] = { r, g, b, a };
+            int components = 4;
+
+            switch (format)
+            {
+                case SW_ALPHA: c[0] = a; components = 1; break;
+                case SW_LUMINANCE: c[0] = (r*77 + g*150 + b*29 + 128) >> 8; components = 1; break;
+                case SW_LUMINANCE_ALPHA: c[0] = (r*77 + g*150 + b*29 + 128) >> 8; c[1] = a; components = 2; break;
+                case SW_RGB: components = 3; break;
+                default: break;
+            }
+
+            for (int k = 0; k < components; k++)
+            {
+                if (type == SW_FLOAT) floats[i*components + k] = (float)c[k]/255.0f;
+                else bytes[i*components + k] = (unsigned char)c[k];
+            }
+        }
+    }
+}
+
+#endif  // RLSW_IMPLEMENTATION
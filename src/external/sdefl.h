@@ -167,6 +167,7 @@ struct sdefl {
 extern int sdefl_bound(int in_len);
 extern int sdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
+extern int sdeflate_part(struct sdefl *s, void *o, const void *i, int n, int lvl, int is_last);
 
 #ifdef __cplusplus
 }
@@ -661,7 +662,7 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
 }
 static int
 sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+            int in_len, int lvl, int is_last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
@@ -718,8 +719,17 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
+    sdefl_flush(&q, s, is_last && blk_end == in_len, in, blk_begin, blk_end);
   } while (i < in_len);
+  if (!is_last) {
+    /* empty stored block: stream ends byte aligned and can be continued */
+    sdefl_put(&q, s, 0x00, 3);
+    if (s->bitcnt) {
+      sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+    }
+    sdefl_put16(&q, 0x0000);
+    sdefl_put16(&q, 0xFFFF);
+  }
   if (s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
@@ -729,7 +739,14 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
-  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl, 1);
+}
+extern int
+sdeflate_part(struct sdefl *s, void *out, const void *in, int n, int lvl, int is_last) {
+  /* independent part of a deflate stream, parts can be compressed in parallel
+     and concatenated, only last part terminates the stream */
+  s->bits = s->bitcnt = 0;
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl, is_last);
 }
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -771,7 +788,7 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
   sdefl_put(&q, s, 0x78, 8); /* deflate, 32k window */
   sdefl_put(&q, s, 0x01, 8); /* fast compression */
-  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl);
+  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl, 1);
 
   /* append adler checksum */
   a = sdefl_adler32(SDEFL_ADLER_INIT, (const unsigned char*)in, n);
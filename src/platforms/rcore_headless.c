@@ -0,0 +1,796 @@
+/**********************************************************************************************
+*
+*   rcore_headless - Functions to manage an offscreen graphics device, no window and no inputs
+*
+*   PLATFORM: HEADLESS
+*       - Linux (EGL device: Mesa llvmpipe/softpipe, GPU drivers with EGL_MESA_platform_surfaceless)
+*       - Any platform when compiled with GRAPHICS_API_SOFTWARE (rlsw, no EGL required)
+*
+*   LIMITATIONS:
+*       - No window: screen is an offscreen framebuffer of InitWindow() requested size
+*       - No input devices: keyboard/mouse/gamepad/touch states are never updated
+*       - No vsync: EndDrawing() returns as soon as the frame has been submitted
+*       - No monitors: monitor queries return the offscreen framebuffer size
+*
+*   POSSIBLE IMPROVEMENTS:
+*       - Select a specific GPU with EGL_EXT_device_enumeration + EGL_EXT_platform_device
+*       - Injected input events for automated testing
+*
+*   ADDITIONAL NOTES:
+*       - TRACELOG() function is located in raylib [utils] module
+*       - Default framebuffer is an EGL pbuffer surface, if pbuffers are not supported by the
+*         EGL config, context is created surfaceless (EGL_KHR_surfaceless_context) and default
+*         framebuffer is a framebuffer object of screen size (resized by SetWindowSize())
+*       - Useful to run raylib programs on servers/CI: LIBGL_ALWAYS_SOFTWARE=1 forces Mesa
+*         software driver when no GPU is available
+*
+*   CONFIGURATION:
+*       #define GRAPHICS_API_SOFTWARE
+*           Use rlsw software renderer, EGL is not used and color buffer lives in system memory
+*
+*   DEPENDENCIES:
+*       - EGL: Offscreen context creation (not required with GRAPHICS_API_SOFTWARE)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2024 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: glad embeds its own khrplatform.h (already included by rlgl) without KHRONOS_APIENTRY
+    #if !defined(KHRONOS_APIENTRY)
+        #define KHRONOS_APIENTRY
+    #endif
+
+    #include "EGL/egl.h"        // Native platform windowing system interface
+    #include "EGL/eglext.h"     // EGL extensions
+
+    #ifndef EGL_OPENGL_ES3_BIT
+        #define EGL_OPENGL_ES3_BIT  0x40
+    #endif
+    #ifndef EGL_PLATFORM_SURFACELESS_MESA
+        #define EGL_PLATFORM_SURFACELESS_MESA   0x31DD
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // Display data
+    EGLDisplay device;                  // Native display device (surfaceless or default)
+    EGLSurface surface;                 // Offscreen pbuffer surface (default framebuffer)
+    EGLContext context;                 // Graphic context, mode in which drawing can be done
+    EGLConfig config;                   // Graphic config
+    unsigned int framebuffer;           // Default framebuffer object (surfaceless context only)
+    unsigned int framebufferTexture;    // Default framebuffer color texture (surfaceless context only)
+#else
+    void *colorBuffer;                  // Software renderer color buffer (main framebuffer)
+#endif
+} PlatformData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern CoreData CORE;                   // Global CORE state context
+
+static PlatformData platform = { 0 };   // Platform specific data
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);        // Close platform
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+static EGLSurface CreateOffscreenSurface(int width, int height);    // Create pbuffer surface of required size
+static bool LoadOffscreenFramebuffer(int width, int height);        // Load framebuffer object of required size as default framebuffer
+static void UnloadOffscreenFramebuffer(void);                       // Unload default framebuffer object
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+// NOTE: There is no window to close, it only returns true after CloseWindow()
+bool WindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+// Toggle fullscreen mode
+void ToggleFullscreen(void)
+{
+    TRACELOG(LOG_WARNING, "ToggleFullscreen() not available on target platform");
+}
+
+// Toggle borderless windowed mode
+void ToggleBorderlessWindowed(void)
+{
+    TRACELOG(LOG_WARNING, "ToggleBorderlessWindowed() not available on target platform");
+}
+
+// Set window state: maximized, if resizable
+void MaximizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "MaximizeWindow() not available on target platform");
+}
+
+// Set window state: minimized
+void MinimizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "MinimizeWindow() not available on target platform");
+}
+
+// Set window state: not minimized/maximized
+void RestoreWindow(void)
+{
+    TRACELOG(LOG_WARNING, "RestoreWindow() not available on target platform");
+}
+
+// Set window configuration state using flags
+void SetWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "SetWindowState() not available on target platform");
+}
+
+// Clear window configuration state flags
+void ClearWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "ClearWindowState() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcon(Image image)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcons(Image *images, int count)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void SetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void SetWindowPosition(int x, int y)
+{
+    TRACELOG(LOG_WARNING, "SetWindowPosition() not available on target platform");
+}
+
+// Set monitor for the current window
+void SetWindowMonitor(int monitor)
+{
+    TRACELOG(LOG_WARNING, "SetWindowMonitor() not available on target platform");
+}
+
+// Set window minimum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+// NOTE: Offscreen framebuffer is recreated with the new size
+void SetWindowSize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    swResize(width, height);
+#else
+    if (platform.surface != EGL_NO_SURFACE)
+    {
+        EGLSurface surface = CreateOffscreenSurface(width, height);
+
+        if (surface == EGL_NO_SURFACE)
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Failed to resize offscreen framebuffer to %i x %i", width, height);
+            return;
+        }
+
+        eglMakeCurrent(platform.device, surface, surface, platform.context);
+        eglDestroySurface(platform.device, platform.surface);
+        platform.surface = surface;
+    }
+    else
+    {
+        // Surfaceless context: default framebuffer object is recreated, previous one kept on failure
+        unsigned int framebuffer = platform.framebuffer;
+        unsigned int framebufferTexture = platform.framebufferTexture;
+
+        if (!LoadOffscreenFramebuffer(width, height))
+        {
+            TRACELOG(LOG_WARNING, "DISPLAY: Failed to resize offscreen framebuffer to %i x %i", width, height);
+            return;
+        }
+
+        rlUnloadFramebuffer(framebuffer);
+        rlUnloadTexture(framebufferTexture);
+    }
+
+    rlSetFramebufferWidth(width);
+    rlSetFramebufferHeight(height);
+#endif
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.display.width = width;
+    CORE.Window.display.height = height;
+
+    // Reset viewport and projection matrix for new size
+    SetupViewport(width, height);
+
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void SetWindowOpacity(float opacity)
+{
+    TRACELOG(LOG_WARNING, "SetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void SetWindowFocused(void)
+{
+    TRACELOG(LOG_WARNING, "SetWindowFocused() not available on target platform");
+}
+
+// Get native window handle
+// NOTE: There is no native window, EGL context is returned instead (if available),
+// software renderer returns its color buffer (RGBA8, rows bottom-up)
+void *GetWindowHandle(void)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    platform.colorBuffer = (void *)swGetColorBuffer(NULL, NULL);
+    return platform.colorBuffer;
+#else
+    return (void *)platform.context;
+#endif
+}
+
+// Get number of monitors
+int GetMonitorCount(void)
+{
+    return 1;
+}
+
+// Get number of monitors
+int GetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+Vector2 GetMonitorPosition(int monitor)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+// NOTE: Virtual monitor matches the offscreen framebuffer
+int GetMonitorWidth(int monitor)
+{
+    return CORE.Window.display.width;
+}
+
+// Get selected monitor height (currently used by monitor)
+int GetMonitorHeight(int monitor)
+{
+    return CORE.Window.display.height;
+}
+
+// Get selected monitor physical width in millimetres
+int GetMonitorPhysicalWidth(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalWidth() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int GetMonitorPhysicalHeight(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalHeight() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor refresh rate
+// NOTE: No vertical sync available, frames are presented as fast as possible
+int GetMonitorRefreshRate(int monitor)
+{
+    return 0;
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *GetMonitorName(int monitor)
+{
+    return "Headless";
+}
+
+// Get window position XY on monitor
+Vector2 GetWindowPosition(void)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get window scale DPI factor for current monitor
+Vector2 GetWindowScaleDPI(void)
+{
+    return (Vector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+void SetClipboardText(const char *text)
+{
+    TRACELOG(LOG_WARNING, "SetClipboardText() not implemented on target platform");
+}
+
+// Get clipboard text content
+const char *GetClipboardText(void)
+{
+    TRACELOG(LOG_WARNING, "GetClipboardText() not implemented on target platform");
+    return NULL;
+}
+
+// Show mouse cursor
+void ShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void HideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void EnableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Disables cursor (lock cursor)
+void DisableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: Nothing is presented, it just makes sure frame commands have been submitted
+void SwapScreenBuffer(void)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    swFinish();
+#else
+    // NOTE: eglSwapBuffers() has no effect on pbuffer surfaces other than flushing the context
+    if (platform.surface != EGL_NO_SURFACE) eglSwapBuffers(platform.device, platform.surface);
+    else glFlush();
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+double GetTime(void)
+{
+    double time = 0.0;
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+
+    return time;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: No system browser is expected to be available on headless systems
+void OpenURL(const char *url)
+{
+    TRACELOG(LOG_WARNING, "OpenURL() not available on target platform");
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int SetGamepadMappings(const char *mappings)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadMappings() not implemented on target platform");
+    return 0;
+}
+
+// Set mouse position XY
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void SetMouseCursor(int cursor)
+{
+    CORE.Input.Mouse.cursor = cursor;
+}
+
+// Get physical key name.
+const char *GetKeyName(int key)
+{
+    return "";
+}
+
+// Register all input events
+// NOTE: No input devices available, only previous frame states are registered,
+// so states set programmatically are correctly reported as pressed/released
+void PollInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0; // GAMEPAD_BUTTON_UNKNOWN
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+    // NOTE: There is no display, virtual display matches requested screen size
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Offscreen framebuffer size not provided, using default: 800 x 450");
+        CORE.Window.screen.width = 800;
+        CORE.Window.screen.height = 450;
+    }
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    if (CORE.Window.flags & FLAG_VSYNC_HINT) TRACELOG(LOG_INFO, "DISPLAY: VSYNC not available on headless platform");
+    CORE.Window.flags &= ~FLAG_VSYNC_HINT;
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // Initialize graphic device: offscreen EGL context
+    //----------------------------------------------------------------------------
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+    }
+
+    EGLint renderableType = EGL_OPENGL_BIT;
+    EGLenum api = EGL_OPENGL_API;
+    if (rlGetVersion() == RL_OPENGL_ES_20) { renderableType = EGL_OPENGL_ES2_BIT; api = EGL_OPENGL_ES_API; }
+    else if (rlGetVersion() == RL_OPENGL_ES_30) { renderableType = EGL_OPENGL_ES3_BIT; api = EGL_OPENGL_ES_API; }
+
+    EGLint framebufferAttribs[] =
+    {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,  // Offscreen pbuffer surface (default framebuffer)
+        EGL_RENDERABLE_TYPE, renderableType,    // Type of context support
+        EGL_RED_SIZE, 8,            // RED color bit depth
+        EGL_GREEN_SIZE, 8,          // GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // ALPHA bit depth (required for screenshots with transparency)
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size (Required to use Depth testing!)
+        EGL_SAMPLE_BUFFERS, sampleBuffer,    // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated
+        EGL_NONE
+    };
+
+    // Context attributes: desktop OpenGL versions use EGL_KHR_create_context attributes
+    EGLint contextAttribs[8] = { EGL_NONE };
+    if (rlGetVersion() == RL_OPENGL_33)
+    {
+        EGLint attribs[] = { EGL_CONTEXT_MAJOR_VERSION_KHR, 3, EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR, EGL_NONE };
+        memcpy(contextAttribs, attribs, sizeof(attribs));
+    }
+    else if (rlGetVersion() == RL_OPENGL_43)
+    {
+        EGLint attribs[] = { EGL_CONTEXT_MAJOR_VERSION_KHR, 4, EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR, EGL_NONE };
+        memcpy(contextAttribs, attribs, sizeof(attribs));
+    }
+    else if (rlGetVersion() == RL_OPENGL_ES_20)
+    {
+        EGLint attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+        memcpy(contextAttribs, attribs, sizeof(attribs));
+    }
+    else if (rlGetVersion() == RL_OPENGL_ES_30)
+    {
+        EGLint attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE };
+        memcpy(contextAttribs, attribs, sizeof(attribs));
+    }
+
+    // Get an EGL device connection, surfaceless platform does not require any display server
+    platform.device = EGL_NO_DISPLAY;
+    const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if ((clientExtensions != NULL) && (strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL))
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (eglGetPlatformDisplayEXT != NULL) platform.device = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+
+    if (platform.device == EGL_NO_DISPLAY) platform.device = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (platform.device == EGL_NO_DISPLAY)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return -1;
+    }
+
+    // Initialize the EGL device connection
+    if (eglInitialize(platform.device, NULL, NULL) == EGL_FALSE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL device");
+        return -1;
+    }
+
+    // Get an appropriate EGL framebuffer configuration, try without pbuffer support if not available
+    EGLint numConfigs = 0;
+    eglChooseConfig(platform.device, framebufferAttribs, &platform.config, 1, &numConfigs);
+    if (numConfigs == 0)
+    {
+        framebufferAttribs[1] = 0;      // EGL_SURFACE_TYPE: Any
+        eglChooseConfig(platform.device, framebufferAttribs, &platform.config, 1, &numConfigs);
+    }
+
+    if (numConfigs == 0)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose an EGL config");
+        return -1;
+    }
+
+    // Set rendering API
+    eglBindAPI(api);
+
+    // Create an EGL rendering context
+    platform.context = eglCreateContext(platform.device, platform.config, EGL_NO_CONTEXT, contextAttribs);
+    if (platform.context == EGL_NO_CONTEXT)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL context");
+        return -1;
+    }
+
+    // Create an EGL offscreen surface, default framebuffer
+    // NOTE: If pbuffers are not supported, context is surfaceless and a framebuffer object is used instead
+    platform.surface = CreateOffscreenSurface(CORE.Window.screen.width, CORE.Window.screen.height);
+    if (platform.surface == EGL_NO_SURFACE) TRACELOG(LOG_INFO, "DISPLAY: Pbuffer surface not available, using surfaceless context with framebuffer object");
+
+    EGLBoolean result = eglMakeCurrent(platform.device, platform.surface, platform.surface, platform.context);
+    if (result == EGL_FALSE)
+    {
+        TRACELOG(LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
+        return -1;
+    }
+
+    // No vertical sync: frames are not presented so there is nothing to wait for
+    eglSwapInterval(platform.device, 0);
+
+    TRACELOG(LOG_INFO, "DISPLAY: EGL %s (%s)", eglQueryString(platform.device, EGL_VERSION), eglQueryString(platform.device, EGL_VENDOR));
+    //----------------------------------------------------------------------------
+#endif
+
+    CORE.Window.ready = true;
+
+    // Manage render size vs screen size, offscreen framebuffer matches screen size
+    // NOTE: This function use and modify global module variables:
+    //  -> CORE.Window.screen.width/CORE.Window.screen.height
+    //  -> CORE.Window.render.width/CORE.Window.render.height
+    //  -> CORE.Window.screenScale
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    // If everything work as expected, we can continue
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully (offscreen)");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // Load OpenGL extensions
+    // NOTE: GL procedures address loader is required to load extensions
+    //----------------------------------------------------------------------------
+    rlLoadExtensions(eglGetProcAddress);
+    //----------------------------------------------------------------------------
+
+    // Surfaceless context requires a framebuffer object as default framebuffer (screen)
+    if ((platform.surface == EGL_NO_SURFACE) && !LoadOffscreenFramebuffer(CORE.Window.screen.width, CORE.Window.screen.height))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create offscreen framebuffer, no drawing target available");
+        ClosePlatform();
+        return -1;
+    }
+#endif
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = GetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    TRACELOG(LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully");
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+#if !defined(GRAPHICS_API_SOFTWARE)
+    // Close surface, context and display
+    if (platform.device != EGL_NO_DISPLAY)
+    {
+        UnloadOffscreenFramebuffer();
+
+        eglMakeCurrent(platform.device, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (platform.surface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(platform.device, platform.surface);
+            platform.surface = EGL_NO_SURFACE;
+        }
+
+        if (platform.context != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(platform.device, platform.context);
+            platform.context = EGL_NO_CONTEXT;
+        }
+
+        eglTerminate(platform.device);
+        platform.device = EGL_NO_DISPLAY;
+    }
+#endif
+
+    CORE.Window.ready = false;
+}
+
+#if !defined(GRAPHICS_API_SOFTWARE)
+// Create offscreen pbuffer surface of required size
+// NOTE: Returns EGL_NO_SURFACE if selected config does not support pbuffers
+static EGLSurface CreateOffscreenSurface(int width, int height)
+{
+    EGLint surfaceType = 0;
+    eglGetConfigAttrib(platform.device, platform.config, EGL_SURFACE_TYPE, &surfaceType);
+    if ((surfaceType & EGL_PBUFFER_BIT) == 0) return EGL_NO_SURFACE;
+
+    const EGLint surfaceAttribs[] =
+    {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+
+    return eglCreatePbufferSurface(platform.device, platform.config, surfaceAttribs);
+}
+
+// Load framebuffer object of required size (color texture and depth renderbuffer) as default framebuffer
+// NOTE: Returns false if framebuffer could not be completed, no framebuffer is loaded then
+static bool LoadOffscreenFramebuffer(int width, int height)
+{
+    unsigned int framebuffer = rlLoadFramebuffer();
+    unsigned int framebufferTexture = rlLoadTexture(NULL, width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    unsigned int depthRenderbuffer = rlLoadTextureDepth(width, height, true);
+
+    rlFramebufferAttach(framebuffer, framebufferTexture, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(framebuffer, depthRenderbuffer, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+    if ((framebuffer == 0) || (framebufferTexture == 0) || !rlFramebufferComplete(framebuffer))
+    {
+        if (framebuffer != 0) rlUnloadFramebuffer(framebuffer);
+        rlUnloadTexture(framebufferTexture);
+        return false;
+    }
+
+    platform.framebuffer = framebuffer;
+    platform.framebufferTexture = framebufferTexture;
+    rlSetFramebufferDefault(framebuffer);
+
+    TRACELOG(LOG_INFO, "DISPLAY: [ID %i] Offscreen framebuffer object loaded successfully (%i x %i)", framebuffer, width, height);
+
+    return true;
+}
+
+// Unload default framebuffer object, window framebuffer (none) is restored as default
+static void UnloadOffscreenFramebuffer(void)
+{
+    if (platform.framebuffer == 0) return;
+
+    rlSetFramebufferDefault(0);
+    rlUnloadFramebuffer(platform.framebuffer);
+    rlUnloadTexture(platform.framebufferTexture);
+
+    platform.framebuffer = 0;
+    platform.framebufferTexture = 0;
+}
+#endif
+
+// EOF
@@ -393,6 +393,15 @@ typedef struct AudioData {
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
+#if !defined(RAUDIO_STANDALONE)
+// Async sound load request data, wave is loaded by a worker thread
+typedef struct AsyncSoundLoad {
+    char *fileName;                 // Sound file name (stored after request data)
+    Wave wave;                      // Loaded wave
+    Sound *dstSound;                // Destination sound
+} AsyncSoundLoad;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -422,6 +431,12 @@ static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+#if !defined(RAUDIO_STANDALONE)
+static void LoadAsyncSound(void *userData);     // Load wave file (async load step, worker thread)
+static void FinishAsyncSound(void *userData);   // Load sound from loaded wave (async finish step, main thread)
+static void ReleaseAsyncSound(void *userData);  // Free loaded wave of cancelled load (async release step, main thread)
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -919,6 +934,24 @@ Sound LoadSound(const char *fileName)
     return sound;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load sound from file asynchronously, wave loading and decoding runs on a worker thread
+// NOTE: Sound is set by UpdateAsyncLoads() when load finishes, destination must remain valid until then
+unsigned int LoadSoundAsync(const char *fileName, Sound *sound)
+{
+    if ((fileName == NULL) || (sound == NULL)) return 0;
+
+    int length = (int)strlen(fileName);
+    AsyncSoundLoad *request = (AsyncSoundLoad *)RL_CALLOC(1, sizeof(AsyncSoundLoad) + length + 1);
+
+    request->fileName = (char *)(request + 1);
+    memcpy(request->fileName, fileName, length);
+    request->dstSound = sound;
+
+    return LoadAsync(LoadAsyncSound, FinishAsyncSound, ReleaseAsyncSound, request);
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
@@ -2700,6 +2733,39 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load wave file (async load step, worker thread)
+static void LoadAsyncSound(void *userData)
+{
+    AsyncSoundLoad *request = (AsyncSoundLoad *)userData;
+
+    request->wave = LoadWave(request->fileName);
+}
+
+// Load sound from loaded wave (async finish step, main thread)
+// NOTE: Audio buffer creation and format conversion require the audio device
+static void FinishAsyncSound(void *userData)
+{
+    AsyncSoundLoad *request = (AsyncSoundLoad *)userData;
+
+    *request->dstSound = (Sound){ 0 };
+
+    if (request->wave.data != NULL) *request->dstSound = LoadSoundFromWave(request->wave);
+    UnloadWave(request->wave);
+
+    RL_FREE(request);
+}
+
+// Free loaded wave of cancelled load (async release step, main thread)
+static void ReleaseAsyncSound(void *userData)
+{
+    AsyncSoundLoad *request = (AsyncSoundLoad *)userData;
+
+    UnloadWave(request->wave);
+    RL_FREE(request);
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -268,6 +268,52 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// MappedImage, raw image data accessed through file memory mapping
+typedef struct MappedImage {
+    void *data;             // Image raw data (mapped file memory)
+    int width;              // Image base width
+    int height;             // Image base height
+    int format;             // Data format (PixelFormat type)
+    int headerSize;         // File header size (bytes before image data)
+    bool writable;          // Image data can be updated (changes written to file)
+    void *handle;           // Platform file mapping handle
+} MappedImage;
+
+// ImageAdjustments, color adjustments chain applied by ImageAdjust()
+// NOTE: Zero initialized fields keep colors unchanged, adjustments are applied in fields order
+typedef struct ImageAdjustments {
+    Color tint;             // Color tint (WHITE or BLANK: no tint)
+    int brightness;         // Brightness offset (-255 to 255)
+    float contrast;         // Contrast (-100 to 100)
+    float gamma;            // Gamma correction, out = in^(1/gamma) (0.0f or 1.0f: no change)
+    float hue;              // Hue shift in degrees
+    float saturation;       // Saturation change, saturation scaled by (1.0f + saturation)
+    float value;            // Value change, HSV value scaled by (1.0f + value)
+    bool invert;            // Invert colors
+    bool grayscale;         // Convert colors to grayscale (image format is kept)
+} ImageAdjustments;
+
+// AnimatedImage, animated image frames decoded on demand into a single frame image
+typedef struct AnimatedImage {
+    Image frame;            // Current frame image (RGBA8), updated in place by UpdateAnimatedImageFrame()
+    int frameCount;         // Frames count
+    int currentFrame;       // Current frame index
+    int *delays;            // Frames delay (milliseconds)
+    int *disposals;         // Frames disposal mode (0: not specified, 1: keep, 2: restore background, 3: restore previous)
+    void *data;             // Animated image decoder internal data
+} AnimatedImage;
+
+// ImageComparison, image against reference image comparison results
+typedef struct ImageComparison {
+    float maxError;         // Maximum channel absolute difference (normalized)
+    float meanError;        // Mean channel absolute difference (normalized)
+    float mse;              // Mean squared error (normalized)
+    float psnr;             // Peak signal-to-noise ratio (dB), INFINITY for identical images
+    float ssim;             // Structural similarity (luminance, 8x8 windows), 1.0f for identical images
+    int diffPixels;         // Pixels with any channel difference over tolerance
+    bool passed;            // Images match within tolerance (no pixels over tolerance)
+} ImageComparison;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -283,6 +329,16 @@ typedef Texture Texture2D;
 // TextureCubemap, same as Texture
 typedef Texture TextureCubemap;
 
+// VirtualTexture, huge texture streamed by tiles from a tiled mip pyramid file
+typedef struct VirtualTexture {
+    int width;              // Virtual texture width (base level)
+    int height;             // Virtual texture height (base level)
+    int tileSize;           // Tiles size (without borders)
+    int levels;             // Mip levels stored in tiles file
+    Texture2D cache;        // Physical tiles cache texture
+    void *data;             // Virtual texture internal data (tiles file, page table, cache state)
+} VirtualTexture;
+
 // RenderTexture, fbo for texture rendering
 typedef struct RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -320,6 +376,7 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int *glyphLookup;       // Glyphs index lookup table by codepoint (NULL for glyphs scan)
 } Font;
 
 // Camera, defines position/orientation in 3d space
@@ -943,6 +1000,42 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Async load state
+typedef enum {
+    ASYNC_LOAD_DONE = 0,            // Load finished (or unknown request), loaded data must be checked for validity
+    ASYNC_LOAD_QUEUED,              // Load waiting for a worker thread
+    ASYNC_LOAD_LOADING,             // Load running on a worker thread (file loading, CPU decoding)
+    ASYNC_LOAD_FINISHING            // Load waiting for main thread finish step (GPU upload), see UpdateAsyncLoads()
+} AsyncLoadState;
+
+// PNG export rows filter mode
+typedef enum {
+    PNG_FILTER_NONE = 0,            // No rows filtering (fastest, bigger files)
+    PNG_FILTER_FAST,                // Best of Sub and Up filters for every row
+    PNG_FILTER_FULL                 // Best of all filters for every row (default, smaller files)
+} PngFilterMode;
+
+// Image resize filter
+typedef enum {
+    RESIZE_FILTER_NEAREST = 0,      // Nearest-neighbor scaling (any uncompressed format, pixels copied as is)
+    RESIZE_FILTER_BILINEAR,         // Bilinear scaling
+    RESIZE_FILTER_BOX,              // Box filter scaling, source pixels averaged (downscaling)
+    RESIZE_FILTER_BICUBIC           // Bicubic scaling (same as ImageResize())
+} ResizeFilter;
+
+// Noise generation type
+typedef enum {
+    NOISE_FBM = 0,                  // Fractal brownian motion, octaves added
+    NOISE_RIDGED,                   // Ridged multifractal, octaves inverted absolute values weighted by previous octave
+    NOISE_TURBULENCE                // Turbulence, octaves absolute values added
+} NoiseType;
+
+// Image drawing flags, for ImageDraw*() primitives
+typedef enum {
+    IMAGE_DRAW_BLEND = 0x00000001,      // Alpha blend primitives over destination pixels (default: pixels replaced)
+    IMAGE_DRAW_ANTIALIAS = 0x00000002   // Anti-aliased primitives edges (edge pixels always blended)
+} ImageDrawFlags;
+
 #if defined (_WIN32)
 // Tray events 
 typedef enum
@@ -1166,6 +1259,13 @@ RLAPI void UnloadFileText(char *text);                            // Unload file
 RLAPI bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
 //------------------------------------------------------------------
 
+// Async loading functions
+// NOTE: Async load requests (i.e. LoadTextureAsync()) must be issued from main thread,
+// results are written to provided destination by UpdateAsyncLoads() when load finishes
+RLAPI int GetAsyncLoadState(unsigned int id);                     // Get async load request state (AsyncLoadState)
+RLAPI int GetAsyncLoadCount(void);                                // Get number of async load requests not finished yet
+RLAPI void UpdateAsyncLoads(float timeBudget);                    // Process finished async loads on main thread (GPU upload), limited by time budget (seconds)
+
 // File system functions
 RLAPI bool FileExists(const char *fileName);                      // Check if file exists
 RLAPI bool DirectoryExists(const char *dirPath);                  // Check if a directory path exists
@@ -1366,17 +1466,41 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // Image loading functions
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
+RLAPI unsigned int LoadImageAsync(const char *fileName, Image *image);                                   // Load image from file asynchronously, image is set when load finishes
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
+RLAPI AnimatedImage LoadAnimatedImage(const char *fileName);                                             // Load animated image for streaming playback, frames decoded on demand (GIF)
+RLAPI AnimatedImage LoadAnimatedImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load animated image from memory buffer, fileType refers to extension: i.e. '.gif'
+RLAPI bool IsAnimatedImageValid(AnimatedImage image);                                                    // Check if an animated image is valid (current frame image and frames data)
+RLAPI void UnloadAnimatedImage(AnimatedImage image);                                                     // Unload animated image data (decoder, frames data and current frame image)
+RLAPI bool UpdateAnimatedImageFrame(AnimatedImage *image, int frame);                                    // Update animated image current frame, sequential frames are decoded one at a time
+RLAPI int GetAnimatedImageFrameIndex(AnimatedImage image, float time);                                   // Get animated image frame index at playback time (seconds, looped)
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+RLAPI bool LoadImageInto(Image *dst, const char *fileName);                                              // Load image from file into existing image, reusing its pixel buffer if size matches
+RLAPI bool LoadImageFromMemoryInto(Image *dst, const char *fileType, const unsigned char *fileData, int dataSize); // Load image from memory buffer into existing image, reusing its pixel buffer if size matches
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageValid(Image image);                                                                    // Check if an image is valid (data and parameters)
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI void SetImagePoolSize(int count);                                                                  // Set max number of pixel buffers retained for reuse by UnloadImage() (0 disables pool, default)
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI void SetImageExportOptions(int compressionLevel, int filterMode, bool threaded);                    // Set PNG export options: compression level (0..8), rows filter mode (PngFilterMode) and multithreaded compression
+
+// Mapped image functions
+// NOTE: Pixel data is accessed through file memory mapping, only accessed regions are loaded in RAM
+RLAPI MappedImage LoadMappedImage(const char *fileName, int width, int height, int format, int headerSize, bool writable); // Load mapped image from RAW file (writable files are created/extended if required)
+RLAPI bool IsMappedImageValid(MappedImage image);                                                        // Check if a mapped image is valid (data and parameters)
+RLAPI void UnloadMappedImage(MappedImage image);                                                         // Unload mapped image (changes written to file)
+RLAPI Image LoadImageRegion(MappedImage image, Rectangle region);                                        // Load image from mapped image region (copy into RAM)
+RLAPI void UpdateImageRegion(MappedImage image, Rectangle region, const void *pixels);                   // Update mapped image region with new data (mapped image format)
+RLAPI int GetMappedImageTileCount(MappedImage image, int tileSize);                                      // Get number of tiles covering mapped image
+RLAPI Rectangle GetMappedImageTile(MappedImage image, int tileSize, int index);                          // Get mapped image tile rectangle (row order, clipped to image bounds)
+RLAPI void MappedImageCrop(MappedImage src, Rectangle crop, MappedImage dst);                            // Crop mapped image region into destination mapped image (converted to destination format)
+RLAPI void MappedImageFormat(MappedImage src, MappedImage dst);                                          // Convert mapped image into destination mapped image format
+RLAPI void MappedImageResize(MappedImage src, MappedImage dst);                                          // Resize mapped image into destination mapped image size (Bicubic scaling algorithm)
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1386,8 +1510,13 @@ RLAPI Image GenImageGradientSquare(int width, int height, float density, Color i
 RLAPI Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2);    // Generate image: checked
 RLAPI Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
+RLAPI Image GenImageNoise(int width, int height, int offsetX, int offsetY, float scale, int type, int octaves, int seed); // Generate image: multi-octave perlin noise (NoiseType)
+RLAPI Image GenImageNoiseFloat(int width, int height, int offsetX, int offsetY, float scale, int type, int octaves, int seed); // Generate image: multi-octave perlin noise (NoiseType) as float values (R32), i.e. for heightmaps
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
+RLAPI Image GenImageCubemap(Image panorama, int size);                                                   // Generate image: cubemap faces in a vertical line from equirectangular panorama
+RLAPI Image GenImageCubemapIrradiance(Image cubemap, int size);                                          // Generate image: diffuse irradiance cubemap from cubemap (faces in a vertical line)
+RLAPI Image GenImageCubemapPrefiltered(Image cubemap, int size, int mipmaps);                            // Generate image: specular prefiltered cubemap from cubemap, roughness per mipmap level (GGX)
 
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
@@ -1400,20 +1529,25 @@ RLAPI void ImageToPOT(Image *image, Color fill);
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
 RLAPI void ImageAlphaClear(Image *image, Color color, float threshold);                                  // Clear alpha channel to desired color
-RLAPI void ImageAlphaMask(Image *image, Image alphaMask);                                                // Apply alpha mask to image
+RLAPI void ImageAlphaMask(Image *image, Image alphaMask);                                                // Apply alpha mask to image (GRAYSCALE/GRAY_ALPHA become GRAY_ALPHA, others RGBA)
 RLAPI void ImageAlphaPremultiply(Image *image);                                                          // Premultiply alpha channel
+RLAPI void ImageAlphaUnpremultiply(Image *image);                                                        // Unpremultiply alpha channel (divide color by alpha)
 RLAPI void ImageBlurGaussian(Image *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
 RLAPI void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
+RLAPI void ImageConvolveSeparable(Image *image, const float *kernelX, int kernelXSize, const float *kernelY, int kernelYSize); // Apply separable convolution kernel to image (horizontal and vertical kernels)
 RLAPI void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
+RLAPI void ImageResizeEx(Image *image, int newWidth, int newHeight, int filter);                        // Resize image using provided filter (ResizeFilter), pixels resampled in native format
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageQuantize(Image *image, int colors, bool dither);                                         // Quantize image colors to a reduced palette (median cut), optional Floyd-Steinberg dithering
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotate(Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
 RLAPI void ImageRotateCCW(Image *image);                                                                 // Rotate image counter-clockwise 90deg
+RLAPI void ImageAdjust(Image *image, const ImageAdjustments *adjustments);                               // Apply color adjustments chain to image in a single pass (format kept)
 RLAPI void ImageColorTint(Image *image, Color color);                                                    // Modify image color: tint
 RLAPI void ImageColorInvert(Image *image);                                                               // Modify image color: invert
 RLAPI void ImageColorGrayscale(Image *image);                                                            // Modify image color: grayscale
@@ -1426,9 +1560,12 @@ RLAPI void UnloadImageColors(Color *colors);
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
+RLAPI ImageComparison ImageCompare(Image image, Image reference, float tolerance);                       // Compare image against reference image: errors, PSNR, SSIM and pass/fail with channels tolerance
+RLAPI Image ImageDiff(Image image, Image reference);                                                     // Generate image absolute differences against reference image
 
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
+RLAPI void SetImageDrawFlags(unsigned int flags);                                                        // Set image drawing flags (ImageDrawFlags) for drawing primitives
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
 RLAPI void ImageDrawPixel(Image *dst, int posX, int posY, Color color);                                  // Draw pixel within an image
 RLAPI void ImageDrawPixelV(Image *dst, Vector2 position, Color color);                                   // Draw pixel within an image (Vector version)
@@ -1448,6 +1585,9 @@ RLAPI void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, C
 RLAPI void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);          // Draw triangle outline within an image
 RLAPI void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color);               // Draw a triangle fan defined by points within an image (first vertex is the center)
 RLAPI void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color);             // Draw a triangle strip defined by points within an image
+RLAPI void ImageDrawLineStrip(Image *dst, const Vector2 *points, int pointCount, float thick, Color color); // Draw lines sequence defining thickness within an image (round joins)
+RLAPI void ImageDrawPolygon(Image *dst, const Vector2 *points, int pointCount, Color color);              // Draw a filled polygon defined by points within an image (non-zero winding rule)
+RLAPI void ImageDrawPolygonLines(Image *dst, const Vector2 *points, int pointCount, float thick, Color color); // Draw polygon outline defining thickness within an image (round joins)
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
@@ -1455,7 +1595,9 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI unsigned int LoadTextureAsync(const char *fileName, Texture2D *texture);                           // Load texture from file asynchronously, texture is set when load finishes
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI Texture2D LoadTextureFromMappedImage(MappedImage image, Rectangle region);                         // Load texture from mapped image region
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureValid(Texture2D texture);                                                            // Check if a texture is valid (loaded in GPU)
@@ -1478,6 +1620,15 @@ RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// Virtual texture functions
+// NOTE: Tiles are streamed asynchronously, UpdateAsyncLoads() must be called every frame
+RLAPI bool ExportVirtualTexture(MappedImage image, const char *fileName, int tileSize);                   // Export mapped image as virtual texture tiles file (tiled mip pyramid)
+RLAPI VirtualTexture LoadVirtualTexture(const char *fileName, int cacheSize);                            // Load virtual texture from tiles file, tiles cached in a cacheSize x cacheSize texture
+RLAPI bool IsVirtualTextureValid(VirtualTexture texture);                                                // Check if a virtual texture is valid (tiles file mapped and cache texture loaded)
+RLAPI void UnloadVirtualTexture(VirtualTexture texture);                                                 // Unload virtual texture (tiles file and cache texture)
+RLAPI void RequestVirtualTextureRegion(VirtualTexture texture, Rectangle region, int level);             // Request virtual texture tiles covering region at mip level (prefetch)
+RLAPI void DrawVirtualTexture(VirtualTexture texture, Rectangle source, Rectangle dest, Color tint);     // Draw virtual texture region using resident tiles, visible tiles are requested
+
 // Color/pixel related functions
 RLAPI bool ColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1596,6 +1747,7 @@ RLAPI void DrawGrid(int slices, float spacing);
 
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
+RLAPI unsigned int LoadModelAsync(const char *fileName, Model *model);                      // Load model from files asynchronously, model is set when load finishes
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
@@ -1680,6 +1832,7 @@ RLAPI Wave LoadWave(const char *fileName);                            // Load wa
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
+RLAPI unsigned int LoadSoundAsync(const char *fileName, Sound *sound); // Load sound from file asynchronously, sound is set when load finishes
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
@@ -19,6 +19,9 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS:
+*           - Linux offscreen rendering (EGL surfaceless/pbuffer, Mesa software drivers supported)
+*           - Any system with GRAPHICS_API_SOFTWARE (rlsw)
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -107,6 +110,7 @@
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
+#include <ctype.h>                  // Required for: tolower() [Used in IsFileExtension()]
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
@@ -253,6 +257,10 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef SCREENSHOT_FILE_TYPE
+    #define SCREENSHOT_FILE_TYPE      ".png"        // Screenshot file type for automatic screenshots (.png, .qoi, .bmp, .tga, .raw)
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
@@ -525,6 +533,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -594,6 +604,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -645,7 +657,13 @@ void InitWindow(int width, int height, const char *title)
 
     // Initialize platform
     //--------------------------------------------------------------
-    InitPlatform();
+    int result = InitPlatform();
+
+    if (result != 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to initialize platform");
+        return;
+    }
     //--------------------------------------------------------------
 
     // Initialize rlgl default data (buffers and shaders)
@@ -698,6 +716,8 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+    CloseAsyncLoads();          // Stop async loading workers, pending requests are cancelled
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
@@ -718,6 +738,8 @@ void CloseWindow(void)
     ClosePlatform();
     //--------------------------------------------------------------
 
+    CloseParallelWorkers();     // Stop and join ParallelFor() workers
+
     CORE.Window.ready = false;
     TRACELOG(LOG_INFO, "Window closed successfully");
 }
@@ -967,7 +989,7 @@ void EndDrawing(void)
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshot(TextFormat("screenshot%03i%s", screenshotCounter, SCREENSHOT_FILE_TYPE));
             screenshotCounter++;
         }
     }
@@ -1188,7 +1210,7 @@ VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device)
 {
     VrStereoConfig config = { 0 };
 
-    if (rlGetVersion() != RL_OPENGL_11)
+    if ((rlGetVersion() != RL_OPENGL_11) && (rlGetVersion() != RL_OPENGL_11_SOFTWARE))
     {
         // Compute aspect ratio
         float aspect = ((float)device.hResolution*0.5f)/(float)device.vResolution;
@@ -1888,31 +1910,33 @@ bool FileExists(const char *fileName)
 // NOTE: Extensions checking is not case-sensitive
 bool IsFileExtension(const char *fileName, const char *ext)
 {
-    #define MAX_FILE_EXTENSION_LENGTH  16
-
     bool result = false;
     const char *fileExt = GetFileExtension(fileName);
 
-    if (fileExt != NULL)
+    if ((fileExt != NULL) && (ext != NULL))
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
-
-        char fileExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt), MAX_FILE_EXTENSION_LENGTH); // WARNING: Module required: rtext
+        // Compare against every extension in the ';' separated list, case insensitive
+        // NOTE: No static memory used, it can be called from async loading workers
+        const char *checkExt = ext;
 
-        for (int i = 0; i < extCount; i++)
+        while (!result && (*checkExt != '\0'))
         {
-            if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
+            int length = 0;
+            while ((checkExt[length] != '\0') && (checkExt[length] != ';')) length++;
+
+            if ((int)strlen(fileExt) == length)
             {
                 result = true;
-                break;
+
+                for (int i = 0; i < length; i++)
+                {
+                    if (tolower((unsigned char)fileExt[i]) != tolower((unsigned char)checkExt[i])) { result = false; break; }
+                }
             }
+
+            checkExt += length;
+            if (*checkExt == ';') checkExt++;
         }
-#else
-        if (strcmp(fileExt, ext) == 0) result = true;
-#endif
     }
 
     return result;
@@ -3074,7 +3098,7 @@ void PlayAutomationEvent(AutomationEvent event)
     #if defined(SUPPORT_SCREEN_CAPTURE)
             case ACTION_TAKE_SCREENSHOT:
             {
-                TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                TakeScreenshot(TextFormat("screenshot%03i%s", screenshotCounter, SCREENSHOT_FILE_TYPE));
                 screenshotCounter++;
             } break;
     #endif
@@ -27,7 +27,10 @@
 *       #define GRAPHICS_API_OPENGL_43
 *       #define GRAPHICS_API_OPENGL_ES2
 *       #define GRAPHICS_API_OPENGL_ES3
+*       #define GRAPHICS_API_SOFTWARE
 *           Use selected OpenGL graphics backend, should be supported by platform
+*           GRAPHICS_API_SOFTWARE uses the OpenGL 1.1 path over a software rasterizer (external/rlsw.h),
+*           no GPU or OpenGL driver is required, custom shaders are not supported
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
@@ -148,6 +151,13 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// Software renderer implements the OpenGL 1.1 subset used by rlgl
+#if defined(GRAPHICS_API_SOFTWARE)
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        #define GRAPHICS_API_OPENGL_11
+    #endif
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -422,6 +432,32 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlCommandBuffer type
+// NOTE: CPU-only render batch, vertex data and draw calls are recorded without any GL call,
+// so it can be filled from any thread and later submitted by the thread owning the GL context
+typedef struct rlCommandBuffer {
+    int vertexCount;            // Number of vertex recorded (including alignment vertex)
+    int vertexCapacity;         // Number of vertex allocated, buffer grows as required
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    float *normals;             // Vertex normal (XYZ - 3 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+
+    rlDrawCall *draws;          // Draw calls array, depends on mode and textureId
+    int drawCounter;            // Draw calls counter
+    int drawCapacity;           // Draw calls allocated, array grows as required
+    float currentDepth;         // Current depth value for next draw
+
+    // Recording state, equivalent to rlgl internal state but owned by the buffer
+    float texcoordx, texcoordy;         // Current active texture coordinate
+    float normalx, normaly, normalz;    // Current active normal
+    unsigned char colorr, colorg, colorb, colora;   // Current active color
+    Matrix transform;                   // Current transform matrix (rlTranslatef, rlRotatef, rlScalef...)
+    bool transformRequired;             // Require transform matrix application to recorded vertex
+    Matrix stack[RL_MAX_MATRIX_STACK_SIZE]; // Matrix stack for push/pop
+    int stackCounter;                   // Matrix stack counter
+} rlCommandBuffer;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -429,7 +465,8 @@ typedef enum {
     RL_OPENGL_33,               // OpenGL 3.3 (GLSL 330)
     RL_OPENGL_43,               // OpenGL 4.3 (using GLSL 330)
     RL_OPENGL_ES_20,            // OpenGL ES 2.0 (GLSL 100)
-    RL_OPENGL_ES_30             // OpenGL ES 3.0 (GLSL 300 es)
+    RL_OPENGL_ES_30,            // OpenGL ES 3.0 (GLSL 300 es)
+    RL_OPENGL_11_SOFTWARE       // OpenGL 1.1 software rasterizer (rlsw)
 } rlGlVersion;
 
 // Trace log level
@@ -728,6 +765,15 @@ RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Command buffers management (multithreaded recording)
+// NOTE: Any thread can record vertex level drawing (rlBegin/rlVertex/rlSetTexture/rlPushMatrix...)
+// into its own command buffer, recorded buffers are submitted by the thread owning the GL context
+RLAPI rlCommandBuffer rlLoadCommandBuffer(int vertexCapacity); // Load a command buffer (CPU only, no GL calls)
+RLAPI void rlUnloadCommandBuffer(rlCommandBuffer buffer); // Unload command buffer
+RLAPI void rlBeginCommandBuffer(rlCommandBuffer *buffer); // Reset command buffer and redirect calling thread drawing into it
+RLAPI void rlEndCommandBuffer(void);                    // Stop recording on calling thread
+RLAPI void rlSubmitCommandBuffer(const rlCommandBuffer *buffer); // Draw recorded command buffer (GL context thread only)
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -763,6 +809,7 @@ RLAPI unsigned int rlLoadFramebuffer(void);                               // Loa
 RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel); // Attach texture/renderbuffer to a framebuffer
 RLAPI bool rlFramebufferComplete(unsigned int id);                        // Verify framebuffer is complete
 RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Delete framebuffer from GPU
+RLAPI void rlSetFramebufferDefault(unsigned int id);                      // Set default framebuffer, bound when rendering to texture is disabled (0: window framebuffer)
 
 // Shaders management
 RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
@@ -780,6 +827,7 @@ RLAPI void rlSetShader(unsigned int id, int *locs);
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
 RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ); // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+RLAPI void rlComputeShaderBarrier(void);                                        // Make compute shader SSBO writes visible to following shader reads
 
 // Shader buffer storage object management (ssbo)
 RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
@@ -828,7 +876,142 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GLAD_API_CALL_EXPORT_BUILD
 #endif
 
-#if defined(GRAPHICS_API_OPENGL_11)
+#if defined(GRAPHICS_API_SOFTWARE)
+    #define RLSW_IMPLEMENTATION
+    #include "external/rlsw.h"          // OpenGL 1.1 software implementation
+
+    // OpenGL 1.1 API mapped to software implementation
+    typedef int GLint;
+    typedef unsigned int GLuint;
+    typedef float GLfloat;
+
+    #define glBegin                     swBegin
+    #define glEnd                       swEnd
+    #define glVertex2i                  swVertex2i
+    #define glVertex2f                  swVertex2f
+    #define glVertex3f                  swVertex3f
+    #define glTexCoord2f                swTexCoord2f
+    #define glNormal3f                  swNormal3f
+    #define glColor3f                   swColor3f
+    #define glColor4f                   swColor4f
+    #define glColor4ub                  swColor4ub
+    #define glMatrixMode                swMatrixMode
+    #define glPushMatrix                swPushMatrix
+    #define glPopMatrix                 swPopMatrix
+    #define glLoadIdentity              swLoadIdentity
+    #define glTranslatef                swTranslatef
+    #define glRotatef                   swRotatef
+    #define glScalef                    swScalef
+    #define glMultMatrixf               swMultMatrixf
+    #define glFrustum                   swFrustum
+    #define glOrtho                     swOrtho
+    #define glViewport                  swViewport
+    #define glScissor                   swScissor
+    #define glEnable                    swEnable
+    #define glDisable                   swDisable
+    #define glClearColor                swClearColor
+    #define glClearDepth                swClearDepth
+    #define glClear                     swClear
+    #define glBlendFunc                 swBlendFunc
+    #define glBlendEquation             swBlendEquation
+    #define glDepthFunc                 swDepthFunc
+    #define glDepthMask                 swDepthMask
+    #define glColorMask                 swColorMask
+    #define glCullFace                  swCullFace
+    #define glFrontFace                 swFrontFace
+    #define glPolygonMode               swPolygonMode
+    #define glLineWidth                 swLineWidth
+    #define glHint                      swHint
+    #define glShadeModel                swShadeModel
+    #define glPixelStorei               swPixelStorei
+    #define glGetFloatv                 swGetFloatv
+    #define glGetIntegerv               swGetIntegerv
+    #define glGetString                 swGetString
+    #define glEnableClientState         swEnableClientState
+    #define glDisableClientState        swDisableClientState
+    #define glVertexPointer             swVertexPointer
+    #define glTexCoordPointer           swTexCoordPointer
+    #define glNormalPointer             swNormalPointer
+    #define glColorPointer              swColorPointer
+    #define glDrawArrays                swDrawArrays
+    #define glDrawElements              swDrawElements
+    #define glGenTextures               swGenTextures
+    #define glDeleteTextures            swDeleteTextures
+    #define glBindTexture               swBindTexture
+    #define glTexImage2D                swTexImage2D
+    #define glTexSubImage2D             swTexSubImage2D
+    #define glTexParameteri             swTexParameteri
+    #define glGetTexImage               swGetTexImage
+    #define glReadPixels                swReadPixels
+    #define glFlush                     swFlush
+    #define glFinish                    swFinish
+
+    #define GL_FALSE                    SW_FALSE
+    #define GL_TRUE                     SW_TRUE
+    #define GL_POINTS                   SW_POINTS
+    #define GL_LINES                    SW_LINES
+    #define GL_TRIANGLES                SW_TRIANGLES
+    #define GL_QUADS                    SW_QUADS
+    #define GL_MODELVIEW                SW_MODELVIEW
+    #define GL_PROJECTION               SW_PROJECTION
+    #define GL_TEXTURE                  SW_TEXTURE
+    #define GL_MODELVIEW_MATRIX         SW_MODELVIEW_MATRIX
+    #define GL_PROJECTION_MATRIX        SW_PROJECTION_MATRIX
+    #define GL_TEXTURE_2D               SW_TEXTURE_2D
+    #define GL_BLEND                    SW_BLEND
+    #define GL_DEPTH_TEST               SW_DEPTH_TEST
+    #define GL_CULL_FACE                SW_CULL_FACE
+    #define GL_SCISSOR_TEST             SW_SCISSOR_TEST
+    #define GL_LINE_SMOOTH              SW_LINE_SMOOTH
+    #define GL_FRONT                    SW_FRONT
+    #define GL_BACK                     SW_BACK
+    #define GL_FRONT_AND_BACK           SW_FRONT_AND_BACK
+    #define GL_CW                       SW_CW
+    #define GL_CCW                      SW_CCW
+    #define GL_POINT                    SW_POINT
+    #define GL_LINE                     SW_LINE
+    #define GL_FILL                     SW_FILL
+    #define GL_LEQUAL                   SW_LEQUAL
+    #define GL_ZERO                     SW_ZERO
+    #define GL_ONE                      SW_ONE
+    #define GL_SRC_ALPHA                SW_SRC_ALPHA
+    #define GL_ONE_MINUS_SRC_ALPHA      SW_ONE_MINUS_SRC_ALPHA
+    #define GL_DST_COLOR                SW_DST_COLOR
+    #define GL_COLOR_BUFFER_BIT         SW_COLOR_BUFFER_BIT
+    #define GL_DEPTH_BUFFER_BIT         SW_DEPTH_BUFFER_BIT
+    #define GL_UNSIGNED_BYTE            SW_UNSIGNED_BYTE
+    #define GL_UNSIGNED_SHORT           SW_UNSIGNED_SHORT
+    #define GL_UNSIGNED_INT             SW_UNSIGNED_INT
+    #define GL_FLOAT                    SW_FLOAT
+    #define GL_DEPTH_COMPONENT          SW_DEPTH_COMPONENT
+    #define GL_ALPHA                    SW_ALPHA
+    #define GL_RGB                      SW_RGB
+    #define GL_RGBA                     SW_RGBA
+    #define GL_LUMINANCE                SW_LUMINANCE
+    #define GL_LUMINANCE_ALPHA          SW_LUMINANCE_ALPHA
+    #define GL_UNPACK_ALIGNMENT         SW_UNPACK_ALIGNMENT
+    #define GL_PACK_ALIGNMENT           SW_PACK_ALIGNMENT
+    #define GL_VENDOR                   SW_VENDOR
+    #define GL_RENDERER                 SW_RENDERER
+    #define GL_VERSION                  SW_VERSION
+    #define GL_EXTENSIONS               SW_EXTENSIONS
+    #define GL_PERSPECTIVE_CORRECTION_HINT  SW_PERSPECTIVE_CORRECTION_HINT
+    #define GL_NICEST                   SW_NICEST
+    #define GL_SMOOTH                   SW_SMOOTH
+    #define GL_TEXTURE_MAG_FILTER       SW_TEXTURE_MAG_FILTER
+    #define GL_TEXTURE_MIN_FILTER       SW_TEXTURE_MIN_FILTER
+    #define GL_TEXTURE_WRAP_S           SW_TEXTURE_WRAP_S
+    #define GL_TEXTURE_WRAP_T           SW_TEXTURE_WRAP_T
+    #define GL_NEAREST                  SW_NEAREST
+    #define GL_LINEAR                   SW_LINEAR
+    #define GL_REPEAT                   SW_REPEAT
+    #define GL_CLAMP_TO_EDGE            SW_CLAMP_TO_EDGE
+    #define GL_MIRRORED_REPEAT          SW_MIRRORED_REPEAT
+    #define GL_VERTEX_ARRAY             SW_VERTEX_ARRAY
+    #define GL_NORMAL_ARRAY             SW_NORMAL_ARRAY
+    #define GL_COLOR_ARRAY              SW_COLOR_ARRAY
+    #define GL_TEXTURE_COORD_ARRAY      SW_TEXTURE_COORD_ARRAY
+#elif defined(GRAPHICS_API_OPENGL_11)
     #if defined(__APPLE__)
         #include <OpenGL/gl.h>          // OpenGL 1.1 library for OSX
         #include <OpenGL/glext.h>       // OpenGL extensions library
@@ -1030,6 +1213,17 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// Thread-local storage specifier, required by command buffers recording
+#ifndef RL_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define RL_THREAD_LOCAL _Thread_local
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -1081,6 +1275,7 @@ typedef struct rlglData {
 
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
+        unsigned int framebufferDefaultId;  // Default framebuffer object (0: window framebuffer)
 
     } State;            // Renderer state
     struct {
@@ -1117,10 +1312,20 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
 static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
+// Command buffer being recorded on current thread, vertex level functions are redirected to it
+static RL_THREAD_LOCAL rlCommandBuffer *rlRecordingBuffer = NULL;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_SOFTWARE)
+// Software renderer custom blending factors, applied with RL_BLEND_CUSTOM
+static int rlswBlendSrcFactor = RL_SRC_ALPHA;
+static int rlswBlendDstFactor = RL_ONE_MINUS_SRC_ALPHA;
+static int rlswBlendEquation = RL_FUNC_ADD;
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1146,6 +1351,17 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
+// Command buffers recording functions (no GL calls)
+static void rlRecordBegin(rlCommandBuffer *buffer, int mode);               // Record drawing mode
+static void rlRecordSetTexture(rlCommandBuffer *buffer, unsigned int id);   // Record texture change
+static void rlRecordVertex(rlCommandBuffer *buffer, float x, float y, float z);    // Record vertex with current state
+static void rlRecordNormal(rlCommandBuffer *buffer, float x, float y, float z);    // Set current normal (transformed)
+static void rlRecordPushMatrix(rlCommandBuffer *buffer);                    // Push current transform matrix
+static void rlRecordPopMatrix(rlCommandBuffer *buffer);                     // Pop lattest pushed transform matrix
+static void rlRecordMultMatrix(rlCommandBuffer *buffer, Matrix mat);        // Multiply current transform matrix
+static void rlRecordReserve(rlCommandBuffer *buffer, int vCount);           // Make sure vertex arrays can hold vCount more vertex
+static void rlRecordNextDraw(rlCommandBuffer *buffer);                      // Align current draw and start a new one
+
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
     float v[16];
@@ -1154,6 +1370,9 @@ static rl_float16 rlMatrixToFloatV(Matrix mat);             // Get float array o
 #define rlMatrixToFloat(mat) (rlMatrixToFloatV(mat).v)      // Get float vector for Matrix
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
 static Matrix rlMatrixMultiply(Matrix left, Matrix right);  // Multiply two matrices
+static Matrix rlMatrixTranslate(float x, float y, float z); // Get translation matrix
+static Matrix rlMatrixRotate(float angle, float x, float y, float z); // Get rotation matrix (angle in degrees)
+static Matrix rlMatrixScale(float x, float y, float z);     // Get scaling matrix
 static Matrix rlMatrixTranspose(Matrix mat);                // Transposes provided matrix
 static Matrix rlMatrixInvert(Matrix mat);                   // Invert provided matrix
 
@@ -1185,13 +1404,25 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
     glOrtho(left, right, bottom, top, znear, zfar);
 }
 
-void rlPushMatrix(void) { glPushMatrix(); }
-void rlPopMatrix(void) { glPopMatrix(); }
-void rlLoadIdentity(void) { glLoadIdentity(); }
-void rlTranslatef(float x, float y, float z) { glTranslatef(x, y, z); }
-void rlRotatef(float angle, float x, float y, float z) { glRotatef(angle, x, y, z); }
-void rlScalef(float x, float y, float z) { glScalef(x, y, z); }
-void rlMultMatrixf(const float *matf) { glMultMatrixf(matf); }
+void rlPushMatrix(void) { if (rlRecordingBuffer != NULL) rlRecordPushMatrix(rlRecordingBuffer); else glPushMatrix(); }
+void rlPopMatrix(void) { if (rlRecordingBuffer != NULL) rlRecordPopMatrix(rlRecordingBuffer); else glPopMatrix(); }
+void rlLoadIdentity(void) { if (rlRecordingBuffer != NULL) rlRecordingBuffer->transform = rlMatrixIdentity(); else glLoadIdentity(); }
+void rlTranslatef(float x, float y, float z) { if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, rlMatrixTranslate(x, y, z)); else glTranslatef(x, y, z); }
+void rlRotatef(float angle, float x, float y, float z) { if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, rlMatrixRotate(angle, x, y, z)); else glRotatef(angle, x, y, z); }
+void rlScalef(float x, float y, float z) { if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, rlMatrixScale(x, y, z)); else glScalef(x, y, z); }
+void rlMultMatrixf(const float *matf)
+{
+    if (rlRecordingBuffer != NULL)
+    {
+        Matrix mat = { matf[0], matf[4], matf[8], matf[12],
+                       matf[1], matf[5], matf[9], matf[13],
+                       matf[2], matf[6], matf[10], matf[14],
+                       matf[3], matf[7], matf[11], matf[15] };
+
+        rlRecordMultMatrix(rlRecordingBuffer, mat);
+    }
+    else glMultMatrixf(matf);
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Choose the current matrix to be transformed
@@ -1207,6 +1438,8 @@ void rlMatrixMode(int mode)
 // Push the current matrix into RLGL.State.stack
 void rlPushMatrix(void)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordPushMatrix(rlRecordingBuffer); return; }
+
     if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
 
     if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
@@ -1222,6 +1455,8 @@ void rlPushMatrix(void)
 // Pop lattest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordPopMatrix(rlRecordingBuffer); return; }
+
     if (RLGL.State.stackCounter > 0)
     {
         Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
@@ -1239,80 +1474,39 @@ void rlPopMatrix(void)
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
-    *RLGL.State.currentMatrix = rlMatrixIdentity();
+    if (rlRecordingBuffer != NULL) rlRecordingBuffer->transform = rlMatrixIdentity();
+    else *RLGL.State.currentMatrix = rlMatrixIdentity();
 }
 
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z)
 {
-    Matrix matTranslation = {
-        1.0f, 0.0f, 0.0f, x,
-        0.0f, 1.0f, 0.0f, y,
-        0.0f, 0.0f, 1.0f, z,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix matTranslation = rlMatrixTranslate(x, y, z);
 
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
+    if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, matTranslation);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by a rotation matrix
 // NOTE: The provided angle must be in degrees
 void rlRotatef(float angle, float x, float y, float z)
 {
-    Matrix matRotation = rlMatrixIdentity();
-
-    // Axis vector (x, y, z) normalization
-    float lengthSquared = x*x + y*y + z*z;
-    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
-    {
-        float inverseLength = 1.0f/sqrtf(lengthSquared);
-        x *= inverseLength;
-        y *= inverseLength;
-        z *= inverseLength;
-    }
-
-    // Rotation matrix generation
-    float sinres = sinf(DEG2RAD*angle);
-    float cosres = cosf(DEG2RAD*angle);
-    float t = 1.0f - cosres;
-
-    matRotation.m0 = x*x*t + cosres;
-    matRotation.m1 = y*x*t + z*sinres;
-    matRotation.m2 = z*x*t - y*sinres;
-    matRotation.m3 = 0.0f;
-
-    matRotation.m4 = x*y*t - z*sinres;
-    matRotation.m5 = y*y*t + cosres;
-    matRotation.m6 = z*y*t + x*sinres;
-    matRotation.m7 = 0.0f;
-
-    matRotation.m8 = x*z*t + y*sinres;
-    matRotation.m9 = y*z*t - x*sinres;
-    matRotation.m10 = z*z*t + cosres;
-    matRotation.m11 = 0.0f;
-
-    matRotation.m12 = 0.0f;
-    matRotation.m13 = 0.0f;
-    matRotation.m14 = 0.0f;
-    matRotation.m15 = 1.0f;
+    Matrix matRotation = rlMatrixRotate(angle, x, y, z);
 
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
+    if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, matRotation);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z)
 {
-    Matrix matScale = {
-        x, 0.0f, 0.0f, 0.0f,
-        0.0f, y, 0.0f, 0.0f,
-        0.0f, 0.0f, z, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix matScale = rlMatrixScale(x, y, z);
 
     // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
+    if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, matScale);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by another matrix
@@ -1324,7 +1518,8 @@ void rlMultMatrixf(const float *matf)
                    matf[2], matf[6], matf[10], matf[14],
                    matf[3], matf[7], matf[11], matf[15] };
 
-    *RLGL.State.currentMatrix = rlMatrixMultiply(mat, *RLGL.State.currentMatrix);
+    if (rlRecordingBuffer != NULL) rlRecordMultMatrix(rlRecordingBuffer, mat);
+    else *RLGL.State.currentMatrix = rlMatrixMultiply(mat, *RLGL.State.currentMatrix);
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
@@ -1425,6 +1620,8 @@ double rlGetCullDistanceFar(void)
 //---------------------------------------
 void rlBegin(int mode)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordBegin(rlRecordingBuffer, mode); return; }
+
     switch (mode)
     {
         case RL_LINES: glBegin(GL_LINES); break;
@@ -1434,20 +1631,40 @@ void rlBegin(int mode)
     }
 }
 
-void rlEnd(void) { glEnd(); }
-void rlVertex2i(int x, int y) { glVertex2i(x, y); }
-void rlVertex2f(float x, float y) { glVertex2f(x, y); }
-void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
-void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
-void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
-void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
-void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
-void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlEnd(void) { if (rlRecordingBuffer != NULL) rlRecordingBuffer->currentDepth += (1.0f/20000.0f); else glEnd(); }
+void rlVertex2i(int x, int y) { if (rlRecordingBuffer != NULL) rlRecordVertex(rlRecordingBuffer, (float)x, (float)y, 0.0f); else glVertex2i(x, y); }
+void rlVertex2f(float x, float y) { if (rlRecordingBuffer != NULL) rlRecordVertex(rlRecordingBuffer, x, y, 0.0f); else glVertex2f(x, y); }
+void rlVertex3f(float x, float y, float z) { if (rlRecordingBuffer != NULL) rlRecordVertex(rlRecordingBuffer, x, y, z); else glVertex3f(x, y, z); }
+void rlTexCoord2f(float x, float y)
+{
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordingBuffer->texcoordx = x;
+        rlRecordingBuffer->texcoordy = y;
+    }
+    else glTexCoord2f(x, y);
+}
+void rlNormal3f(float x, float y, float z) { if (rlRecordingBuffer != NULL) rlRecordNormal(rlRecordingBuffer, x, y, z); else glNormal3f(x, y, z); }
+void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordingBuffer->colorr = r;
+        rlRecordingBuffer->colorg = g;
+        rlRecordingBuffer->colorb = b;
+        rlRecordingBuffer->colora = a;
+    }
+    else glColor4ub(r, g, b, a);
+}
+void rlColor3f(float x, float y, float z) { if (rlRecordingBuffer != NULL) rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255); else glColor3f(x, y, z); }
+void rlColor4f(float x, float y, float z, float w) { if (rlRecordingBuffer != NULL) rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), (unsigned char)(w*255)); else glColor4f(x, y, z, w); }
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordBegin(rlRecordingBuffer, mode); return; }
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1484,13 +1701,16 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+    if (rlRecordingBuffer != NULL) rlRecordingBuffer->currentDepth += (1.0f/20000.0f);
+    else RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 }
 
 // Define one vertex (position)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordVertex(rlRecordingBuffer, x, y, z); return; }
+
     float tx = x;
     float ty = y;
     float tz = z;
@@ -1555,27 +1775,39 @@ void rlVertex3f(float x, float y, float z)
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
+    if (rlRecordingBuffer != NULL) rlRecordVertex(rlRecordingBuffer, x, y, rlRecordingBuffer->currentDepth);
+    else rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
+    if (rlRecordingBuffer != NULL) rlRecordVertex(rlRecordingBuffer, (float)x, (float)y, rlRecordingBuffer->currentDepth);
+    else rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    RLGL.State.texcoordx = x;
-    RLGL.State.texcoordy = y;
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordingBuffer->texcoordx = x;
+        rlRecordingBuffer->texcoordy = y;
+    }
+    else
+    {
+        RLGL.State.texcoordx = x;
+        RLGL.State.texcoordy = y;
+    }
 }
 
 // Define one vertex (normal)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordNormal(rlRecordingBuffer, x, y, z); return; }
+
     float normalx = x;
     float normaly = y;
     float normalz = z;
@@ -1601,10 +1833,20 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
-    RLGL.State.colorr = x;
-    RLGL.State.colorg = y;
-    RLGL.State.colorb = z;
-    RLGL.State.colora = w;
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordingBuffer->colorr = x;
+        rlRecordingBuffer->colorg = y;
+        rlRecordingBuffer->colorb = z;
+        rlRecordingBuffer->colora = w;
+    }
+    else
+    {
+        RLGL.State.colorr = x;
+        RLGL.State.colorg = y;
+        RLGL.State.colorb = z;
+        RLGL.State.colora = w;
+    }
 }
 
 // Define one vertex (color)
@@ -1628,6 +1870,8 @@ void rlColor3f(float x, float y, float z)
 // Set current texture to use
 void rlSetTexture(unsigned int id)
 {
+    if (rlRecordingBuffer != NULL) { rlRecordSetTexture(rlRecordingBuffer, id); return; }
+
     if (id == 0)
     {
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -1831,6 +2075,8 @@ void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    swBindFramebuffer(SW_FRAMEBUFFER, id);
 #endif
 }
 
@@ -1840,6 +2086,8 @@ unsigned int rlGetActiveFramebuffer(void)
     GLint fboId = 0;
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &fboId);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    swGetIntegerv(SW_DRAW_FRAMEBUFFER_BINDING, &fboId);
 #endif
     return fboId;
 }
@@ -1848,7 +2096,9 @@ unsigned int rlGetActiveFramebuffer(void)
 void rlDisableFramebuffer(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    swBindFramebuffer(SW_FRAMEBUFFER, 0);
 #endif
 }
 
@@ -1865,6 +2115,8 @@ void rlBindFramebuffer(unsigned int target, unsigned int framebuffer)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(target, framebuffer);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    swBindFramebuffer(target, framebuffer);
 #endif
 }
 
@@ -2126,6 +2378,21 @@ void rlSetBlendMode(int mode)
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
     }
+#elif defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Software renderer does not support separate RGB/alpha blending,
+    // RL_BLEND_CUSTOM_SEPARATE uses the RGB factors and equation
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: swBlendFunc(SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA); swBlendEquation(SW_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: swBlendFunc(SW_SRC_ALPHA, SW_ONE); swBlendEquation(SW_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: swBlendFunc(SW_DST_COLOR, SW_ONE_MINUS_SRC_ALPHA); swBlendEquation(SW_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: swBlendFunc(SW_ONE, SW_ONE); swBlendEquation(SW_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: swBlendFunc(SW_ONE, SW_ONE); swBlendEquation(SW_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: swBlendFunc(SW_ONE, SW_ONE_MINUS_SRC_ALPHA); swBlendEquation(SW_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        case RL_BLEND_CUSTOM_SEPARATE: swBlendFunc(rlswBlendSrcFactor, rlswBlendDstFactor); swBlendEquation(rlswBlendEquation); break;
+        default: break;
+    }
 #endif
 }
 
@@ -2143,6 +2410,10 @@ void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 
         RLGL.State.glCustomBlendModeModified = true;
     }
+#elif defined(GRAPHICS_API_SOFTWARE)
+    rlswBlendSrcFactor = glSrcFactor;
+    rlswBlendDstFactor = glDstFactor;
+    rlswBlendEquation = glEquation;
 #endif
 }
 
@@ -2166,6 +2437,10 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
 
         RLGL.State.glCustomBlendModeModified = true;
     }
+#elif defined(GRAPHICS_API_SOFTWARE)
+    rlswBlendSrcFactor = glSrcRGB;
+    rlswBlendDstFactor = glDstRGB;
+    rlswBlendEquation = glEqRGB;
 #endif
 }
 
@@ -2251,6 +2526,12 @@ void rlglInit(int width, int height)
     }
 #endif
 
+#if defined(GRAPHICS_API_SOFTWARE)
+    // Init software renderer, it owns the default framebuffer color and depth buffers
+    if (swInit(width, height)) TRACELOG(RL_LOG_INFO, "RLSW: Software renderer initialized successfully (%i x %i, %i threads)", width, height, swGetThreadCount());
+    else TRACELOG(RL_LOG_WARNING, "RLSW: Failed to initialize software renderer");
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
@@ -2335,6 +2616,9 @@ void rlglClose(void)
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+#if defined(GRAPHICS_API_SOFTWARE)
+    swClose();
+#endif
 }
 
 // Load OpenGL extensions
@@ -2632,7 +2916,9 @@ void rlLoadExtensions(void *loader)
 int rlGetVersion(void)
 {
     int glVersion = 0;
-#if defined(GRAPHICS_API_OPENGL_11)
+#if defined(GRAPHICS_API_SOFTWARE)
+    glVersion = RL_OPENGL_11_SOFTWARE;
+#elif defined(GRAPHICS_API_OPENGL_11)
     glVersion = RL_OPENGL_11;
 #endif
 #if defined(GRAPHICS_API_OPENGL_21)
@@ -3137,8 +3423,11 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 }
 
 // Update and draw internal render batch
+// NOTE: Ignored while recording a command buffer, no GL calls are allowed
 void rlDrawRenderBatchActive(void)
 {
+    if (rlRecordingBuffer != NULL) return;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
@@ -3150,6 +3439,13 @@ bool rlCheckRenderBatchLimit(int vCount)
 {
     bool overflow = false;
 
+    // Command buffers grow on demand, they never overflow
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordReserve(rlRecordingBuffer, vCount);
+        return overflow;
+    }
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.vertexCounter + vCount) >=
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
@@ -3171,6 +3467,192 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Command buffers management
+//-----------------------------------------------------------------------------------------
+// Load command buffer
+// NOTE: Only CPU memory is allocated, it can be loaded from any thread
+rlCommandBuffer rlLoadCommandBuffer(int vertexCapacity)
+{
+    rlCommandBuffer buffer = { 0 };
+
+    if (vertexCapacity <= 0) vertexCapacity = 4*RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+
+    buffer.vertexCapacity = vertexCapacity;
+    buffer.vertices = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    buffer.texcoords = (float *)RL_MALLOC(vertexCapacity*2*sizeof(float));
+    buffer.normals = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    buffer.colors = (unsigned char *)RL_MALLOC(vertexCapacity*4*sizeof(unsigned char));
+
+    buffer.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;
+    buffer.draws = (rlDrawCall *)RL_MALLOC(buffer.drawCapacity*sizeof(rlDrawCall));
+
+    rlBeginCommandBuffer(&buffer);      // Reset recording state
+    rlEndCommandBuffer();
+
+    return buffer;
+}
+
+// Unload command buffer
+void rlUnloadCommandBuffer(rlCommandBuffer buffer)
+{
+    RL_FREE(buffer.vertices);
+    RL_FREE(buffer.texcoords);
+    RL_FREE(buffer.normals);
+    RL_FREE(buffer.colors);
+    RL_FREE(buffer.draws);
+}
+
+// Reset command buffer and start recording on calling thread
+// NOTE: Until rlEndCommandBuffer() is called, vertex level functions called from this thread
+// (rlBegin, rlVertex*, rlTexCoord2f, rlNormal3f, rlColor*, rlSetTexture, rlPushMatrix...)
+// are recorded into the buffer, other state changes (shaders, blending, scissor...) are not
+// recorded and must be set by the GL context thread around rlSubmitCommandBuffer()
+void rlBeginCommandBuffer(rlCommandBuffer *buffer)
+{
+    buffer->vertexCount = 0;
+    buffer->drawCounter = 1;
+    buffer->draws[0].mode = RL_QUADS;
+    buffer->draws[0].vertexCount = 0;
+    buffer->draws[0].vertexAlignment = 0;
+    buffer->draws[0].textureId = rlGetTextureIdDefault();
+    buffer->currentDepth = -1.0f;
+
+    buffer->texcoordx = 0.0f;
+    buffer->texcoordy = 0.0f;
+    buffer->normalx = 0.0f;
+    buffer->normaly = 0.0f;
+    buffer->normalz = 1.0f;
+    buffer->colorr = 255;
+    buffer->colorg = 255;
+    buffer->colorb = 255;
+    buffer->colora = 255;
+    buffer->transform = rlMatrixIdentity();
+    buffer->transformRequired = false;
+    buffer->stackCounter = 0;
+
+    rlRecordingBuffer = buffer;
+}
+
+// Stop recording on calling thread
+// NOTE: Recorded draws count is logged in debug mode, untextured shapes are expected to share draws
+void rlEndCommandBuffer(void)
+{
+    if (rlRecordingBuffer != NULL) TRACELOGD("RLGL: Command buffer recorded (%i vertices, %i draws)", rlRecordingBuffer->vertexCount, rlRecordingBuffer->drawCounter);
+
+    rlRecordingBuffer = NULL;
+}
+
+// Submit recorded command buffer
+// NOTE: Must be called from the thread owning the GL context, command buffers are drawn in
+// the order they are submitted, after any vertex data already pending on the active batch
+void rlSubmitCommandBuffer(const rlCommandBuffer *buffer)
+{
+    if ((buffer == NULL) || (buffer->vertexCount == 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Draw pending vertex data to keep drawing order, active batch is reset
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    rlRenderBatch *batch = RLGL.currentBatch;
+
+    // Copy command buffer draws into the batch, one buffers update + draw per batch filled
+    // NOTE: Draws come aligned from recording, batch is empty on every copy start so
+    // alignment is preserved, draws larger than batch are split on primitive boundaries
+    int drawIndex = 0;          // Current command buffer draw
+    int drawProcessed = 0;      // Vertex already processed from current draw
+    int drawOffset = 0;         // Current draw first vertex offset in command buffer
+
+    while (drawIndex < buffer->drawCounter)
+    {
+        rlVertexBuffer *vertexBuffer = &batch->vertexBuffer[batch->currentBuffer];
+        int maxVertexCount = vertexBuffer->elementCount*4;
+        int vertexCounter = 0;
+        int drawCounter = 0;
+        bool batchFull = false;
+
+        while (!batchFull && (drawIndex < buffer->drawCounter) && (drawCounter < RL_DEFAULT_BATCH_DRAWCALLS))
+        {
+            const rlDrawCall *draw = &buffer->draws[drawIndex];
+            int count = draw->vertexCount - drawProcessed;
+            int alignment = draw->vertexAlignment;
+
+            if (count > (maxVertexCount - vertexCounter))
+            {
+                // Split draw, 12 vertex multiple keeps LINES, TRIANGLES and QUADS primitives complete
+                count = ((maxVertexCount - vertexCounter)/12)*12;
+                alignment = 0;
+                batchFull = true;
+            }
+            else if ((count + alignment) > (maxVertexCount - vertexCounter))
+            {
+                alignment = 0;
+                batchFull = true;
+            }
+
+            if (count > 0)
+            {
+                int src = drawOffset + drawProcessed;
+
+                memcpy(vertexBuffer->vertices + 3*vertexCounter, buffer->vertices + 3*src, count*3*sizeof(float));
+                memcpy(vertexBuffer->texcoords + 2*vertexCounter, buffer->texcoords + 2*src, count*2*sizeof(float));
+                memcpy(vertexBuffer->normals + 3*vertexCounter, buffer->normals + 3*src, count*3*sizeof(float));
+                memcpy(vertexBuffer->colors + 4*vertexCounter, buffer->colors + 4*src, count*4*sizeof(unsigned char));
+
+                batch->draws[drawCounter].mode = draw->mode;
+                batch->draws[drawCounter].vertexCount = count;
+                batch->draws[drawCounter].vertexAlignment = alignment;
+                batch->draws[drawCounter].textureId = draw->textureId;
+
+                vertexCounter += (count + alignment);
+                drawProcessed += count;
+                drawCounter++;
+            }
+
+            if (drawProcessed >= draw->vertexCount)
+            {
+                drawOffset += (draw->vertexCount + draw->vertexAlignment);
+                drawProcessed = 0;
+                drawIndex++;
+            }
+        }
+
+        if (drawCounter > 0)
+        {
+            batch->drawCounter = drawCounter;
+            RLGL.State.vertexCounter = vertexCounter;
+            rlDrawRenderBatch(batch);
+        }
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_11)
+    // Replay recorded vertex data, transformations were already applied on recording
+    for (int i = 0, vertexOffset = 0; i < buffer->drawCounter; i++)
+    {
+        const rlDrawCall *draw = &buffer->draws[i];
+
+        if (draw->vertexCount > 0)
+        {
+            rlSetTexture(draw->textureId);
+            rlBegin(draw->mode);
+
+            for (int v = vertexOffset; v < (vertexOffset + draw->vertexCount); v++)
+            {
+                glColor4ub(buffer->colors[4*v], buffer->colors[4*v + 1], buffer->colors[4*v + 2], buffer->colors[4*v + 3]);
+                glTexCoord2f(buffer->texcoords[2*v], buffer->texcoords[2*v + 1]);
+                glNormal3f(buffer->normals[3*v], buffer->normals[3*v + 1], buffer->normals[3*v + 2]);
+                glVertex3f(buffer->vertices[3*v], buffer->vertices[3*v + 1], buffer->vertices[3*v + 2]);
+            }
+
+            rlEnd();
+        }
+
+        vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+    }
+
+    rlSetTexture(0);
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3378,6 +3860,16 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
     }
+#elif defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Software renderer has no renderbuffers, a depth texture is always used
+    (void)useRenderBuffer;
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D, id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth texture loaded successfully", id);
 #endif
 
     return id;
@@ -3662,7 +4154,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
     glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);
 
     // Clean up temporal fbo
     rlUnloadFramebuffer(fboId);
@@ -3710,7 +4202,9 @@ unsigned int rlLoadFramebuffer(void)
 
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);   // Unbind any framebuffer
+#elif defined(GRAPHICS_API_SOFTWARE)
+    swGenFramebuffers(1, &fboId);
 #endif
 
     return fboId;
@@ -3754,7 +4248,18 @@ void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType,
         default: break;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Only one color attachment is supported, renderbuffers are depth textures
+    unsigned int previousFboId = (unsigned int)rlGetActiveFramebuffer();
+    swBindFramebuffer(SW_FRAMEBUFFER, fboId);
+
+    if (attachType == RL_ATTACHMENT_COLOR_CHANNEL0) swFramebufferTexture2D(SW_FRAMEBUFFER, SW_COLOR_ATTACHMENT0, SW_TEXTURE_2D, texId, mipLevel);
+    else if (attachType == RL_ATTACHMENT_DEPTH) swFramebufferTexture2D(SW_FRAMEBUFFER, SW_DEPTH_ATTACHMENT, SW_TEXTURE_2D, texId, mipLevel);
+    else TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Attachment type not supported by software renderer", fboId);
+
+    (void)texType;
+    swBindFramebuffer(SW_FRAMEBUFFER, previousFboId);
 #endif
 }
 
@@ -3782,9 +4287,26 @@ bool rlFramebufferComplete(unsigned int id)
         }
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);
 
     result = (status == GL_FRAMEBUFFER_COMPLETE);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    unsigned int previousFboId = (unsigned int)rlGetActiveFramebuffer();
+    swBindFramebuffer(SW_FRAMEBUFFER, id);
+
+    int status = swCheckFramebufferStatus(SW_FRAMEBUFFER);
+
+    switch (status)
+    {
+        case SW_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+        case SW_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+        case SW_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+        default: break;
+    }
+
+    swBindFramebuffer(SW_FRAMEBUFFER, previousFboId);
+
+    result = (status == SW_FRAMEBUFFER_COMPLETE);
 #endif
 
     return result;
@@ -3812,10 +4334,29 @@ void rlUnloadFramebuffer(unsigned int id)
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.framebufferDefaultId);
     glDeleteFramebuffers(1, &id);
 
     TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#elif defined(GRAPHICS_API_SOFTWARE)
+    // NOTE: Depth attachment is deleted, color attachment is unloaded by the caller (same as OpenGL path)
+    unsigned int depthId = 0;
+    swGetFramebufferAttachments(id, NULL, &depthId);
+    if (depthId != 0) swDeleteTextures(1, &depthId);
+
+    swDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from memory (software)", id);
+#endif
+}
+
+// Set default framebuffer, bound when rendering to texture is disabled
+// NOTE: Used by platforms without window framebuffer (offscreen), 0 binds window framebuffer
+void rlSetFramebufferDefault(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    RLGL.State.framebufferDefaultId = id;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
 }
 
@@ -3959,7 +4500,7 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
 void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    glDrawArraysInstanced(GL_TRIANGLES, offset, count, instances);
 #endif
 }
 
@@ -4468,6 +5009,14 @@ void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned
 #endif
 }
 
+// Make compute shader SSBO writes visible to following shader reads
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+#endif
+}
+
 // Load shader storage buffer object (SSBO)
 unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
 {
@@ -5121,6 +5670,197 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+// Record drawing mode, equivalent to rlBegin() over command buffer
+static void rlRecordBegin(rlCommandBuffer *buffer, int mode)
+{
+    rlDrawCall *draw = &buffer->draws[buffer->drawCounter - 1];
+
+    if (draw->mode != mode)
+    {
+        if (draw->vertexCount > 0)
+        {
+            rlRecordNextDraw(buffer);
+            draw = &buffer->draws[buffer->drawCounter - 1];
+        }
+
+        draw->mode = mode;
+        draw->vertexCount = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        draw->textureId = rlGetTextureIdDefault();
+#endif
+    }
+}
+
+// Record texture change, equivalent to rlSetTexture() over command buffer
+static void rlRecordSetTexture(rlCommandBuffer *buffer, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Current texture is kept (same as rlSetTexture()), untextured shapes stay in current draw
+    if (id == 0) return;
+#else
+    if (id == 0) id = rlGetTextureIdDefault();
+#endif
+
+    rlDrawCall *draw = &buffer->draws[buffer->drawCounter - 1];
+
+    if (draw->textureId != id)
+    {
+        if (draw->vertexCount > 0)
+        {
+            rlRecordNextDraw(buffer);
+            draw = &buffer->draws[buffer->drawCounter - 1];
+        }
+
+        draw->textureId = id;
+        draw->vertexCount = 0;
+    }
+}
+
+// Record one vertex with current texcoord, normal and color
+static void rlRecordVertex(rlCommandBuffer *buffer, float x, float y, float z)
+{
+    float tx = x;
+    float ty = y;
+    float tz = z;
+
+    // Transform provided vector if required
+    if (buffer->transformRequired)
+    {
+        tx = buffer->transform.m0*x + buffer->transform.m4*y + buffer->transform.m8*z + buffer->transform.m12;
+        ty = buffer->transform.m1*x + buffer->transform.m5*y + buffer->transform.m9*z + buffer->transform.m13;
+        tz = buffer->transform.m2*x + buffer->transform.m6*y + buffer->transform.m10*z + buffer->transform.m14;
+    }
+
+    if (buffer->vertexCount >= buffer->vertexCapacity) rlRecordReserve(buffer, 1);
+
+    int i = buffer->vertexCount;
+
+    buffer->vertices[3*i] = tx;
+    buffer->vertices[3*i + 1] = ty;
+    buffer->vertices[3*i + 2] = tz;
+    buffer->texcoords[2*i] = buffer->texcoordx;
+    buffer->texcoords[2*i + 1] = buffer->texcoordy;
+    buffer->normals[3*i] = buffer->normalx;
+    buffer->normals[3*i + 1] = buffer->normaly;
+    buffer->normals[3*i + 2] = buffer->normalz;
+    buffer->colors[4*i] = buffer->colorr;
+    buffer->colors[4*i + 1] = buffer->colorg;
+    buffer->colors[4*i + 2] = buffer->colorb;
+    buffer->colors[4*i + 3] = buffer->colora;
+
+    buffer->vertexCount++;
+    buffer->draws[buffer->drawCounter - 1].vertexCount++;
+}
+
+// Set current normal, transformed and normalized
+static void rlRecordNormal(rlCommandBuffer *buffer, float x, float y, float z)
+{
+    float normalx = x;
+    float normaly = y;
+    float normalz = z;
+
+    if (buffer->transformRequired)
+    {
+        normalx = buffer->transform.m0*x + buffer->transform.m4*y + buffer->transform.m8*z;
+        normaly = buffer->transform.m1*x + buffer->transform.m5*y + buffer->transform.m9*z;
+        normalz = buffer->transform.m2*x + buffer->transform.m6*y + buffer->transform.m10*z;
+    }
+
+    float length = sqrtf(normalx*normalx + normaly*normaly + normalz*normalz);
+    if (length != 0.0f)
+    {
+        float ilength = 1.0f/length;
+        normalx *= ilength;
+        normaly *= ilength;
+        normalz *= ilength;
+    }
+
+    buffer->normalx = normalx;
+    buffer->normaly = normaly;
+    buffer->normalz = normalz;
+}
+
+// Push current transform matrix into command buffer stack
+static void rlRecordPushMatrix(rlCommandBuffer *buffer)
+{
+    if (buffer->stackCounter >= RL_MAX_MATRIX_STACK_SIZE)
+    {
+        TRACELOG(RL_LOG_ERROR, "RLGL: Command buffer matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+        return;
+    }
+
+    buffer->stack[buffer->stackCounter] = buffer->transform;
+    buffer->stackCounter++;
+    buffer->transformRequired = true;
+}
+
+// Pop lattest pushed transform matrix from command buffer stack
+static void rlRecordPopMatrix(rlCommandBuffer *buffer)
+{
+    if (buffer->stackCounter > 0)
+    {
+        buffer->transform = buffer->stack[buffer->stackCounter - 1];
+        buffer->stackCounter--;
+    }
+}
+
+// Multiply command buffer transform matrix
+// NOTE: There is no modelview matrix on recording, any transformation is applied to recorded vertex
+static void rlRecordMultMatrix(rlCommandBuffer *buffer, Matrix mat)
+{
+    buffer->transform = rlMatrixMultiply(mat, buffer->transform);
+    buffer->transformRequired = true;
+}
+
+// Make sure command buffer vertex arrays can hold vCount more vertex
+static void rlRecordReserve(rlCommandBuffer *buffer, int vCount)
+{
+    if ((buffer->vertexCount + vCount) <= buffer->vertexCapacity) return;
+
+    int capacity = (buffer->vertexCapacity > 0)? buffer->vertexCapacity : 4*RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+    while (capacity < (buffer->vertexCount + vCount)) capacity *= 2;
+
+    buffer->vertices = (float *)RL_REALLOC(buffer->vertices, capacity*3*sizeof(float));
+    buffer->texcoords = (float *)RL_REALLOC(buffer->texcoords, capacity*2*sizeof(float));
+    buffer->normals = (float *)RL_REALLOC(buffer->normals, capacity*3*sizeof(float));
+    buffer->colors = (unsigned char *)RL_REALLOC(buffer->colors, capacity*4*sizeof(unsigned char));
+    buffer->vertexCapacity = capacity;
+}
+
+// Align current draw vertex count and start a new draw
+// NOTE: Same alignment rules than internal render batch, so QUADS indices processing
+// keeps aligned once command buffer data is copied into a batch
+static void rlRecordNextDraw(rlCommandBuffer *buffer)
+{
+    rlDrawCall *draw = &buffer->draws[buffer->drawCounter - 1];
+
+    if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+    else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+    else draw->vertexAlignment = 0;
+
+    rlRecordReserve(buffer, draw->vertexAlignment);
+    buffer->vertexCount += draw->vertexAlignment;
+
+    if (buffer->drawCounter >= buffer->drawCapacity)
+    {
+        buffer->drawCapacity *= 2;
+        buffer->draws = (rlDrawCall *)RL_REALLOC(buffer->draws, buffer->drawCapacity*sizeof(rlDrawCall));
+    }
+
+    unsigned int textureId = rlGetTextureIdDefault();
+#if defined(GRAPHICS_API_OPENGL_11)
+    textureId = draw->textureId;    // OpenGL 1.1 keeps texture enabled between glBegin() calls
+#endif
+
+    draw = &buffer->draws[buffer->drawCounter];
+    draw->mode = RL_QUADS;
+    draw->vertexCount = 0;
+    draw->vertexAlignment = 0;
+    draw->textureId = textureId;
+
+    buffer->drawCounter++;
+}
+
 // Auxiliar math functions
 
 // Get float array of matrix data
@@ -5187,6 +5927,76 @@ static Matrix rlMatrixMultiply(Matrix left, Matrix right)
     return result;
 }
 
+// Get translation matrix
+static Matrix rlMatrixTranslate(float x, float y, float z)
+{
+    Matrix result = {
+        1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return result;
+}
+
+// Get rotation matrix
+// NOTE: The provided angle must be in degrees
+static Matrix rlMatrixRotate(float angle, float x, float y, float z)
+{
+    Matrix result = rlMatrixIdentity();
+
+    // Axis vector (x, y, z) normalization
+    float lengthSquared = x*x + y*y + z*z;
+    if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
+    {
+        float inverseLength = 1.0f/sqrtf(lengthSquared);
+        x *= inverseLength;
+        y *= inverseLength;
+        z *= inverseLength;
+    }
+
+    // Rotation matrix generation
+    float sinres = sinf(DEG2RAD*angle);
+    float cosres = cosf(DEG2RAD*angle);
+    float t = 1.0f - cosres;
+
+    result.m0 = x*x*t + cosres;
+    result.m1 = y*x*t + z*sinres;
+    result.m2 = z*x*t - y*sinres;
+    result.m3 = 0.0f;
+
+    result.m4 = x*y*t - z*sinres;
+    result.m5 = y*y*t + cosres;
+    result.m6 = z*y*t + x*sinres;
+    result.m7 = 0.0f;
+
+    result.m8 = x*z*t + y*sinres;
+    result.m9 = y*z*t - x*sinres;
+    result.m10 = z*z*t + cosres;
+    result.m11 = 0.0f;
+
+    result.m12 = 0.0f;
+    result.m13 = 0.0f;
+    result.m14 = 0.0f;
+    result.m15 = 1.0f;
+
+    return result;
+}
+
+// Get scaling matrix
+static Matrix rlMatrixScale(float x, float y, float z)
+{
+    Matrix result = {
+        x, 0.0f, 0.0f, 0.0f,
+        0.0f, y, 0.0f, 0.0f,
+        0.0f, 0.0f, z, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return result;
+}
+
 // Transposes provided matrix
 static Matrix rlMatrixTranspose(Matrix mat)
 {
@@ -18,6 +18,10 @@
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_PARTICLES_SYSTEM
+*           Particles module is included (rparticles.h), simulation runs on compute shaders
+*           if OpenGL 4.3 is available or on CPU otherwise
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -115,6 +119,11 @@
     #endif
 #endif
 
+#if defined(SUPPORT_PARTICLES_SYSTEM)
+    #define RPARTICLES_IMPLEMENTATION
+    #include "rparticles.h"             // Particles system functionality
+#endif
+
 #if defined(_WIN32)
     #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
     #define CHDIR _chdir
@@ -132,20 +141,40 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MAX_THREADING_WORKERS
+    #define MAX_THREADING_WORKERS   16    // Max number of threads used by ParallelFor() and async loading
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Async model load request data, model is loaded by a worker thread
+// NOTE: Material textures are kept as images until main thread finish step, placeholder
+// textures reference them by index (texture.id = index + 1, texture.format = 0)
+typedef struct AsyncModelLoad {
+    char *fileName;                 // Model file name (stored after request data)
+    Model model;                    // Loaded model, meshes not uploaded
+    bool loaded;                    // Model loaded by worker (some formats require main thread loading)
+    Image *images;                  // Material images pending upload
+    int imageCount;                 // Material images count
+    Model *dstModel;                // Destination model
+} AsyncModelLoad;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static AsyncModelLoad *asyncModelLoads[MAX_THREADING_WORKERS] = { 0 };  // Model loaded by every async worker
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static Model LoadModelData(const char *fileName);          // Load model data from file, meshes not uploaded
+static Texture2D LoadModelTexture(Image image);             // Load model material texture (deferred on async workers)
+static void GetModelDirectoryPath(const char *fileName, char *dirPath, int size); // Get model directory path (thread-safe)
+static void LoadAsyncModel(void *userData);                 // Load model data (async load step, worker thread)
+static void FinishAsyncModel(void *userData);               // Upload model meshes and textures (async finish step, main thread)
+static void ReleaseAsyncModel(void *userData);              // Free loaded model data of cancelled load (async release step, main thread)
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
 #endif
@@ -1089,46 +1118,29 @@ void DrawGrid(int slices, float spacing)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
-    Model model = { 0 };
-
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_VOX)
-    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_M3D)
-    if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
-#endif
+    Model model = LoadModelData(fileName);
 
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    // Upload vertex data to GPU (static meshes)
+    for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
-    {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
-    }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+    return model;
+}
 
-    if (model.materialCount == 0)
-    {
-        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+// Load model from files asynchronously, file loading and parsing runs on a worker thread
+// NOTE: Model meshes and textures are uploaded and model is set by UpdateAsyncLoads(),
+// destination must remain valid until then; OBJ models are loaded on main thread (loader changes working directory)
+unsigned int LoadModelAsync(const char *fileName, Model *model)
+{
+    if ((fileName == NULL) || (model == NULL)) return 0;
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+    int length = (int)strlen(fileName);
+    AsyncModelLoad *request = (AsyncModelLoad *)RL_CALLOC(1, sizeof(AsyncModelLoad) + length + 1);
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-    }
+    request->fileName = (char *)(request + 1);
+    memcpy(request->fileName, fileName, length);
+    request->dstModel = model;
 
-    return model;
+    return LoadAsync(LoadAsyncModel, FinishAsyncModel, ReleaseAsyncModel, request);
 }
 
 // Load model from generated mesh
@@ -4222,6 +4234,178 @@ static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform
 }
 #endif
 
+// Load model data from file, meshes are not uploaded to GPU
+// NOTE: Material textures are loaded with LoadModelTexture(), deferred when running on async workers
+static Model LoadModelData(const char *fileName)
+{
+    Model model = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_M3D)
+    if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
+#endif
+
+    // Make sure model transform is set to identity matrix!
+    model.transform = MatrixIdentity();
+
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+
+    if (model.materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+
+        model.materialCount = 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();
+
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    }
+
+    return model;
+}
+
+// Load model material texture from image, image is not unloaded
+// NOTE: On async loading workers GPU upload is deferred, image is copied and a placeholder texture returned
+static Texture2D LoadModelTexture(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if (image.data == NULL) return texture;
+
+    int worker = GetAsyncWorkerIndex();
+    AsyncModelLoad *request = (worker >= 0)? asyncModelLoads[worker] : NULL;
+
+    if (request != NULL)
+    {
+        request->images = (Image *)RL_REALLOC(request->images, (request->imageCount + 1)*sizeof(Image));
+        request->images[request->imageCount] = ImageCopy(image);
+        request->imageCount++;
+
+        texture = (Texture2D){ request->imageCount, image.width, image.height, 1, 0 };
+    }
+    else texture = LoadTextureFromImage(image);
+
+    return texture;
+}
+
+// Get model directory path, used to load model resources (no trailing separator)
+// NOTE: Alternative to GetDirectoryPath() not using static memory, models can be loaded from async workers
+static void GetModelDirectoryPath(const char *fileName, char *dirPath, int size)
+{
+    int length = 0;
+
+    for (int i = 0; fileName[i] != '\0'; i++)
+    {
+        if ((fileName[i] == '/') || (fileName[i] == '\\')) length = i;
+    }
+
+    if ((length == 0) && (fileName[0] != '/') && (fileName[0] != '\\')) snprintf(dirPath, size, ".");
+    else snprintf(dirPath, size, "%.*s", length, fileName);
+}
+
+// Load model data (async load step, worker thread)
+static void LoadAsyncModel(void *userData)
+{
+    AsyncModelLoad *request = (AsyncModelLoad *)userData;
+
+    // OBJ loader changes process working directory, it can only run on main thread
+    if (IsFileExtension(request->fileName, ".obj")) return;
+
+    int worker = GetAsyncWorkerIndex();
+
+    if (worker >= 0) asyncModelLoads[worker] = request;
+    request->model = LoadModelData(request->fileName);
+    if (worker >= 0) asyncModelLoads[worker] = NULL;
+
+    request->loaded = true;
+}
+
+// Upload model meshes and textures (async finish step, main thread)
+static void FinishAsyncModel(void *userData)
+{
+    AsyncModelLoad *request = (AsyncModelLoad *)userData;
+
+    if (request->loaded)
+    {
+        Model model = request->model;
+
+        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+
+        // Replace placeholder textures by uploaded material images
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            if (model.materials[i].maps == NULL) continue;
+
+            for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
+            {
+                Texture2D *texture = &model.materials[i].maps[j].texture;
+
+                if ((texture->format == 0) && (texture->id > 0) && ((int)texture->id <= request->imageCount))
+                {
+                    *texture = LoadTextureFromImage(request->images[texture->id - 1]);
+                }
+            }
+        }
+
+        *request->dstModel = model;
+    }
+    else *request->dstModel = LoadModel(request->fileName);
+
+    for (int i = 0; i < request->imageCount; i++) UnloadImage(request->images[i]);
+    RL_FREE(request->images);
+    RL_FREE(request);
+}
+
+// Free loaded model data of cancelled load (async release step, main thread)
+// NOTE: Meshes are not uploaded, only CPU data is freed (UnloadModel() also releases GPU buffers)
+static void ReleaseAsyncModel(void *userData)
+{
+    AsyncModelLoad *request = (AsyncModelLoad *)userData;
+    Model model = request->model;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+
+        RL_FREE(mesh.vboId);
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.texcoords);
+        RL_FREE(mesh.normals);
+        RL_FREE(mesh.colors);
+        RL_FREE(mesh.tangents);
+        RL_FREE(mesh.texcoords2);
+        RL_FREE(mesh.indices);
+        RL_FREE(mesh.animVertices);
+        RL_FREE(mesh.animNormals);
+        RL_FREE(mesh.boneWeights);
+        RL_FREE(mesh.boneIds);
+        RL_FREE(mesh.boneMatrices);
+    }
+
+    for (int i = 0; i < model.materialCount; i++) RL_FREE(model.materials[i].maps);
+
+    RL_FREE(model.meshes);
+    RL_FREE(model.materials);
+    RL_FREE(model.meshMaterial);
+    RL_FREE(model.bones);
+    RL_FREE(model.bindPose);
+
+    for (int i = 0; i < request->imageCount; i++) UnloadImage(request->images[i]);
+    RL_FREE(request->images);
+    RL_FREE(request);
+}
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
 //
@@ -4582,7 +4766,8 @@ static Model LoadIQM(const char *fileName)
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return model;
 
-    const char *basePath = GetDirectoryPath(fileName);
+    char basePath[1024] = { 0 };
+    GetModelDirectoryPath(fileName, basePath, 1024);
 
     // Read IQM header
     IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
@@ -4628,7 +4813,12 @@ static Model LoadIQM(const char *fileName)
         memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
         model.materials[i] = LoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(TextFormat("%s/%s", basePath, material));
+        char texPath[2048] = { 0 };
+        snprintf(texPath, 2048, "%s/%s", basePath, material);
+
+        Image image = LoadImage(texPath);
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadModelTexture(image);
+        UnloadImage(image);
 
         model.meshMaterial[i] = i;
 
@@ -5149,7 +5339,9 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
         }
         else     // Check if image is provided as image path
         {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+            char imagePath[2048] = { 0 };
+            snprintf(imagePath, 2048, "%s/%s", texPath, cgltfImage->uri);
+            image = LoadImage(imagePath);
         }
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
@@ -5171,7 +5363,7 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
             (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
         RL_FREE(data);
     }
@@ -5330,7 +5522,8 @@ static Model LoadGLTF(const char *fileName)
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
+            char texPath[1024] = { 0 };
+            GetModelDirectoryPath(fileName, texPath, 1024);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5342,7 +5535,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
                     if (imAlbedo.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
+                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadModelTexture(imAlbedo);
                         UnloadImage(imAlbedo);
                     }
                 }
@@ -5358,7 +5551,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
                     if (imMetallicRoughness.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTexture(imMetallicRoughness);
                         UnloadImage(imMetallicRoughness);
                     }
 
@@ -5376,7 +5569,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
                     if (imNormal.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
+                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTexture(imNormal);
                         UnloadImage(imNormal);
                     }
                 }
@@ -5387,7 +5580,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
                     if (imOcclusion.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
+                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTexture(imOcclusion);
                         UnloadImage(imOcclusion);
                     }
                 }
@@ -5398,7 +5591,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
                     if (imEmissive.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
+                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTexture(imEmissive);
                         UnloadImage(imEmissive);
                     }
 
@@ -6636,12 +6829,12 @@ static Model LoadM3D(const char *fileName)
 
                             switch (prop->type)
                             {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTexture(image); break;
+                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTexture(image); break;
                                 default: break;
                             }
                         }
@@ -0,0 +1,949 @@
+/**********************************************************************************************
+*
+*   rparticles - Particle system with GPU simulation and rendering
+*
+*   FEATURES:
+*       - Multiple emitters per system, every emitter owns a fixed range of particles
+*       - Simulation: constant acceleration, linear drag, lifetime and stateless respawn
+*         (respawn values are generated hashing particle index and frame seed, no CPU work)
+*       - OpenGL 4.3: simulation runs on a compute shader over an SSBO and particles are
+*         drawn as instanced billboards reading the same SSBO, no CPU readback is involved
+*       - OpenGL 3.3/ES2/1.1: simulation runs on CPU using a SIMD update loop (SSE2/NEON),
+*         OpenGL 3.3 draws instanced billboards, other versions use the internal render batch
+*
+*   ADDITIONAL NOTES:
+*       Particles are camera-facing quads drawn with current blending and depth state, usually
+*       additive blending (BLEND_ADDITIVE) and disabled depth writes (rlDisableDepthMask()) are
+*       recommended for emissive particles. If no texture is provided, a soft disc is used
+*
+*       Particles are spawned progressively over the first emitter lifetime, a particle dies
+*       when its lifetime expires and it is respawned in the same update
+*
+*   CONFIGURATION:
+*       #define RPARTICLES_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*       #define RPARTICLES_NO_SIMD
+*           Disable SSE2/NEON code paths on CPU simulation, portable scalar code is used instead
+*
+*   DEPENDENCIES:
+*       - rlgl: OpenGL abstraction layer, compute shaders and SSBO support (OpenGL 4.3)
+*       - raymath: Matrix operations
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RPARTICLES_H
+#define RPARTICLES_H
+
+#include "raylib.h"         // Required for: Vector3, Color, Texture2D
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Particle emitter, spawn parameters for a range of particles
+typedef struct ParticleEmitter {
+    int particleCount;          // Number of particles owned by the emitter (fixed on system loading)
+    Vector3 position;           // Spawn position
+    Vector3 positionVariance;   // Spawn position variance (box half extents)
+    Vector3 velocity;           // Spawn velocity
+    Vector3 velocityVariance;   // Spawn velocity variance (per component)
+    Vector3 acceleration;       // Constant acceleration (gravity, wind...)
+    float drag;                 // Linear velocity damping (per second)
+    float lifetime;             // Particle lifetime in seconds
+    float lifetimeVariance;     // Particle lifetime variance in seconds
+    float sizeStart;            // Particle size on spawn
+    float sizeEnd;              // Particle size on death
+    Color colorStart;           // Particle color on spawn
+    Color colorEnd;             // Particle color on death
+} ParticleEmitter;
+
+// Particle system, particles data lives on GPU (compute shaders) or CPU memory
+typedef struct ParticleSystem {
+    int particleCount;          // Number of particles (sum of emitters particles)
+    int emitterCount;           // Number of emitters
+    ParticleEmitter *emitters;  // Emitters parameters
+    unsigned int seed;          // Respawn random seed, advanced on every update
+
+    float *data;                // CPU simulation: particles state (x, y, z, vx, vy, vz, age, lifetime arrays)
+    float *instances;           // CPU simulation: particles render data (x, y, z, size)
+    unsigned int *colors;       // CPU simulation: particles render colors (RGBA, 8bit per channel)
+
+    unsigned int computeId;     // Compute shader program id (0 if simulation runs on CPU)
+    unsigned int particleBuffer; // Particles SSBO id (GPU simulation)
+    unsigned int emitterBuffer; // Emitters SSBO id (GPU simulation)
+    unsigned int shaderId;      // Render shader program id
+    unsigned int vaoId;         // Render vertex array id
+    unsigned int vboId[2];      // Render vertex buffers id: quad corners, instances (CPU simulation)
+    unsigned int textureId;     // Default particle texture id (soft disc)
+    int locs[8];                // Shader locations
+} ParticleSystem;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+RLAPI ParticleSystem LoadParticleSystem(const ParticleEmitter *emitters, int emitterCount); // Load particle system from emitters (particles count is fixed)
+RLAPI bool IsParticleSystemValid(ParticleSystem system);                            // Check if a particle system is valid (loaded)
+RLAPI void UnloadParticleSystem(ParticleSystem system);                             // Unload particle system from memory (RAM and/or VRAM)
+RLAPI void UpdateParticleEmitter(ParticleSystem *system, int index, ParticleEmitter emitter); // Update emitter parameters (particles count can not change)
+RLAPI void UpdateParticleSystem(ParticleSystem *system, float deltaTime);           // Simulate particles for deltaTime seconds
+RLAPI void DrawParticleSystem(ParticleSystem system, Texture2D texture);            // Draw particles as camera-facing billboards (texture.id = 0: soft disc)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RPARTICLES_H
+
+/***********************************************************************************
+*
+*   PARTICLES IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RPARTICLES_IMPLEMENTATION)
+
+#include "rlgl.h"           // Required for: Compute shaders, SSBO, vertex arrays and render batch
+#include "raymath.h"        // Required for: MatrixMultiply()
+
+#include <stdlib.h>         // Required for: RL_MALLOC(), RL_CALLOC(), RL_FREE()
+#include <string.h>         // Required for: memcpy()
+#include <math.h>           // Required for: sqrtf()
+
+#if !defined(RPARTICLES_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RPARTICLES_SIMD_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define RPARTICLES_SIMD_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PARTICLES_COMPUTE_GROUP_SIZE      256       // Compute shader local size (must match shader code)
+#define PARTICLES_MAX_COUNT          16776960       // Maximum particles count (65535 compute groups)
+#define PARTICLES_TEXTURE_SIZE             32       // Default particle texture size
+
+// Particles state arrays stride (SIMD friendly)
+#define PARTICLES_CAPACITY(count)       ((((count) + 3)/4)*4)
+
+// Particles state arrays (CPU simulation)
+#define PARTICLES_POSITION_X                0
+#define PARTICLES_POSITION_Y                1
+#define PARTICLES_POSITION_Z                2
+#define PARTICLES_VELOCITY_X                3
+#define PARTICLES_VELOCITY_Y                4
+#define PARTICLES_VELOCITY_Z                5
+#define PARTICLES_AGE                       6
+#define PARTICLES_LIFETIME                  7
+
+// Shader locations
+#define PARTICLES_LOC_MATRIX_MODELVIEW      0
+#define PARTICLES_LOC_MATRIX_PROJECTION     1
+#define PARTICLES_LOC_TEXTURE               2
+#define PARTICLES_LOC_EMITTER_COUNT         3
+#define PARTICLES_LOC_COMPUTE_DELTA_TIME    4
+#define PARTICLES_LOC_COMPUTE_SEED          5
+#define PARTICLES_LOC_COMPUTE_PARTICLES     6
+#define PARTICLES_LOC_COMPUTE_EMITTERS      7
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Emitter data for shaders, std430 layout (must match shader code)
+typedef struct ParticleEmitterData {
+    float position[4];          // Spawn position
+    float positionVariance[4];  // Spawn position variance
+    float velocity[4];          // Spawn velocity
+    float velocityVariance[4];  // Spawn velocity variance
+    float acceleration[4];      // Acceleration (xyz) and drag (w)
+    float lifetime[4];          // Lifetime (x), lifetime variance (y), size start (z), size end (w)
+    float colorStart[4];        // Color on spawn (normalized)
+    float colorEnd[4];          // Color on death (normalized)
+    int range[4];               // First particle (x) and particles count (y)
+} ParticleEmitterData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Particles simulation compute shader (OpenGL 4.3)
+static const char *particlesComputeCode =
+    "#version 430                                           \n"
+    "layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in; \n"
+    "struct Particle { vec4 position; vec4 velocity; };     \n"
+    "struct Emitter { vec4 position; vec4 positionVariance; vec4 velocity; vec4 velocityVariance; \n"
+    "    vec4 acceleration; vec4 lifetime; vec4 colorStart; vec4 colorEnd; ivec4 range; };      \n"
+    "layout(std430, binding = 0) buffer ParticleBuffer { Particle particles[]; };              \n"
+    "layout(std430, binding = 1) readonly buffer EmitterBuffer { Emitter emitters[]; };        \n"
+    "uniform float deltaTime;                               \n"
+    "uniform uint seed;                                     \n"
+    "uniform int particleCount;                             \n"
+    "uniform int emitterCount;                              \n"
+    "uint Hash(uint v)                                      \n"
+    "{                                                      \n"
+    "    uint state = v*747796405u + 2891336453u;           \n"
+    "    uint word = ((state >> ((state >> 28u) + 4u)) ^ state)*277803737u; \n"
+    "    return (word >> 22u) ^ word;                       \n"
+    "}                                                      \n"
+    "float Random(inout uint state)                         \n"
+    "{                                                      \n"
+    "    state = Hash(state);                               \n"
+    "    return float(state >> 8u)*(1.0/16777216.0);        \n"
+    "}                                                      \n"
+    "void main()                                            \n"
+    "{                                                      \n"
+    "    int i = int(gl_GlobalInvocationID.x);              \n"
+    "    if (i >= particleCount) return;                    \n"
+    "    int e = 0;                                         \n"
+    "    while ((e < emitterCount - 1) && (i >= (emitters[e].range.x + emitters[e].range.y))) e++; \n"
+    "    vec4 position = particles[i].position;             \n"
+    "    vec4 velocity = particles[i].velocity;             \n"
+    "    float age = position.w + deltaTime;                \n"
+    "    if (age >= velocity.w)                             \n"
+    "    {                                                  \n"
+    "        uint state = Hash(uint(i) ^ seed);             \n"
+    "        float rx = Random(state)*2.0 - 1.0;            \n"
+    "        float ry = Random(state)*2.0 - 1.0;            \n"
+    "        float rz = Random(state)*2.0 - 1.0;            \n"
+    "        position.xyz = emitters[e].position.xyz + vec3(rx, ry, rz)*emitters[e].positionVariance.xyz; \n"
+    "        rx = Random(state)*2.0 - 1.0;                  \n"
+    "        ry = Random(state)*2.0 - 1.0;                  \n"
+    "        rz = Random(state)*2.0 - 1.0;                  \n"
+    "        velocity.xyz = emitters[e].velocity.xyz + vec3(rx, ry, rz)*emitters[e].velocityVariance.xyz; \n"
+    "        velocity.w = max(emitters[e].lifetime.x + (Random(state)*2.0 - 1.0)*emitters[e].lifetime.y, 0.001); \n"
+    "        age = 0.0;                                     \n"
+    "    }                                                  \n"
+    "    else if (age >= 0.0)                               \n"
+    "    {                                                  \n"
+    "        velocity.xyz = (velocity.xyz + emitters[e].acceleration.xyz*deltaTime)/(1.0 + emitters[e].acceleration.w*deltaTime); \n"
+    "        position.xyz += velocity.xyz*deltaTime;        \n"
+    "    }                                                  \n"
+    "    particles[i].position = vec4(position.xyz, age);   \n"
+    "    particles[i].velocity = velocity;                  \n"
+    "}                                                      \n";
+
+// Particles render vertex shader reading SSBO (OpenGL 4.3)
+static const char *particlesVertexCodeSSBO =
+    "#version 430                                           \n"
+    "struct Particle { vec4 position; vec4 velocity; };     \n"
+    "struct Emitter { vec4 position; vec4 positionVariance; vec4 velocity; vec4 velocityVariance; \n"
+    "    vec4 acceleration; vec4 lifetime; vec4 colorStart; vec4 colorEnd; ivec4 range; };      \n"
+    "layout(std430, binding = 0) readonly buffer ParticleBuffer { Particle particles[]; };     \n"
+    "layout(std430, binding = 1) readonly buffer EmitterBuffer { Emitter emitters[]; };        \n"
+    "uniform mat4 matModelView;                             \n"
+    "uniform mat4 matProjection;                            \n"
+    "uniform int emitterCount;                              \n"
+    "out vec2 fragTexCoord;                                 \n"
+    "out vec4 fragColor;                                    \n"
+    "const vec2 corners[12] = vec2[12](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5), \n"
+    "    vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(0.5, -0.5), vec2(-0.5, -0.5), vec2(-0.5, 0.5), vec2(0.5, 0.5)); \n"
+    "void main()                                            \n"
+    "{                                                      \n"
+    "    int i = gl_InstanceID;                             \n"
+    "    int e = 0;                                         \n"
+    "    while ((e < emitterCount - 1) && (i >= (emitters[e].range.x + emitters[e].range.y))) e++; \n"
+    "    vec4 position = particles[i].position;             \n"
+    "    float lifetime = particles[i].velocity.w;          \n"
+    "    float t = clamp(position.w/max(lifetime, 0.000001), 0.0, 1.0); \n"
+    "    float size = ((position.w >= 0.0) && (position.w < lifetime))? mix(emitters[e].lifetime.z, emitters[e].lifetime.w, t) : 0.0; \n"
+    "    vec2 corner = corners[gl_VertexID];                \n"
+    "    fragTexCoord = vec2(corner.x + 0.5, 0.5 - corner.y); \n"
+    "    fragColor = mix(emitters[e].colorStart, emitters[e].colorEnd, t); \n"
+    "    vec4 viewPosition = matModelView*vec4(position.xyz, 1.0); \n"
+    "    viewPosition.xy += corner*size;                    \n"
+    "    gl_Position = matProjection*viewPosition;          \n"
+    "}                                                      \n";
+
+// Particles render vertex shader reading instances attributes (OpenGL 3.3)
+static const char *particlesVertexCode =
+    "#version 330                                           \n"
+    "in vec2 vertexCorner;                                  \n"
+    "in vec4 instancePosition;                              \n"     // xyz: position, w: size
+    "in vec4 instanceColor;                                 \n"
+    "uniform mat4 matModelView;                             \n"
+    "uniform mat4 matProjection;                            \n"
+    "out vec2 fragTexCoord;                                 \n"
+    "out vec4 fragColor;                                    \n"
+    "void main()                                            \n"
+    "{                                                      \n"
+    "    fragTexCoord = vec2(vertexCorner.x + 0.5, 0.5 - vertexCorner.y); \n"
+    "    fragColor = instanceColor;                         \n"
+    "    vec4 viewPosition = matModelView*vec4(instancePosition.xyz, 1.0); \n"
+    "    viewPosition.xy += vertexCorner*instancePosition.w; \n"
+    "    gl_Position = matProjection*viewPosition;          \n"
+    "}                                                      \n";
+
+// Particles render fragment shader (OpenGL 3.3 and 4.3)
+#define PARTICLES_FRAGMENT_CODE \
+    "in vec2 fragTexCoord;                                  \n" \
+    "in vec4 fragColor;                                     \n" \
+    "uniform sampler2D texture0;                            \n" \
+    "out vec4 finalColor;                                   \n" \
+    "void main()                                            \n" \
+    "{                                                      \n" \
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n" \
+    "}                                                      \n"
+
+static const char *particlesFragmentCode = "#version 330\n" PARTICLES_FRAGMENT_CODE;
+static const char *particlesFragmentCodeSSBO = "#version 430\n" PARTICLES_FRAGMENT_CODE;
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int ParticleHash(unsigned int value);                       // Hash value (PCG), same as shader Hash()
+static float ParticleRandom(unsigned int *state);                           // Get random value in range [0..1), same as shader Random()
+static ParticleEmitterData GetParticleEmitterData(ParticleEmitter emitter, int first); // Get emitter data for shaders
+static void RespawnParticle(ParticleSystem *system, const ParticleEmitter *emitter, int index, unsigned int seed); // Respawn particle (CPU simulation)
+static void UpdateParticlesCPU(ParticleSystem *system, int emitterIndex, int first, float deltaTime, unsigned int seed); // Simulate emitter particles (CPU simulation)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load particle system from emitters
+// NOTE: Simulation runs on GPU if compute shaders are available (OpenGL 4.3), on CPU otherwise
+ParticleSystem LoadParticleSystem(const ParticleEmitter *emitters, int emitterCount)
+{
+    ParticleSystem system = { 0 };
+
+    if ((emitters == NULL) || (emitterCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particle system, no emitters provided");
+        return system;
+    }
+
+    system.emitterCount = emitterCount;
+    system.emitters = (ParticleEmitter *)RL_MALLOC(emitterCount*sizeof(ParticleEmitter));
+    memcpy(system.emitters, emitters, emitterCount*sizeof(ParticleEmitter));
+
+    for (int e = 0; e < emitterCount; e++)
+    {
+        if (system.emitters[e].particleCount < 0) system.emitters[e].particleCount = 0;
+        if ((system.particleCount + system.emitters[e].particleCount) > PARTICLES_MAX_COUNT)
+        {
+            TRACELOG(LOG_WARNING, "PARTICLES: Maximum particles count reached (%i), emitter [%i] particles clamped", PARTICLES_MAX_COUNT, e);
+            system.emitters[e].particleCount = PARTICLES_MAX_COUNT - system.particleCount;
+        }
+
+        system.particleCount += system.emitters[e].particleCount;
+    }
+
+    if (system.particleCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particle system, no particles defined");
+        RL_FREE(system.emitters);
+        system.emitters = NULL;
+        system.emitterCount = 0;
+        return system;
+    }
+
+    // Initial state: particles are unborn (negative age) and spawn progressively along first lifetime
+    // NOTE: Zero lifetime forces a respawn as soon as particle age reaches 0
+    int capacity = PARTICLES_CAPACITY(system.particleCount);
+    float *data = (float *)RL_CALLOC(8*capacity, sizeof(float));
+    unsigned int state = ParticleHash(system.particleCount);
+
+    for (int e = 0, first = 0; e < emitterCount; e++)
+    {
+        for (int i = first; i < (first + system.emitters[e].particleCount); i++)
+        {
+            data[PARTICLES_POSITION_X*capacity + i] = system.emitters[e].position.x;
+            data[PARTICLES_POSITION_Y*capacity + i] = system.emitters[e].position.y;
+            data[PARTICLES_POSITION_Z*capacity + i] = system.emitters[e].position.z;
+            data[PARTICLES_AGE*capacity + i] = -ParticleRandom(&state)*system.emitters[e].lifetime;
+        }
+
+        first += system.emitters[e].particleCount;
+    }
+
+    // Default particle texture: white soft disc
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(PARTICLES_TEXTURE_SIZE*PARTICLES_TEXTURE_SIZE*4);
+    for (int y = 0; y < PARTICLES_TEXTURE_SIZE; y++)
+    {
+        for (int x = 0; x < PARTICLES_TEXTURE_SIZE; x++)
+        {
+            float dx = ((float)x + 0.5f)/(PARTICLES_TEXTURE_SIZE*0.5f) - 1.0f;
+            float dy = ((float)y + 0.5f)/(PARTICLES_TEXTURE_SIZE*0.5f) - 1.0f;
+            float alpha = 1.0f - sqrtf(dx*dx + dy*dy);
+            if (alpha < 0.0f) alpha = 0.0f;
+
+            unsigned char *pixel = pixels + 4*(y*PARTICLES_TEXTURE_SIZE + x);
+            pixel[0] = 255;
+            pixel[1] = 255;
+            pixel[2] = 255;
+            pixel[3] = (unsigned char)(alpha*alpha*(3.0f - 2.0f*alpha)*255.0f);
+        }
+    }
+    system.textureId = rlLoadTexture(pixels, PARTICLES_TEXTURE_SIZE, PARTICLES_TEXTURE_SIZE, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    RL_FREE(pixels);
+
+    // Try GPU simulation, compute shaders required
+    if (rlGetVersion() == RL_OPENGL_43)
+    {
+        unsigned int computeShader = rlCompileShader(particlesComputeCode, RL_COMPUTE_SHADER);
+        if (computeShader > 0) system.computeId = rlLoadComputeShaderProgram(computeShader);
+
+        if (system.computeId > 0) system.shaderId = rlLoadShaderCode(particlesVertexCodeSSBO, particlesFragmentCodeSSBO);
+
+        if ((system.computeId > 0) && (system.shaderId > 0))
+        {
+            // Particles SSBO in std430 layout: position (xyz + age), velocity (xyz + lifetime)
+            float *particles = (float *)RL_MALLOC(system.particleCount*8*sizeof(float));
+            for (int i = 0; i < system.particleCount; i++)
+            {
+                particles[8*i] = data[PARTICLES_POSITION_X*capacity + i];
+                particles[8*i + 1] = data[PARTICLES_POSITION_Y*capacity + i];
+                particles[8*i + 2] = data[PARTICLES_POSITION_Z*capacity + i];
+                particles[8*i + 3] = data[PARTICLES_AGE*capacity + i];
+                particles[8*i + 4] = data[PARTICLES_VELOCITY_X*capacity + i];
+                particles[8*i + 5] = data[PARTICLES_VELOCITY_Y*capacity + i];
+                particles[8*i + 6] = data[PARTICLES_VELOCITY_Z*capacity + i];
+                particles[8*i + 7] = data[PARTICLES_LIFETIME*capacity + i];
+            }
+
+            system.particleBuffer = rlLoadShaderBuffer(system.particleCount*8*sizeof(float), particles, RL_DYNAMIC_COPY);
+            RL_FREE(particles);
+
+            ParticleEmitterData *emitterData = (ParticleEmitterData *)RL_MALLOC(emitterCount*sizeof(ParticleEmitterData));
+            for (int e = 0, first = 0; e < emitterCount; e++)
+            {
+                emitterData[e] = GetParticleEmitterData(system.emitters[e], first);
+                first += system.emitters[e].particleCount;
+            }
+
+            system.emitterBuffer = rlLoadShaderBuffer(emitterCount*sizeof(ParticleEmitterData), emitterData, RL_DYNAMIC_DRAW);
+            RL_FREE(emitterData);
+
+            system.locs[PARTICLES_LOC_COMPUTE_DELTA_TIME] = rlGetLocationUniform(system.computeId, "deltaTime");
+            system.locs[PARTICLES_LOC_COMPUTE_SEED] = rlGetLocationUniform(system.computeId, "seed");
+            system.locs[PARTICLES_LOC_COMPUTE_PARTICLES] = rlGetLocationUniform(system.computeId, "particleCount");
+            system.locs[PARTICLES_LOC_COMPUTE_EMITTERS] = rlGetLocationUniform(system.computeId, "emitterCount");
+
+            // Empty vertex array, vertex shader reads particles from SSBO
+            system.vaoId = rlLoadVertexArray();
+        }
+        else
+        {
+            if (system.computeId > 0) rlUnloadShaderProgram(system.computeId);
+            system.computeId = 0;
+
+            TRACELOG(LOG_WARNING, "PARTICLES: Failed to load compute shaders, using CPU simulation");
+        }
+    }
+
+    if (system.computeId == 0)
+    {
+        system.data = data;
+        system.instances = (float *)RL_CALLOC(4*capacity, sizeof(float));
+        system.colors = (unsigned int *)RL_CALLOC(capacity, sizeof(unsigned int));
+        data = NULL;
+
+        // Instanced billboards require OpenGL 3.3, other versions draw through render batch
+        if ((rlGetVersion() == RL_OPENGL_33) || (rlGetVersion() == RL_OPENGL_43))
+        {
+            system.shaderId = rlLoadShaderCode(particlesVertexCode, particlesFragmentCode);
+
+            if (system.shaderId > 0)
+            {
+                // NOTE: Quad corners are stored twice, counter-clockwise and clockwise, see DrawParticleSystem()
+                const float corners[24] = { -0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f,
+                                            -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, -0.5f, -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f };
+                int locCorner = rlGetLocationAttrib(system.shaderId, "vertexCorner");
+                int locPosition = rlGetLocationAttrib(system.shaderId, "instancePosition");
+                int locColor = rlGetLocationAttrib(system.shaderId, "instanceColor");
+
+                system.vaoId = rlLoadVertexArray();
+                rlEnableVertexArray(system.vaoId);
+
+                system.vboId[0] = rlLoadVertexBuffer(corners, sizeof(corners), false);
+                rlSetVertexAttribute(locCorner, 2, RL_FLOAT, false, 0, 0);
+                rlEnableVertexAttribute(locCorner);
+
+                // Instances buffer: positions + size for all particles, followed by colors
+                system.vboId[1] = rlLoadVertexBuffer(NULL, system.particleCount*(4*sizeof(float) + sizeof(unsigned int)), true);
+                rlSetVertexAttribute(locPosition, 4, RL_FLOAT, false, 0, 0);
+                rlEnableVertexAttribute(locPosition);
+                rlSetVertexAttributeDivisor(locPosition, 1);
+                rlSetVertexAttribute(locColor, 4, RL_UNSIGNED_BYTE, true, 0, system.particleCount*4*sizeof(float));
+                rlEnableVertexAttribute(locColor);
+                rlSetVertexAttributeDivisor(locColor, 1);
+
+                rlDisableVertexArray();
+            }
+        }
+    }
+
+    if (system.shaderId > 0)
+    {
+        system.locs[PARTICLES_LOC_MATRIX_MODELVIEW] = rlGetLocationUniform(system.shaderId, "matModelView");
+        system.locs[PARTICLES_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(system.shaderId, "matProjection");
+        system.locs[PARTICLES_LOC_TEXTURE] = rlGetLocationUniform(system.shaderId, "texture0");
+        system.locs[PARTICLES_LOC_EMITTER_COUNT] = rlGetLocationUniform(system.shaderId, "emitterCount");
+    }
+
+    RL_FREE(data);
+
+    TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (%i particles, %i emitters, %s simulation)", system.particleCount, system.emitterCount, (system.computeId > 0)? "GPU" : "CPU");
+
+    return system;
+}
+
+// Check if a particle system is valid (loaded)
+bool IsParticleSystemValid(ParticleSystem system)
+{
+    return ((system.particleCount > 0) &&       // Particles defined
+            (system.emitters != NULL) &&        // Emitters loaded
+            ((system.computeId > 0) || (system.data != NULL))); // Simulation data available
+}
+
+// Unload particle system from memory (RAM and/or VRAM)
+void UnloadParticleSystem(ParticleSystem system)
+{
+    if (system.computeId > 0) rlUnloadShaderProgram(system.computeId);
+    if (system.particleBuffer > 0) rlUnloadShaderBuffer(system.particleBuffer);
+    if (system.emitterBuffer > 0) rlUnloadShaderBuffer(system.emitterBuffer);
+    if (system.shaderId > 0) rlUnloadShaderProgram(system.shaderId);
+    if (system.vaoId > 0) rlUnloadVertexArray(system.vaoId);
+    if (system.vboId[0] > 0) rlUnloadVertexBuffer(system.vboId[0]);
+    if (system.vboId[1] > 0) rlUnloadVertexBuffer(system.vboId[1]);
+    if (system.textureId > 0) rlUnloadTexture(system.textureId);
+
+    RL_FREE(system.emitters);
+    RL_FREE(system.data);
+    RL_FREE(system.instances);
+    RL_FREE(system.colors);
+}
+
+// Update emitter parameters
+// NOTE: Particles count is fixed on loading, already spawned particles are not modified
+void UpdateParticleEmitter(ParticleSystem *system, int index, ParticleEmitter emitter)
+{
+    if ((index < 0) || (index >= system->emitterCount)) return;
+
+    if (emitter.particleCount != system->emitters[index].particleCount)
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Emitter [%i] particles count can not be changed", index);
+        emitter.particleCount = system->emitters[index].particleCount;
+    }
+
+    system->emitters[index] = emitter;
+
+    if (system->emitterBuffer > 0)
+    {
+        int first = 0;
+        for (int e = 0; e < index; e++) first += system->emitters[e].particleCount;
+
+        ParticleEmitterData emitterData = GetParticleEmitterData(emitter, first);
+        rlUpdateShaderBuffer(system->emitterBuffer, &emitterData, sizeof(ParticleEmitterData), index*sizeof(ParticleEmitterData));
+    }
+}
+
+// Simulate particles for deltaTime seconds
+void UpdateParticleSystem(ParticleSystem *system, float deltaTime)
+{
+    if (!IsParticleSystemValid(*system)) return;
+
+    system->seed++;
+    unsigned int seed = ParticleHash(system->seed);
+
+    if (system->computeId > 0)
+    {
+        // Draw pending batch vertex data before dispatching
+        rlDrawRenderBatchActive();
+
+        rlEnableShader(system->computeId);
+        rlSetUniform(system->locs[PARTICLES_LOC_COMPUTE_DELTA_TIME], &deltaTime, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(system->locs[PARTICLES_LOC_COMPUTE_SEED], &seed, RL_SHADER_UNIFORM_UINT, 1);
+        rlSetUniform(system->locs[PARTICLES_LOC_COMPUTE_PARTICLES], &system->particleCount, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(system->locs[PARTICLES_LOC_COMPUTE_EMITTERS], &system->emitterCount, RL_SHADER_UNIFORM_INT, 1);
+        rlBindShaderBuffer(system->particleBuffer, 0);
+        rlBindShaderBuffer(system->emitterBuffer, 1);
+        rlComputeShaderDispatch((system->particleCount + PARTICLES_COMPUTE_GROUP_SIZE - 1)/PARTICLES_COMPUTE_GROUP_SIZE, 1, 1);
+        rlComputeShaderBarrier();   // Particles written by compute shader are read by vertex shader
+        rlDisableShader();
+    }
+    else
+    {
+        for (int e = 0, first = 0; e < system->emitterCount; e++)
+        {
+            UpdateParticlesCPU(system, e, first, deltaTime, seed);
+            first += system->emitters[e].particleCount;
+        }
+
+        // Upload render data for instanced drawing
+        if (system->vboId[1] > 0)
+        {
+            rlUpdateVertexBuffer(system->vboId[1], system->instances, system->particleCount*4*sizeof(float), 0);
+            rlUpdateVertexBuffer(system->vboId[1], system->colors, system->particleCount*sizeof(unsigned int), system->particleCount*4*sizeof(float));
+        }
+    }
+}
+
+// Draw particles as camera-facing billboards
+// NOTE: Current modelview matrix defines the view, billboards face the camera in 3d and 2d modes;
+// quads winding is reversed for projections flipping y axis (2d mode), so culling state is not changed
+void DrawParticleSystem(ParticleSystem system, Texture2D texture)
+{
+    if (!IsParticleSystemValid(system)) return;
+
+    unsigned int textureId = (texture.id > 0)? texture.id : system.textureId;
+    Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix matProjection = rlGetMatrixProjection();
+    bool clockwise = ((matProjection.m0*matProjection.m5) < 0.0f);
+
+    if (system.shaderId > 0)
+    {
+        int textureSlot = 0;
+
+        // Draw pending batch vertex data before drawing particles
+        rlDrawRenderBatchActive();
+
+        rlEnableShader(system.shaderId);
+        rlSetUniformMatrix(system.locs[PARTICLES_LOC_MATRIX_MODELVIEW], matModelView);
+        rlSetUniformMatrix(system.locs[PARTICLES_LOC_MATRIX_PROJECTION], matProjection);
+        rlSetUniform(system.locs[PARTICLES_LOC_TEXTURE], &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+
+        if (system.computeId > 0)
+        {
+            rlSetUniform(system.locs[PARTICLES_LOC_EMITTER_COUNT], &system.emitterCount, RL_SHADER_UNIFORM_INT, 1);
+            rlBindShaderBuffer(system.particleBuffer, 0);
+            rlBindShaderBuffer(system.emitterBuffer, 1);
+        }
+
+        rlActiveTextureSlot(textureSlot);
+        rlEnableTexture(textureId);
+        rlEnableVertexArray(system.vaoId);
+
+        // Clockwise corners are stored after counter-clockwise ones
+        rlDrawVertexArrayInstanced(clockwise? 6 : 0, 6, system.particleCount);
+
+        rlDisableVertexArray();
+        rlDisableTexture();
+        rlDisableShader();
+    }
+    else
+    {
+        // Billboards drawn through render batch, quads axis from view matrix
+        Vector3 right = { matModelView.m0, matModelView.m4, matModelView.m8 };
+        Vector3 up = { matModelView.m1, matModelView.m5, matModelView.m9 };
+
+        // Quad corners as right and up axis signs, counter-clockwise and clockwise
+        const float corners[2][8] = { { -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f }, { -1.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f } };
+        const float *corner = corners[clockwise? 1 : 0];
+
+        rlSetTexture(textureId);
+        rlBegin(RL_QUADS);
+
+        for (int i = 0; i < system.particleCount; i++)
+        {
+            float halfSize = system.instances[4*i + 3]*0.5f;
+            if (halfSize <= 0.0f) continue;
+
+            Vector3 position = { system.instances[4*i], system.instances[4*i + 1], system.instances[4*i + 2] };
+            Vector3 rx = { right.x*halfSize, right.y*halfSize, right.z*halfSize };
+            Vector3 uy = { up.x*halfSize, up.y*halfSize, up.z*halfSize };
+            const unsigned char *color = (const unsigned char *)&system.colors[i];
+
+            rlColor4ub(color[0], color[1], color[2], color[3]);
+
+            for (int k = 0; k < 4; k++)
+            {
+                float sx = corner[2*k];
+                float sy = corner[2*k + 1];
+
+                rlTexCoord2f((sx + 1.0f)*0.5f, (1.0f - sy)*0.5f);
+                rlVertex3f(position.x + rx.x*sx + uy.x*sy, position.y + rx.y*sx + uy.y*sy, position.z + rx.z*sx + uy.z*sy);
+            }
+        }
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Hash value (PCG), same as shader Hash()
+static unsigned int ParticleHash(unsigned int value)
+{
+    unsigned int state = value*747796405u + 2891336453u;
+    unsigned int word = ((state >> ((state >> 28u) + 4u)) ^ state)*277803737u;
+
+    return (word >> 22u) ^ word;
+}
+
+// Get random value in range [0..1), same as shader Random()
+static float ParticleRandom(unsigned int *state)
+{
+    *state = ParticleHash(*state);
+
+    return (float)(*state >> 8)*(1.0f/16777216.0f);
+}
+
+// Get emitter data for shaders
+static ParticleEmitterData GetParticleEmitterData(ParticleEmitter emitter, int first)
+{
+    ParticleEmitterData data = {
+        .position = { emitter.position.x, emitter.position.y, emitter.position.z, 0.0f },
+        .positionVariance = { emitter.positionVariance.x, emitter.positionVariance.y, emitter.positionVariance.z, 0.0f },
+        .velocity = { emitter.velocity.x, emitter.velocity.y, emitter.velocity.z, 0.0f },
+        .velocityVariance = { emitter.velocityVariance.x, emitter.velocityVariance.y, emitter.velocityVariance.z, 0.0f },
+        .acceleration = { emitter.acceleration.x, emitter.acceleration.y, emitter.acceleration.z, emitter.drag },
+        .lifetime = { emitter.lifetime, emitter.lifetimeVariance, emitter.sizeStart, emitter.sizeEnd },
+        .colorStart = { emitter.colorStart.r/255.0f, emitter.colorStart.g/255.0f, emitter.colorStart.b/255.0f, emitter.colorStart.a/255.0f },
+        .colorEnd = { emitter.colorEnd.r/255.0f, emitter.colorEnd.g/255.0f, emitter.colorEnd.b/255.0f, emitter.colorEnd.a/255.0f },
+        .range = { first, emitter.particleCount, 0, 0 }
+    };
+
+    return data;
+}
+
+// Respawn particle, same random values sequence as compute shader
+static void RespawnParticle(ParticleSystem *system, const ParticleEmitter *emitter, int index, unsigned int seed)
+{
+    int capacity = PARTICLES_CAPACITY(system->particleCount);
+    float *data = system->data;
+    unsigned int state = ParticleHash((unsigned int)index ^ seed);
+
+    data[PARTICLES_POSITION_X*capacity + index] = emitter->position.x + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->positionVariance.x;
+    data[PARTICLES_POSITION_Y*capacity + index] = emitter->position.y + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->positionVariance.y;
+    data[PARTICLES_POSITION_Z*capacity + index] = emitter->position.z + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->positionVariance.z;
+    data[PARTICLES_VELOCITY_X*capacity + index] = emitter->velocity.x + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->velocityVariance.x;
+    data[PARTICLES_VELOCITY_Y*capacity + index] = emitter->velocity.y + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->velocityVariance.y;
+    data[PARTICLES_VELOCITY_Z*capacity + index] = emitter->velocity.z + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->velocityVariance.z;
+
+    float lifetime = emitter->lifetime + (ParticleRandom(&state)*2.0f - 1.0f)*emitter->lifetimeVariance;
+    data[PARTICLES_LIFETIME*capacity + index] = (lifetime > 0.001f)? lifetime : 0.001f;
+    data[PARTICLES_AGE*capacity + index] = 0.0f;
+}
+
+// Simulate emitter particles and generate render data (CPU simulation)
+// NOTE: Particles are processed 4 at a time with SSE2/NEON, respawns are processed per particle
+static void UpdateParticlesCPU(ParticleSystem *system, int emitterIndex, int first, float deltaTime, unsigned int seed)
+{
+    const ParticleEmitter *emitter = &system->emitters[emitterIndex];
+    int capacity = PARTICLES_CAPACITY(system->particleCount);
+
+    float *px = system->data + PARTICLES_POSITION_X*capacity;
+    float *py = system->data + PARTICLES_POSITION_Y*capacity;
+    float *pz = system->data + PARTICLES_POSITION_Z*capacity;
+    float *vx = system->data + PARTICLES_VELOCITY_X*capacity;
+    float *vy = system->data + PARTICLES_VELOCITY_Y*capacity;
+    float *vz = system->data + PARTICLES_VELOCITY_Z*capacity;
+    float *age = system->data + PARTICLES_AGE*capacity;
+    float *life = system->data + PARTICLES_LIFETIME*capacity;
+    float *instances = system->instances;
+    unsigned int *colors = system->colors;
+
+    // Emitter constants for current update
+    float dvx = emitter->acceleration.x*deltaTime;
+    float dvy = emitter->acceleration.y*deltaTime;
+    float dvz = emitter->acceleration.z*deltaTime;
+    float drag = 1.0f/(1.0f + emitter->drag*deltaTime);
+    float sizeStart = emitter->sizeStart;
+    float sizeDelta = emitter->sizeEnd - emitter->sizeStart;
+    float colorStart[4] = { emitter->colorStart.r, emitter->colorStart.g, emitter->colorStart.b, emitter->colorStart.a };
+    float colorDelta[4] = {
+        (float)emitter->colorEnd.r - emitter->colorStart.r, (float)emitter->colorEnd.g - emitter->colorStart.g,
+        (float)emitter->colorEnd.b - emitter->colorStart.b, (float)emitter->colorEnd.a - emitter->colorStart.a
+    };
+
+    int i = first;
+    int last = first + emitter->particleCount;
+
+#if defined(RPARTICLES_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 epsilon = _mm_set1_ps(0.000001f);
+    const __m128 dt4 = _mm_set1_ps(deltaTime);
+    const __m128 dvx4 = _mm_set1_ps(dvx);
+    const __m128 dvy4 = _mm_set1_ps(dvy);
+    const __m128 dvz4 = _mm_set1_ps(dvz);
+    const __m128 drag4 = _mm_set1_ps(drag);
+    const __m128 sizeStart4 = _mm_set1_ps(sizeStart);
+    const __m128 sizeDelta4 = _mm_set1_ps(sizeDelta);
+
+    for (; (i + 4) <= last; i += 4)
+    {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(age + i), dt4);
+        __m128 l = _mm_loadu_ps(life + i);
+        __m128 alive = _mm_and_ps(_mm_cmpge_ps(a, zero), _mm_cmplt_ps(a, l));
+
+        // Integrate living particles: v = (v + a*dt)*drag, p = p + v*dt
+        __m128 x = _mm_loadu_ps(vx + i);
+        __m128 y = _mm_loadu_ps(vy + i);
+        __m128 z = _mm_loadu_ps(vz + i);
+        x = _mm_or_ps(_mm_and_ps(alive, _mm_mul_ps(_mm_add_ps(x, dvx4), drag4)), _mm_andnot_ps(alive, x));
+        y = _mm_or_ps(_mm_and_ps(alive, _mm_mul_ps(_mm_add_ps(y, dvy4), drag4)), _mm_andnot_ps(alive, y));
+        z = _mm_or_ps(_mm_and_ps(alive, _mm_mul_ps(_mm_add_ps(z, dvz4), drag4)), _mm_andnot_ps(alive, z));
+        _mm_storeu_ps(vx + i, x);
+        _mm_storeu_ps(vy + i, y);
+        _mm_storeu_ps(vz + i, z);
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_and_ps(alive, _mm_mul_ps(x, dt4))));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_and_ps(alive, _mm_mul_ps(y, dt4))));
+        _mm_storeu_ps(pz + i, _mm_add_ps(_mm_loadu_ps(pz + i), _mm_and_ps(alive, _mm_mul_ps(z, dt4))));
+        _mm_storeu_ps(age + i, a);
+
+        int respawn = _mm_movemask_ps(_mm_cmpge_ps(a, l));
+        if (respawn != 0)
+        {
+            for (int k = 0; k < 4; k++) if (respawn & (1 << k)) RespawnParticle(system, emitter, i + k, seed);
+
+            a = _mm_loadu_ps(age + i);
+            l = _mm_loadu_ps(life + i);
+        }
+
+        // Render data: size and color interpolated along lifetime, size 0 for unborn particles
+        __m128 visible = _mm_and_ps(_mm_cmpge_ps(a, zero), _mm_cmplt_ps(a, l));
+        __m128 t = _mm_min_ps(_mm_max_ps(_mm_div_ps(a, _mm_max_ps(l, epsilon)), zero), one);
+        __m128 size = _mm_and_ps(visible, _mm_add_ps(sizeStart4, _mm_mul_ps(sizeDelta4, t)));
+
+        x = _mm_loadu_ps(px + i);
+        y = _mm_loadu_ps(py + i);
+        z = _mm_loadu_ps(pz + i);
+        _MM_TRANSPOSE4_PS(x, y, z, size);
+        _mm_storeu_ps(instances + 4*i, x);
+        _mm_storeu_ps(instances + 4*i + 4, y);
+        _mm_storeu_ps(instances + 4*i + 8, z);
+        _mm_storeu_ps(instances + 4*i + 12, size);
+
+        __m128i r = _mm_cvtps_epi32(_mm_add_ps(_mm_set1_ps(colorStart[0]), _mm_mul_ps(_mm_set1_ps(colorDelta[0]), t)));
+        __m128i g = _mm_cvtps_epi32(_mm_add_ps(_mm_set1_ps(colorStart[1]), _mm_mul_ps(_mm_set1_ps(colorDelta[1]), t)));
+        __m128i b = _mm_cvtps_epi32(_mm_add_ps(_mm_set1_ps(colorStart[2]), _mm_mul_ps(_mm_set1_ps(colorDelta[2]), t)));
+        __m128i w = _mm_cvtps_epi32(_mm_add_ps(_mm_set1_ps(colorStart[3]), _mm_mul_ps(_mm_set1_ps(colorDelta[3]), t)));
+        __m128i rgba = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(w, 24)));
+        _mm_storeu_si128((__m128i *)(colors + i), rgba);
+    }
+#elif defined(RPARTICLES_SIMD_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t epsilon = vdupq_n_f32(0.000001f);
+    const float32x4_t dt4 = vdupq_n_f32(deltaTime);
+    const float32x4_t dvx4 = vdupq_n_f32(dvx);
+    const float32x4_t dvy4 = vdupq_n_f32(dvy);
+    const float32x4_t dvz4 = vdupq_n_f32(dvz);
+    const float32x4_t drag4 = vdupq_n_f32(drag);
+    const float32x4_t sizeStart4 = vdupq_n_f32(sizeStart);
+    const float32x4_t sizeDelta4 = vdupq_n_f32(sizeDelta);
+
+    for (; (i + 4) <= last; i += 4)
+    {
+        float32x4_t a = vaddq_f32(vld1q_f32(age + i), dt4);
+        float32x4_t l = vld1q_f32(life + i);
+        uint32x4_t alive = vandq_u32(vcgeq_f32(a, zero), vcltq_f32(a, l));
+
+        // Integrate living particles: v = (v + a*dt)*drag, p = p + v*dt
+        float32x4_t x = vld1q_f32(vx + i);
+        float32x4_t y = vld1q_f32(vy + i);
+        float32x4_t z = vld1q_f32(vz + i);
+        x = vbslq_f32(alive, vmulq_f32(vaddq_f32(x, dvx4), drag4), x);
+        y = vbslq_f32(alive, vmulq_f32(vaddq_f32(y, dvy4), drag4), y);
+        z = vbslq_f32(alive, vmulq_f32(vaddq_f32(z, dvz4), drag4), z);
+        vst1q_f32(vx + i, x);
+        vst1q_f32(vy + i, y);
+        vst1q_f32(vz + i, z);
+        vst1q_f32(px + i, vbslq_f32(alive, vmlaq_f32(vld1q_f32(px + i), x, dt4), vld1q_f32(px + i)));
+        vst1q_f32(py + i, vbslq_f32(alive, vmlaq_f32(vld1q_f32(py + i), y, dt4), vld1q_f32(py + i)));
+        vst1q_f32(pz + i, vbslq_f32(alive, vmlaq_f32(vld1q_f32(pz + i), z, dt4), vld1q_f32(pz + i)));
+        vst1q_f32(age + i, a);
+
+        uint32x4_t respawn = vcgeq_f32(a, l);
+        if ((vgetq_lane_u32(respawn, 0) | vgetq_lane_u32(respawn, 1) | vgetq_lane_u32(respawn, 2) | vgetq_lane_u32(respawn, 3)) != 0)
+        {
+            if (vgetq_lane_u32(respawn, 0) != 0) RespawnParticle(system, emitter, i, seed);
+            if (vgetq_lane_u32(respawn, 1) != 0) RespawnParticle(system, emitter, i + 1, seed);
+            if (vgetq_lane_u32(respawn, 2) != 0) RespawnParticle(system, emitter, i + 2, seed);
+            if (vgetq_lane_u32(respawn, 3) != 0) RespawnParticle(system, emitter, i + 3, seed);
+
+            a = vld1q_f32(age + i);
+            l = vld1q_f32(life + i);
+        }
+
+        // Render data: size and color interpolated along lifetime, size 0 for unborn particles
+        // NOTE: Division computed with reciprocal estimation and two Newton-Raphson steps
+        uint32x4_t visible = vandq_u32(vcgeq_f32(a, zero), vcltq_f32(a, l));
+        float32x4_t lm = vmaxq_f32(l, epsilon);
+        float32x4_t rcp = vrecpeq_f32(lm);
+        rcp = vmulq_f32(vrecpsq_f32(lm, rcp), rcp);
+        rcp = vmulq_f32(vrecpsq_f32(lm, rcp), rcp);
+        float32x4_t t = vminq_f32(vmaxq_f32(vmulq_f32(a, rcp), zero), one);
+        float32x4_t size = vreinterpretq_f32_u32(vandq_u32(visible, vreinterpretq_u32_f32(vmlaq_f32(sizeStart4, sizeDelta4, t))));
+
+        float32x4x4_t instance = { { vld1q_f32(px + i), vld1q_f32(py + i), vld1q_f32(pz + i), size } };
+        vst4q_f32(instances + 4*i, instance);
+
+        uint32x4_t r = vcvtq_u32_f32(vaddq_f32(vmlaq_f32(vdupq_n_f32(colorStart[0]), vdupq_n_f32(colorDelta[0]), t), half));
+        uint32x4_t g = vcvtq_u32_f32(vaddq_f32(vmlaq_f32(vdupq_n_f32(colorStart[1]), vdupq_n_f32(colorDelta[1]), t), half));
+        uint32x4_t b = vcvtq_u32_f32(vaddq_f32(vmlaq_f32(vdupq_n_f32(colorStart[2]), vdupq_n_f32(colorDelta[2]), t), half));
+        uint32x4_t w = vcvtq_u32_f32(vaddq_f32(vmlaq_f32(vdupq_n_f32(colorStart[3]), vdupq_n_f32(colorDelta[3]), t), half));
+        vst1q_u32((uint32_t *)(colors + i), vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)), vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(w, 24))));
+    }
+#endif
+
+    // Remaining particles (or all of them without SIMD support)
+    for (; i < last; i++)
+    {
+        float a = age[i] + deltaTime;
+
+        if (a >= life[i]) RespawnParticle(system, emitter, i, seed);
+        else
+        {
+            age[i] = a;
+
+            if (a >= 0.0f)
+            {
+                vx[i] = (vx[i] + dvx)*drag;
+                vy[i] = (vy[i] + dvy)*drag;
+                vz[i] = (vz[i] + dvz)*drag;
+                px[i] += vx[i]*deltaTime;
+                py[i] += vy[i]*deltaTime;
+                pz[i] += vz[i]*deltaTime;
+            }
+        }
+
+        bool visible = ((age[i] >= 0.0f) && (age[i] < life[i]));
+        float t = visible? age[i]/life[i] : 0.0f;
+
+        instances[4*i] = px[i];
+        instances[4*i + 1] = py[i];
+        instances[4*i + 2] = pz[i];
+        instances[4*i + 3] = visible? (sizeStart + sizeDelta*t) : 0.0f;
+
+        unsigned char *color = (unsigned char *)&colors[i];
+        for (int c = 0; c < 4; c++) color[c] = (unsigned char)(colorStart[c] + colorDelta[c]*t + 0.5f);
+    }
+}
+
+#endif // RPARTICLES_IMPLEMENTATION
@@ -145,6 +145,8 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyphs index lookup table by codepoint pages
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint); // Draw one glyph by index
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -301,6 +303,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -312,6 +315,8 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphLookup);
+    defaultFont.glyphLookup = NULL;
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -519,6 +524,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -571,6 +577,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -953,6 +961,7 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphLookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1173,7 +1182,7 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1203,23 +1212,7 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
 {
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
-    int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
-
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTextGlyph(font, GetGlyphIndex(font, codepoint), position, fontSize, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1244,7 +1237,7 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1335,11 +1328,23 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 }
 
 // Get index position for a unicode character on font
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
+// NOTE: If codepoint is not found in the font it fallbacks to '?',
+// fonts loaded by raylib use the glyphs lookup table, fonts built by hand (no table) scan glyphs
 int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+    if (font.glyphLookup != NULL)
+    {
+        // Lookup table: pages count, pages offsets, fallback page, glyphs pages (256 codepoints each)
+        int page = codepoint >> 8;
+
+        if ((codepoint >= 0) && (page < font.glyphLookup[0])) index = font.glyphLookup[font.glyphLookup[1 + page] + (codepoint & 0xff)];
+        else index = font.glyphLookup[1 + font.glyphLookup[0]];
+
+        return index;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -2135,6 +2140,73 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load glyphs index lookup table by codepoint, codepoints are split in pages of 256 glyphs
+// NOTE: Table layout: pages count, pages offsets, fallback page, used pages; pages without glyphs point to fallback page,
+// filled with index of fallback glyph '?' (last one found), first glyph found for a codepoint is used (as glyphs scan)
+static int *LoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    int fallbackIndex = 0;
+    int maxCodepoint = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63) fallbackIndex = i;
+        if ((glyphs[i].value > maxCodepoint) && (glyphs[i].value <= 0x10ffff)) maxCodepoint = glyphs[i].value;
+    }
+
+    // Assign offsets to pages containing glyphs
+    int pageCount = (maxCodepoint >> 8) + 1;
+    int *pageOffsets = (int *)RL_CALLOC(pageCount, sizeof(int));
+    int tableSize = 1 + pageCount + 256;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if ((glyphs[i].value >= 0) && (glyphs[i].value <= 0x10ffff) && (pageOffsets[glyphs[i].value >> 8] == 0))
+        {
+            pageOffsets[glyphs[i].value >> 8] = tableSize;
+            tableSize += 256;
+        }
+    }
+
+    int *lookup = (int *)RL_MALLOC(tableSize*sizeof(int));
+
+    lookup[0] = pageCount;
+    for (int i = 0; i < pageCount; i++) lookup[1 + i] = (pageOffsets[i] != 0)? pageOffsets[i] : 1 + pageCount;
+    for (int i = 1 + pageCount; i < tableSize; i++) lookup[i] = fallbackIndex;
+
+    for (int i = glyphCount - 1; i >= 0; i--)
+    {
+        if ((glyphs[i].value >= 0) && (glyphs[i].value <= 0x10ffff)) lookup[pageOffsets[glyphs[i].value >> 8] + (glyphs[i].value & 0xff)] = i;
+    }
+
+    RL_FREE(pageOffsets);
+
+    return lookup;
+}
+
+// Draw one glyph by index in font, glyph index already looked up
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // Character destination rectangle on screen
+    // NOTE: We consider glyphPadding on drawing
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    // Draw the character texture on the screen
+    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2306,6 +2378,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         UnloadFont(font);
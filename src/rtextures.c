@@ -34,6 +34,9 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define RTEXTURES_NO_SIMD
+*           Disable SIMD (SSE2/SSSE3/F16C/NEON) pixel processing kernels, scalar code paths are used instead
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -77,6 +80,7 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: UINT_MAX [Used in virtual texture tiles cache]
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -143,7 +147,10 @@
         #pragma GCC diagnostic ignored "-Wunused-function"
     #endif
 
-    #define STBI_MALLOC RL_MALLOC
+    // NOTE: Decoders allocate pixel buffers through image pool, reusing released buffers of the same size
+    static void *LoadImageBuffer(size_t size);
+
+    #define STBI_MALLOC LoadImageBuffer
     #define STBI_FREE RL_FREE
     #define STBI_REALLOC RL_REALLOC
 
@@ -179,7 +186,9 @@
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_QOI)
-    #define QOI_MALLOC RL_MALLOC
+    static void *LoadImageBuffer(size_t size);
+
+    #define QOI_MALLOC LoadImageBuffer
     #define QOI_FREE RL_FREE
 
     #if defined(_MSC_VER)               // Disable some MSVC warning
@@ -203,11 +212,16 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+        #define RTEXTURES_PNG_ENCODER
+        #include "external/sdefl.h"         // Required for: sdeflate_part(), sdefl_bound() [Implementation on rcore]
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
     #define STB_PERLIN_IMPLEMENTATION
-    #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
+    #include "external/stb_perlin.h"        // Required for: stb__perlin_randtab[], stb__perlin_randtab_grad_idx[]
 #endif
 
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
@@ -225,6 +239,29 @@
     #pragma GCC diagnostic pop
 #endif
 
+// SIMD support detection, used by pixel processing kernels
+// NOTE: SSSE3 and F16C are only enabled when the compiler targets them (i.e. -mssse3, -mf16c, -mavx2 or /arch:AVX2)
+#if !defined(RTEXTURES_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RTEXTURES_SIMD_SSE2
+        #include <emmintrin.h>          // Required for: SSE2 intrinsics
+        #if defined(__SSSE3__) || defined(__AVX2__)
+            #define RTEXTURES_SIMD_SSSE3
+            #include <tmmintrin.h>      // Required for: _mm_shuffle_epi8()
+        #endif
+        #if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+            #define RTEXTURES_SIMD_F16C
+            #include <immintrin.h>      // Required for: _mm_cvtph_ps(), _mm_cvtps_ph()
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define RTEXTURES_SIMD_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics
+        #if defined(__aarch64__) || defined(_M_ARM64)
+            #define RTEXTURES_SIMD_NEON64   // AArch64 only: float division and half-float conversions
+        #endif
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -236,15 +273,398 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef MAX_IMAGE_POOL_BUFFERS
+    #define MAX_IMAGE_POOL_BUFFERS   32    // Max number of pixel buffers retained by image pool for reuse
+#endif
+
+#ifndef MAX_VIRTUAL_TEXTURE_LOADS
+    #define MAX_VIRTUAL_TEXTURE_LOADS  16  // Max number of virtual texture tiles loading at the same time (per virtual texture)
+#endif
+
+#define PNG_PART_MIN_SIZE       (256*1024)  // Minimum PNG filtered data size compressed by one worker
+
+#define RESIZE_BATCH_PIXELS     (64*1024)   // Minimum destination pixels resized by one worker
+
+#define TRANSFORM_BATCH_PIXELS  (64*1024)   // Minimum pixels flipped or rotated by one worker
+#define GENERATION_BATCH_PIXELS (16*1024)   // Minimum pixels generated by one worker
+#define ADJUST_BATCH_PIXELS     (64*1024)   // Minimum pixels color adjusted by one worker
+#define ADJUST_CHUNK_PIXELS     64          // Float formats pixels converted together by color adjustments
+#define COMPARE_BATCH_PIXELS    (64*1024)   // Minimum pixels compared by one worker
+
+#define SSIM_BLOCK_SIZE         4       // SSIM statistics block size, windows cover 2x2 blocks (8x8 pixels, 4 pixels overlap)
+
+#define VIRTUAL_TEXTURE_BORDER      1   // Virtual texture tiles border (pixels), bilinear filtering samples stay inside tiles
+#define VIRTUAL_TEXTURE_MAX_LEVELS  24  // Virtual texture max mip levels
+#define VIRTUAL_TEXTURE_HEADER_SIZE 32  // Virtual texture tiles file header size: id, version, width, height, tile size, border, format, levels
+#define VIRTUAL_TILE_LOADING        -2  // Virtual texture tile slot value while tile is loading
+
+#define CUBEMAP_MAX_LEVELS          16  // Cubemap generation max source levels (prefiltering)
+#define CUBEMAP_PREFILTER_SAMPLES   64  // Cubemap prefiltering samples per texel (GGX importance sampling, filtered by source level)
+
+#define TRANSPOSE_TILE_SIZE     32      // Tile size used by 90 degrees rotations, source tile rows and destination tile rows stay in cache
+
+#define BOX_BLUR_BLOCK_ROWS     8       // Rows blurred together by box blur, transposed store writes them as contiguous segments
+
+#define RASTER_AA_SAMPLES       4       // Anti-aliased primitives sample rows per pixel row, coverage along rows is computed exactly
+#define RASTER_LOCAL_EDGES      64      // Primitives edges and crossings stored locally, avoiding allocations for small primitives
+#define RASTER_LOCAL_WIDTH      256     // Anti-aliased primitives width accumulated locally, avoiding allocations for small primitives
+
+#define MAPPED_IMAGE_TILE_SIZE  512     // Mapped image tiles size processed by streaming operations (crop, format, resize)
+
+#define QUANTIZE_HISTOGRAM_BITS 5       // Color quantization histogram bits per RGB channel
+#define QUANTIZE_HISTOGRAM_SIZE (1 << (3*QUANTIZE_HISTOGRAM_BITS))
+#define QUANTIZE_MAX_COLORS     256     // Color quantization maximum palette size (palette index stored as unsigned char)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image pool, pixel buffers released by UnloadImage() retained for reuse
+// NOTE: Shared by decoders running on any thread, access is protected by a spin lock
+typedef struct ImagePool {
+    void *buffers[MAX_IMAGE_POOL_BUFFERS];  // Pixel buffers available for reuse
+    int sizes[MAX_IMAGE_POOL_BUFFERS];      // Pixel buffers size in bytes
+    int count;                      // Number of pixel buffers available
+    int maxCount;                   // Max number of pixel buffers retained (SetImagePoolSize())
+    volatile int lock;              // Spin lock, required to access pool
+} ImagePool;
+
+// Async image load request data, image is loaded by a worker thread
+typedef struct AsyncImageLoad {
+    char *fileName;                 // Image file name (stored after request data)
+    Image image;                    // Loaded image
+    Image *dstImage;                // Destination image (LoadImageAsync())
+    Texture2D *dstTexture;          // Destination texture (LoadTextureAsync())
+} AsyncImageLoad;
+
+// PNG encoding part, one IDAT chunk filtered and compressed independently by one worker
+typedef struct PngEncodePart {
+    unsigned char *chunk;           // IDAT chunk data (length, tag, compressed data, crc)
+    int chunkSize;                  // IDAT chunk size in bytes
+    unsigned int adler;             // Filtered data Adler-32 checksum
+    int filteredSize;               // Filtered data size in bytes
+} PngEncodePart;
+
+// PNG encoding pass data, shared by worker threads
+typedef struct PngEncodePass {
+    const unsigned char *pixels;    // Image pixels (8 bit per channel)
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Image channels (1 to 4)
+    int level;                      // Compression level
+    int filter;                     // Rows filter mode (PngFilterMode)
+    int partCount;                  // Number of parts
+    PngEncodePart *parts;           // Encoded parts
+} PngEncodePass;
+
+// Box blur pass data, shared by worker threads
+typedef struct BoxBlurPass {
+    const unsigned char *src;       // Source pixels (RGBA8)
+    unsigned char *dst;             // Destination pixels (RGBA8), stored transposed
+    int width;                      // Source width
+    int height;                     // Source height
+    int radius;                     // Box filter radius
+    int iterations;                 // Box filter iterations
+    int alphaMode;                  // Alpha processing: 0-None, 1-Premultiply on load, 2-Reverse premultiply on store
+} BoxBlurPass;
+
+// Image resize pass data, shared by worker threads
+typedef struct ResizePass {
+    const unsigned char *src;       // Source pixels
+    unsigned char *dst;             // Destination pixels
+    int srcWidth;                   // Source width
+    int srcHeight;                  // Source height
+    int dstWidth;                   // Destination width
+    int dstHeight;                  // Destination height
+    int channels;                   // Channels per pixel (0 for packed formats, nearest only)
+    int type;                       // Channel type: 0-8 bit, 1-Half-float, 2-Float
+    int bytesPerPixel;              // Bytes per pixel
+    int filter;                     // Resize filter (ResizeFilter)
+    int *columns;                   // Source columns pair for every destination column (nearest, bilinear) or columns range (box)
+    int *weights;                   // Second source column weight for every destination column (16 bit fixed point)
+} ResizePass;
+
+// Image flip and rotation pass data, shared by worker threads
+typedef struct TransformPass {
+    const unsigned char *src;       // Source pixels
+    unsigned char *dst;             // Destination pixels (in-place flips use source)
+    int width;                      // Source width
+    int height;                     // Source height
+    int dstWidth;                   // Destination width
+    int dstHeight;                  // Destination height
+    int bytesPerPixel;              // Bytes per pixel
+    int mode;                       // Flip mode: 0-Horizontal, 1-Vertical, 2-Both / Rotation: 0-CW, 1-CCW / Channel type (rotation): 0-8 bit, 2-Float
+    long long startX;               // Source position for destination origin (16.16 fixed point, arbitrary rotation)
+    long long startY;
+    int stepX;                      // Source position step (16.16 fixed point, arbitrary rotation)
+    int stepY;
+} TransformPass;
+
+// Image generators, processed by rows
+typedef enum {
+    GEN_IMAGE_COLOR = 0,
+    GEN_IMAGE_GRADIENT_LINEAR,
+    GEN_IMAGE_GRADIENT_RADIAL,
+    GEN_IMAGE_GRADIENT_SQUARE,
+    GEN_IMAGE_CHECKED,
+    GEN_IMAGE_WHITE_NOISE,
+    GEN_IMAGE_NOISE,
+    GEN_IMAGE_CELLULAR
+} GenImageType;
+
+// Image generation pass data, shared by worker threads
+typedef struct GenImagePass {
+    void *data;                     // Output pixels (RGBA8, R32 for float noise)
+    int width;                      // Image width
+    int height;                     // Image height
+    int generator;                  // Image generator (GenImageType)
+    Color colors[2];                // Generator colors: color/start/inner/first check, end/outer/second check
+    float direction[2];             // Linear gradient direction, scaled by inverse gradient length
+    float center[2];                // Radial and square gradients center
+    float start;                    // Radial and square gradients start distance
+    float scale;                    // Radial and square gradients inverse range, noise scale
+    int checks[2];                  // Checks size
+    unsigned int threshold;         // White noise threshold (out of 100)
+    unsigned int seed;              // White noise and noise seed
+    int offset[2];                  // Noise offset
+    int noiseType;                  // Noise type (NoiseType)
+    int octaves;                    // Noise octaves
+    bool floatOutput;               // Noise output as float values
+    const int *cells;               // Cellular seeds positions (x, y)
+    int cellsPerRow;                // Cellular seeds per row
+    int cellsPerCol;                // Cellular seeds per column
+    int tileSize;                   // Cellular tile size
+} GenImagePass;
+
+// GPU texture file data layout (DDS, PKM, KTX, PVR, ASTC), pixels data ready for upload
+typedef struct TextureFileLayout {
+    int width;                      // Texture base level width
+    int height;                     // Texture base level height
+    int format;                     // Texture pixel format (PixelFormat)
+    int mipmaps;                    // Mipmap levels count
+    int offset;                     // Base level data offset in file data
+    bool sizePrefixed;              // Levels data prefixed by its size, 4 bytes aligned (KTX)
+    bool contiguous;                // Levels data can be uploaded directly from file data
+} TextureFileLayout;
+
+// Animated image decoder internal data
+// NOTE: GIF decoder keeps stb_image frame state: canvas (current frame), background and history,
+// frames are decoded in stream order, going back in time restarts decoding from first frame
+typedef struct AnimatedImageDecoder {
+    unsigned char *fileData;        // Animated image file data (copy)
+    int dataSize;                   // Animated image file data size
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    stbi__context context;          // GIF data stream, positioned after current frame
+    stbi__gif gif;                  // GIF decoder state
+#endif
+} AnimatedImageDecoder;
+
+// Cubemap generation passes, processed by rows of faces
+typedef enum {
+    CUBEMAP_PASS_PANORAMA = 0,      // Sample equirectangular panorama
+    CUBEMAP_PASS_DOWNSAMPLE,        // Downsample source level (2x2 box)
+    CUBEMAP_PASS_PROJECT,           // Project source level on spherical harmonics
+    CUBEMAP_PASS_IRRADIANCE,        // Evaluate irradiance spherical harmonics
+    CUBEMAP_PASS_PREFILTER          // Prefilter source levels (GGX)
+} CubemapPassType;
+
+// Cubemap generation pass data, shared by worker threads
+// NOTE: All passes pixels are RGBA32F, 6 faces one after the other (+X, -X, +Y, -Y, +Z, -Z)
+typedef struct CubemapPass {
+    int type;                       // Pass type (CubemapPassType)
+    int size;                       // Output faces size (source faces size for projection)
+    float *output;                  // Output pixels
+    const float *panorama;          // Source panorama pixels
+    int panoramaWidth;              // Source panorama width
+    int panoramaHeight;             // Source panorama height
+    const float *levels[CUBEMAP_MAX_LEVELS];    // Source cubemap levels pixels
+    int levelSizes[CUBEMAP_MAX_LEVELS];         // Source cubemap levels faces size
+    int levelCount;                 // Source cubemap levels count
+    float *projection;              // Spherical harmonics projection per source row (9 coefficients RGBA)
+    float sh[9][4];                 // Irradiance spherical harmonics (convolved, divided by PI)
+    const float *samples;           // Prefilter samples: tangent space direction, weight, source level
+    int sampleCount;                // Prefilter samples count
+} CubemapPass;
+
+// Image drawing span writer, spans color encoded once in destination format
+typedef struct ImageSpanWriter {
+    Image *image;                   // Destination image
+    int bytesPerPixel;              // Destination bytes per pixel
+    bool blend;                     // Alpha blend spans over destination (IMAGE_DRAW_BLEND)
+    Color color;                    // Spans color
+    unsigned int pixel[4];          // Spans color in destination format (aligned for float formats)
+    bool shaded;                    // Spans color interpolated from vertex colors
+    float shade[4][3];              // Shaded color channels planes: value = x*shade[c][0] + y*shade[c][1] + shade[c][2]
+} ImageSpanWriter;
+
+// Image drawing rasterizer edge, stored from top to bottom
+typedef struct RasterEdge {
+    float x;                        // Edge x at top
+    float y0;                       // Edge top
+    float y1;                       // Edge bottom
+    float dxdy;                     // Edge x increment per row
+    int winding;                    // Edge winding: 1-Downwards, -1-Upwards
+} RasterEdge;
+
+// Image drawing rasterizer edges list, primitives outlines
+typedef struct RasterEdgeList {
+    RasterEdge *edges;              // Edges, local storage until list grows
+    int count;                      // Edges count
+    int capacity;                   // Edges capacity
+    float bounds[4];                // Edges bounds: min x, min y, max x, max y
+    RasterEdge local[RASTER_LOCAL_EDGES]; // Edges local storage
+} RasterEdgeList;
+
+// Image color adjustments pass data, shared by worker threads
+// NOTE: Per channel adjustments are baked into lookup tables for 8 bit channels,
+// float formats evaluate the adjustments chain per pixel without 8 bit quantization
+typedef struct AdjustPass {
+    void *data;                     // Image pixels, adjusted in place (all mipmap levels)
+    int width;                      // Pixels per row (base level width)
+    int pixelCount;                 // Image pixels count, including mipmap levels
+    int format;                     // Image pixel format
+    Color tint;                     // Color tint
+    float tintFactor[4];            // Color tint (normalized)
+    int brightness;                 // Brightness offset
+    float contrast;                 // Contrast factor, 1.0f for no contrast change
+    float gamma;                    // Gamma exponent (1/gamma), 1.0f for no gamma change
+    float hue;                      // Hue shift in degrees
+    float saturation;               // Saturation factor
+    float value;                    // Value factor
+    bool hsv;                       // HSV shift required, channels can not be processed independently
+    bool invert;                    // Invert colors
+    bool grayscale;                 // Convert colors to grayscale
+    unsigned char lut[4][256];      // Channels lookup tables (invert included if no HSV shift)
+    unsigned char grayLut[256];     // Grayscale formats lookup table, whole adjustments chain
+    unsigned short *packedLut;      // 16 bit packed formats lookup table, whole adjustments chain (NULL if not used)
+} AdjustPass;
+
+// Image comparison statistics, accumulated by workers for a band of rows
+typedef struct CompareStats {
+    double sumError;                // Channels absolute differences sum (normalized)
+    double sumSquares;              // Channels squared differences sum (normalized)
+    float maxError;                 // Channels maximum absolute difference (normalized)
+    int diffPixels;                 // Pixels with any channel difference over tolerance
+    double luma[4];                 // Image luminance sums: a, b, a^2 + b^2, a*b (small images SSIM)
+} CompareStats;
+
+// Image comparison pass data, shared by worker threads
+// NOTE: Images sharing an 8 bit per channel format are compared as bytes, other formats as RGBA32F normalized rows
+typedef struct ComparePass {
+    Image image;                    // Compared image
+    Image reference;                // Reference image
+    bool native;                    // Images share an 8 bit per channel format
+    int channels;                   // Compared channels per pixel
+    float tolerance;                // Channels difference tolerance (normalized)
+    int blocksX;                    // SSIM blocks per row
+    float *blocks;                  // SSIM blocks luminance sums: a, b, a^2 + b^2, a*b (NULL if image is too small)
+    CompareStats *bands;            // Statistics per band of SSIM_BLOCK_SIZE rows
+    unsigned char *diff;            // Differences image data (ImageDiff())
+    int diffFormat;                 // Differences image format
+} ComparePass;
+
+// Virtual texture internal data: tiles file layout and mapping, tiles cache state
+// NOTE: Tiles file stores all levels tiles (RGBA8, with borders) in rows order, from base level to smallest level
+typedef struct VirtualTextureData {
+    int width;                      // Virtual texture width (base level)
+    int height;                     // Virtual texture height (base level)
+    int tileSize;                   // Tiles size (without borders)
+    int border;                     // Tiles border size
+    int levels;                     // Mip levels count
+    int levelSize[VIRTUAL_TEXTURE_MAX_LEVELS][2];   // Levels size (pixels)
+    int levelTiles[VIRTUAL_TEXTURE_MAX_LEVELS][2];  // Levels tiles per row and column
+    int levelOffset[VIRTUAL_TEXTURE_MAX_LEVELS];    // Levels first tile index
+    int tileCount;                  // Tiles count (all levels)
+    int tileDataSize;               // Tile pixels data size (with borders)
+    unsigned char *fileData;        // Mapped tiles file data
+    size_t fileSize;                // Mapped tiles file size
+    void *fileHandle;               // Mapped tiles file handle
+    Texture2D cache;                // Physical tiles cache texture
+    int slotsPerRow;                // Cache texture slots per row
+    int slotCount;                  // Cache texture slots count
+    int *tileSlots;                 // Cache slot per tile (page table): -1 if not resident, VIRTUAL_TILE_LOADING if loading
+    int *slotTiles;                 // Tile per cache slot, -1 for free slots
+    unsigned int *slotUsed;         // Cache slots last use stamp (LRU eviction), pinned slots use UINT_MAX
+    unsigned int useStamp;          // Current use stamp, incremented on every draw
+    int loadCount;                  // Tiles loading (async requests in flight)
+    bool unloading;                 // Unload requested, data is released when tiles loading finish
+} VirtualTextureData;
+
+// Virtual texture tile async load request
+typedef struct VirtualTileLoad {
+    VirtualTextureData *texture;    // Virtual texture requesting the tile
+    int tile;                       // Tile index (all levels)
+    unsigned char *pixels;          // Tile pixels copied from tiles file (load step)
+} VirtualTileLoad;
+
+// Virtual texture tiles export pass data, shared by worker threads
+typedef struct VirtualTextureExport {
+    const VirtualTextureData *texture;  // Virtual texture layout and mapped tiles file
+    MappedImage source;             // Source image (base level tiles)
+    int level;                      // Level of exported tiles
+} VirtualTextureExport;
+
+// Mapped image streaming operation data, shared by worker threads
+typedef struct MappedImagePass {
+    MappedImage src;                // Source mapped image
+    MappedImage dst;                // Destination mapped image
+    int x;                          // Source region position X
+    int y;                          // Source region position Y
+    int width;                      // Region width (destination pixels)
+    int height;                     // Region height (destination pixels)
+} MappedImagePass;
+
+// Color quantization box (median cut), range of histogram bins
+typedef struct QuantizeBox {
+    int start;                      // First bin in sorted bins array
+    int count;                      // Number of bins
+    unsigned int pixels;            // Number of pixels in bins
+    unsigned char min[3];           // Bins minimum coordinates (RGB)
+    unsigned char max[3];           // Bins maximum coordinates (RGB)
+} QuantizeBox;
+
+// Color quantization pass data, shared by worker threads
+typedef struct QuantizePass {
+    Color *pixels;                  // Image pixels (RGBA8)
+    int width;                      // Image width
+    const Color *palette;           // Palette colors
+    int paletteSize;                // Palette colors count
+    unsigned char *lookup;          // Histogram bin to palette index lookup table
+} QuantizePass;
+
+// Convolution pass data, shared by worker threads
+// NOTE: Kernel taps are centered at kernelSize/2, pixels out of image bounds are considered zero
+typedef struct ConvolutionPass {
+    const Color *src;               // Source pixels
+    Color *dst;                     // Destination pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    const float *kernel;            // 2D kernel (kernelWidth*kernelHeight), NULL for separable kernels
+    const float *kernelX;           // Separable horizontal kernel (kernelWidth)
+    const float *kernelY;           // Separable vertical kernel (kernelHeight)
+    int kernelWidth;                // Kernel width
+    int kernelHeight;               // Kernel height
+} ConvolutionPass;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static ImagePool imagePool = { 0 };         // Image pool, disabled by default (maxCount = 0)
+
+static int pngCompressionLevel = 4;         // PNG export compression level (0..8)
+static int pngFilterMode = PNG_FILTER_FULL; // PNG export rows filter mode
+static bool pngThreaded = true;             // PNG export multithreaded compression
+
+static unsigned int imageDrawFlags = 0;     // Image drawing primitives flags (ImageDrawFlags)
+
+// Cubemap faces axes: normal, s direction, t direction (OpenGL convention, t goes down the face image)
+static const float cubemapFaceAxes[6][9] = {
+    { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, -1.0f, 0.0f },    // +X
+    { -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f },    // -X
+    { 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f },      // +Y
+    { 0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f },    // -Y
+    { 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f },     // +Z
+    { 0.0f, 0.0f, -1.0f, -1.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f }    // -Z
+};
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -257,6 +677,105 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void *LoadImageBuffer(size_t size);                  // Allocate pixel buffer, reusing a pooled buffer of the same size if available
+static int GetImageBufferSize(Image image);                 // Get image pixel buffer size for image pool, 0 if buffer can not be pooled
+static void UnloadImageBuffer(void *data, int size, bool reserved);    // Release pixel buffer into image pool (freed if pool is full)
+static bool RemoveImageBuffer(void *data);                  // Remove pixel buffer from image pool, returns false if not available
+static AsyncImageLoad *LoadAsyncImageRequest(const char *fileName);  // Allocate async image load request
+static void LoadAsyncImage(void *userData);                 // Load image file (async load step, worker thread)
+static void FinishAsyncImage(void *userData);               // Deliver loaded image or upload it as texture (async finish step, main thread)
+static void ReleaseAsyncImage(void *userData);              // Free loaded image of cancelled load (async release step, main thread)
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize); // Encode image pixels as PNG file data
+#if defined(RTEXTURES_PNG_ENCODER)
+static void EncodePNGParts(int start, int end, void *userData);               // Filter and compress a range of PNG parts (ParallelFor() task)
+static int FilterPNGRow(const unsigned char *row, const unsigned char *prev, int size, int bpp, int filter, unsigned char *dst); // Filter PNG row, returns filtered data estimated cost
+#endif
+static bool ConvertImageData(const void *srcData, int srcFormat, void *dstData, int dstFormat, int pixelCount); // Convert pixel data with a format-pair specialized kernel
+static void HalfToFloatArray(const unsigned short *src, float *dst, int count);     // Convert half-float array to float array
+static void BlendImageRowRGBA8(unsigned char *dst, const unsigned char *src, int count, Color tint);  // Alpha blend a row of RGBA8 pixels into RGBA8 destination
+static void BlendImageRowFloat(float *dst, const float *src, int count, Vector4 tint);  // Alpha blend a row of RGBA32F pixels into RGBA32F destination
+static void LoadImageRowNormalized(const void *src, int format, float *dst, int count); // Load a row of pixels as RGBA32F normalized values
+static void BoxBlurRowsTransposed(int start, int end, void *userData);              // Box blur blocks of rows and store them transposed (ParallelFor() task)
+static void MappedImageConvertTiles(int start, int end, void *userData);             // Convert a range of mapped image tiles into destination format (ParallelFor() task)
+static void MappedImageResizeBands(int start, int end, void *userData);              // Resize a range of mapped image bands of rows (ParallelFor() task)
+static int GetResizeSamples(int coord, int srcSize, int dstSize, int filter, int *first, int *second); // Get resize source samples for destination coordinate, returns second sample weight
+static void ResizeImageRows(int start, int end, void *userData);                    // Resize a range of destination image rows (ParallelFor() task)
+static void ResizeRowHorizontal(const unsigned char *src, unsigned short *dst, const ResizePass *pass); // Resize 8 bit row horizontally (bilinear), 7 bit fixed point weights
+static void ResizeRowHorizontalFloat(const float *src, float *dst, const ResizePass *pass); // Resize float row horizontally (bilinear)
+static void BlendResizeRows(const unsigned short *row0, const unsigned short *row1, int weight, unsigned char *dst, int count); // Blend horizontally resized 8 bit rows (bilinear)
+static void BlendResizeRowsFloat(const float *row0, const float *row1, float weight, float *dst, int count); // Blend horizontally resized float rows (bilinear)
+static void AccumulateResizeRow(const unsigned char *src, unsigned int *sums, int count); // Accumulate 8 bit row into sums (box)
+static void FlipImageRows(int start, int end, void *userData);                      // Flip a range of image rows in place (ParallelFor() task)
+static void ReverseImageRow(unsigned char *row, int width, int bytesPerPixel);      // Reverse image row pixels in place
+static void RotateImageTiles(int start, int end, void *userData);                   // Rotate 90 degrees a range of source tiles bands (ParallelFor() task)
+static void RotateImageRows(int start, int end, void *userData);                    // Rotate a range of destination rows by arbitrary angle (ParallelFor() task)
+static void GenImageRows(int start, int end, void *userData);                       // Generate a range of image rows (ParallelFor() task)
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static int ScanAnimatedImageGIF(const unsigned char *fileData, int dataSize, int **delays, int **disposals); // Scan GIF frames delays and disposal modes (no decoding), returns frames count
+static bool DecodeAnimatedImageFrame(AnimatedImageDecoder *decoder, bool rewind);  // Decode next GIF frame into decoder canvas, optionally restarting from first frame
+#endif
+static bool LoadTextureFromMappedFile(const char *fileName, Texture2D *texture);    // Load texture from mapped GPU texture file, levels uploaded from mapped data (no copies)
+static bool GetTextureFileLayout(const char *fileName, const unsigned char *fileData, int fileSize, TextureFileLayout *layout); // Get GPU texture file data layout, false if not valid or data requires conversion
+static float *LoadImageFloatPixels(Image image);                                    // Load image base level pixels as RGBA32F normalized values
+static Image LoadCubemapImage(int size, int mipmaps, int format);                   // Load cubemap image (vertical line) for generated levels
+static void StoreCubemapLevel(Image *image, int level, const float *pixels);        // Store generated cubemap level pixels (RGBA32F) into cubemap image
+static int LoadCubemapLevels(CubemapPass *pass, Image cubemap, int minSize);        // Load source cubemap levels down to minimum size, returns levels count
+static void GenCubemapRows(int start, int end, void *userData);                     // Generate a range of cubemap faces rows (ParallelFor() task)
+static float Atan2Approx(float y, float x);                                         // Compute atan2() approximation (max error 1e-5 radians)
+static void BlendTexelsBilinear(const float *t00, const float *t10, const float *t01, const float *t11, float wx, float wy, float *color); // Blend RGBA32F texels (bilinear)
+static void SamplePanorama(const CubemapPass *pass, float u, float v, float *color); // Sample panorama (bilinear, horizontal wrap), u and v in pixels
+static void SampleCubemap(const CubemapPass *pass, const float *direction, float level, float *color); // Sample source cubemap by direction (trilinear)
+static void GetSHBasis(const float *direction, float *basis);                       // Get spherical harmonics basis (9 coefficients) for normalized direction
+static Image GenImageFromPass(GenImagePass *pass);                                  // Generate image rows in parallel, image data allocated for pass size
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenNoiseRow(const GenImagePass *pass, int y, float *buffers, float *values); // Generate a row of multi-octave noise values
+static void PerlinNoiseRow(const float *positions, float y, float z, unsigned char seed, float *values, int count); // Evaluate perlin noise for a row of positions (stb_perlin_noise3() compatible)
+#endif
+static bool InitImageSpanWriter(ImageSpanWriter *writer, Image *dst, Color color);  // Init span writer for image, returns false if image can not be drawn
+static void DrawImageSpan(const ImageSpanWriter *writer, int x, int y, int count, const unsigned char *coverage); // Draw a span of image row pixels, optional pixels coverage
+static void DrawImageSpanPixels(const ImageSpanWriter *writer, unsigned char *dst, const Color *colors, const unsigned char *coverage, int count); // Draw span pixels one by one (blending, coverage, shading)
+static void InitRasterEdges(RasterEdgeList *list);                                  // Init rasterizer edges list (local storage)
+static void AddRasterEdge(RasterEdgeList *list, Vector2 start, Vector2 end);        // Add outline edge to rasterizer edges list, horizontal edges ignored
+static void AddRasterPolygon(RasterEdgeList *list, const Vector2 *points, int pointCount, int orientation); // Add closed polygon outline, orientation forced if not 0 (1-Positive, -1-Negative area)
+static void AddRasterCircle(RasterEdgeList *list, Vector2 center, float radius, int orientation); // Add circle outline as polygon, segments count from radius
+static void AddRasterPolyline(RasterEdgeList *list, const Vector2 *points, int pointCount, float thick, bool closed); // Add thick lines outlines (butt caps, round joins), points at pixels centers
+static void RasterizeEdges(const ImageSpanWriter *writer, RasterEdgeList *list, bool antialias); // Rasterize edges list with non-zero winding rule, list is unloaded
+static int CompareRasterEdges(const void *a, const void *b);                        // Compare rasterizer edges top (qsort() callback)
+static void InitAdjustPass(AdjustPass *pass, const Image *image, const ImageAdjustments *adjustments); // Init color adjustments pass, lookup tables computed for image format
+static void AdjustColors(Color *colors, int count, const AdjustPass *pass);         // Apply color adjustments chain to 8 bit per channel colors
+static void AdjustPackedPixels(unsigned short *values, int count, const AdjustPass *pass); // Apply color adjustments chain to 16 bit packed pixels
+static void AdjustColorFloat(float *color, const AdjustPass *pass);                // Apply color adjustments chain to RGBA32F color
+static void ShiftColorsHSV(float *red, float *green, float *blue, int count, float hue, float saturation, float value); // Shift RGB colors (normalized) in HSV space: hue offset (degrees), saturation and value factors
+static void AdjustImageRows(int start, int end, void *userData);                    // Apply color adjustments to a range of image rows (ParallelFor() task)
+static bool InitComparePass(ComparePass *pass, Image image, Image reference);       // Init image comparison pass, returns false if images can not be compared
+static void CompareImageBands(int start, int end, void *userData);                  // Compare a range of bands of image rows, SSIM blocks included (ParallelFor() task)
+static void CompareRowBytes(const unsigned char *a, const unsigned char *b, int width, int bytesPerPixel, int threshold, CompareStats *stats); // Compare rows of 8 bit channels
+static void CompareRowFloat(const float *a, const float *b, int width, int channels, float tolerance, CompareStats *stats); // Compare rows of RGBA32F pixels, first channels only
+static void LoadImageRowLuminance(const unsigned char *src, int format, float *dst, int count); // Load a row of 8 bit per channel pixels luminance (normalized)
+static float ComputeSSIM(const double *sums, double count);                         // Compute SSIM from luminance sums: a, b, a^2 + b^2, a*b
+static void DiffImageRows(int start, int end, void *userData);                      // Compute absolute differences for a range of image rows (ParallelFor() task)
+static bool InitVirtualTextureLayout(VirtualTextureData *texture, int width, int height, int tileSize, int border); // Init virtual texture levels and tiles layout, returns false if not valid
+static void ExportVirtualTextureTiles(int start, int end, void *userData);          // Export a range of virtual texture level tiles (ParallelFor() task)
+static void RequestVirtualTextureTile(VirtualTextureData *texture, int tile);       // Request virtual texture tile async load, ignored if resident, loading or too many loads
+static void LoadVirtualTextureTile(void *userData);                                 // Copy virtual texture tile pixels from tiles file (async load step, worker thread)
+static void FinishVirtualTextureTile(void *userData);                               // Upload loaded virtual texture tile into cache (async finish step, main thread)
+static void ReleaseVirtualTextureTile(void *userData);                              // Free loaded virtual texture tile of cancelled load (async release step, main thread)
+static void UploadVirtualTextureTile(VirtualTextureData *texture, int tile, const unsigned char *pixels, bool pinned); // Upload tile into a cache slot (free or least recently used)
+static void UnloadVirtualTextureData(VirtualTextureData *texture);                  // Unload virtual texture internal data (tiles file mapping, cache state)
+static void PremultiplyColors(unsigned char *pixels, int count);                    // Premultiply RGBA8 pixels color by alpha (rounded)
+static void UnpremultiplyColors(unsigned char *pixels, int count);                  // Unpremultiply RGBA8 pixels color by alpha (reciprocals lookup table)
+static void ClearAlphaColors(unsigned char *pixels, int count, Color color, unsigned char threshold); // Set RGBA8 pixels with alpha under or equal threshold to color
+static void MergeAlphaMask(unsigned char *pixels, const unsigned char *mask, int count, int channels); // Set pixels alpha (last of channels) from grayscale mask
+static int FindImageAlphaPixel(Image image, int y, int start, int end, unsigned char threshold); // Find first pixel in image row range [start, end) with alpha over threshold, -1 if not found
+static unsigned char GetPixelAlpha(const void *data, int format, int index);        // Get pixel alpha (8 bit) from uncompressed pixel data
+static void QuantizeBoxBounds(QuantizeBox *box, const unsigned short *bins, const unsigned int *histogram); // Compute median cut box bounds and pixels count
+static void QuantizeLookup(int start, int end, void *userData);                     // Find nearest palette color for a range of histogram bins (ParallelFor() task)
+static void QuantizeRows(int start, int end, void *userData);                       // Map a range of image rows to palette colors (ParallelFor() task)
+static bool DecomposeKernel(const float *kernel, int size, float *kernelX, float *kernelY);  // Decompose square kernel as outer product kernelY x kernelX (if rank 1)
+static void ApplyConvolution(Image *image, const ConvolutionPass *pass);            // Apply convolution pass to image (RGBA8 processing)
+static void ConvolveRows(int start, int end, void *userData);                       // Convolve a range of image rows (ParallelFor() task)
+static void AccumulateLine(float *dst, const float *src, float weight, int count);  // Accumulate weighted line of values: dst += src*weight
+static void FloatToHalfArray(const float *src, unsigned short *dst, int count);     // Convert float array to half-float array
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -313,8 +832,8 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             // Offset file data to expected raw image by header size
             if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
 
-            image.data = RL_MALLOC(size);      // Allocate required memory in bytes
-            memcpy(image.data, dataPtr, size); // Copy required data to image
+            image.data = LoadImageBuffer(size); // Allocate required memory in bytes
+            memcpy(image.data, dataPtr, size);  // Copy required data to image
             image.width = width;
             image.height = height;
             image.mipmaps = 1;
@@ -410,6 +929,170 @@ Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileDat
     return image;
 }
 
+// Load animated image for streaming playback, frames are decoded on demand into a single frame image
+// NOTE: Only GIF files are animated, other supported image files are loaded as a single frame
+AnimatedImage LoadAnimatedImage(const char *fileName)
+{
+    AnimatedImage image = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        image = LoadAnimatedImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        UnloadFileData(fileData);
+    }
+
+    return image;
+}
+
+// Load animated image from memory buffer, fileType refers to extension: i.e. '.gif'
+// NOTE: File data is copied, animated image decodes frames from its own copy
+AnimatedImage LoadAnimatedImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    AnimatedImage image = { 0 };
+
+    // Security check for input data
+    if ((fileType == NULL) || (fileData == NULL) || (dataSize == 0)) return image;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((strcmp(fileType, ".gif") == 0) || (strcmp(fileType, ".GIF") == 0))
+    {
+        AnimatedImageDecoder *decoder = (AnimatedImageDecoder *)RL_CALLOC(1, sizeof(AnimatedImageDecoder));
+        decoder->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        decoder->dataSize = dataSize;
+        memcpy(decoder->fileData, fileData, dataSize);
+
+        image.frameCount = ScanAnimatedImageGIF(decoder->fileData, dataSize, &image.delays, &image.disposals);
+
+        if ((image.frameCount > 0) && DecodeAnimatedImageFrame(decoder, true))
+        {
+            image.frame.data = decoder->gif.out;
+            image.frame.width = decoder->gif.w;
+            image.frame.height = decoder->gif.h;
+            image.frame.mipmaps = 1;
+            image.frame.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            image.data = decoder;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to load animated image data");
+
+            RL_FREE(decoder->gif.out);
+            RL_FREE(decoder->gif.background);
+            RL_FREE(decoder->gif.history);
+            RL_FREE(decoder->fileData);
+            RL_FREE(decoder);
+            RL_FREE(image.delays);
+            RL_FREE(image.disposals);
+
+            return (AnimatedImage){ 0 };
+        }
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        image.frame = LoadImageFromMemory(fileType, fileData, dataSize);
+
+        if (image.frame.data != NULL)
+        {
+            ImageFormat(&image.frame, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            image.frameCount = 1;
+            image.delays = (int *)RL_CALLOC(1, sizeof(int));
+            image.disposals = (int *)RL_CALLOC(1, sizeof(int));
+        }
+    }
+
+    if (image.frameCount > 0) TRACELOG(LOG_INFO, "IMAGE: Animated image loaded successfully (%ix%i | %i frames)", image.frame.width, image.frame.height, image.frameCount);
+
+    return image;
+}
+
+// Check if an animated image is valid (current frame image and frames data)
+bool IsAnimatedImageValid(AnimatedImage image)
+{
+    return ((image.frameCount > 0) && (image.delays != NULL) && IsImageValid(image.frame));
+}
+
+// Unload animated image: decoder data, frames data and current frame image
+void UnloadAnimatedImage(AnimatedImage image)
+{
+    AnimatedImageDecoder *decoder = (AnimatedImageDecoder *)image.data;
+
+    if (decoder != NULL)
+    {
+        // Current frame image data is the decoder canvas
+    #if defined(SUPPORT_FILEFORMAT_GIF)
+        RL_FREE(decoder->gif.out);
+        RL_FREE(decoder->gif.background);
+        RL_FREE(decoder->gif.history);
+    #endif
+        RL_FREE(decoder->fileData);
+        RL_FREE(decoder);
+    }
+    else UnloadImage(image.frame);
+
+    RL_FREE(image.delays);
+    RL_FREE(image.disposals);
+}
+
+// Update animated image current frame, decoding frames from current frame (or from first frame if going back)
+// NOTE: Sequential playback decodes one frame per update, frame image data is updated in place
+bool UpdateAnimatedImageFrame(AnimatedImage *image, int frame)
+{
+    if ((image == NULL) || (frame < 0) || (frame >= image->frameCount)) return false;
+    if (frame == image->currentFrame) return true;
+
+    bool result = false;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    AnimatedImageDecoder *decoder = (AnimatedImageDecoder *)image->data;
+
+    if (decoder != NULL)
+    {
+        bool rewind = (frame < image->currentFrame);
+        int current = rewind? 0 : image->currentFrame;
+        result = true;
+
+        if (rewind) result = DecodeAnimatedImageFrame(decoder, true);
+
+        for (; result && (current < frame); current++) result = DecodeAnimatedImageFrame(decoder, false);
+
+        // Canvas could be reallocated by restarting decoding
+        image->frame.data = decoder->gif.out;
+        image->currentFrame = result? frame : current;
+
+        if (!result) TRACELOG(LOG_WARNING, "IMAGE: Failed to decode animated image frame %i", current);
+    }
+#endif
+
+    return result;
+}
+
+// Get animated image frame index at playback time (in seconds), playback loops over all frames
+// NOTE: Frames with no delay are shown for 100 ms (common browsers behaviour)
+int GetAnimatedImageFrameIndex(AnimatedImage image, float time)
+{
+    if ((image.frameCount <= 1) || (image.delays == NULL) || (time <= 0.0f)) return 0;
+
+    int duration = 0;
+    for (int i = 0; i < image.frameCount; i++) duration += (image.delays[i] > 0)? image.delays[i] : 100;
+
+    int position = (int)fmod((double)time*1000.0, (double)duration);
+    int frame = 0;
+
+    for (; frame < image.frameCount - 1; frame++)
+    {
+        position -= (image.delays[frame] > 0)? image.delays[frame] : 100;
+        if (position < 0) break;
+    }
+
+    return frame;
+}
+
 // Load image from memory buffer, fileType refers to extension: i.e. ".png"
 // WARNING: File extension must be provided in lower-case
 Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -552,6 +1235,83 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     return image;
 }
 
+// Load image from file into an existing image, reusing its pixel buffer if possible
+// NOTE: Pixel buffer is reused when loaded image requires the same size (i.e. same dimensions and format),
+// raw files (.raw) are loaded using destination image dimensions and format, on failure image is unloaded
+bool LoadImageInto(Image *dst, const char *fileName)
+{
+    if (dst == NULL) return false;
+
+    bool result = false;
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        result = LoadImageFromMemoryInto(dst, GetFileExtension(fileName), fileData, dataSize);
+
+        UnloadFileData(fileData);
+    }
+    else
+    {
+        UnloadImage(*dst);
+        *dst = (Image){ 0 };
+    }
+
+    return result;
+}
+
+// Load image from memory buffer into an existing image, reusing its pixel buffer if possible
+// NOTE: Current pixel buffer is offered to decoders through image pool, it is taken by the
+// first allocation of the same size: decoded pixels (PNG, QOI...) or copied raw data (.raw)
+bool LoadImageFromMemoryInto(Image *dst, const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    if (dst == NULL) return false;
+
+    Image previous = *dst;
+    Image image = { 0 };
+    int size = GetImageBufferSize(previous);
+
+    UnloadImageBuffer(previous.data, size, true);
+
+    if ((fileType != NULL) && ((strcmp(fileType, ".raw") == 0) || (strcmp(fileType, ".RAW") == 0)))
+    {
+        // Raw data is interpreted with destination image parameters
+        int rawSize = GetPixelDataSize(previous.width, previous.height, previous.format);
+
+        if ((fileData != NULL) && (rawSize > 0) && (rawSize <= dataSize))
+        {
+            image.data = LoadImageBuffer(rawSize);
+            memcpy(image.data, fileData, rawSize);
+            image.width = previous.width;
+            image.height = previous.height;
+            image.mipmaps = 1;
+            image.format = previous.format;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Raw data size does not match destination image");
+    }
+    else image = LoadImageFromMemory(fileType, fileData, dataSize);
+
+    // Pixel buffer not reused, make sure it does not stay in pool over its size limit
+    if ((image.data != previous.data) && (size > 0) && RemoveImageBuffer(previous.data)) UnloadImageBuffer(previous.data, size, false);
+
+    *dst = image;
+
+    return (image.data != NULL);
+}
+
+// Load image from file asynchronously, file loading and decoding runs on a worker thread
+// NOTE: Image is set by UpdateAsyncLoads() when load finishes, destination must remain valid until then
+unsigned int LoadImageAsync(const char *fileName, Image *image)
+{
+    if ((fileName == NULL) || (image == NULL)) return 0;
+
+    AsyncImageLoad *request = LoadAsyncImageRequest(fileName);
+    request->dstImage = image;
+
+    return LoadAsync(LoadAsyncImage, FinishAsyncImage, ReleaseAsyncImage, request);
+}
+
 // Load image from GPU texture data
 // NOTE: Compressed texture formats not supported
 Image LoadImageFromTexture(Texture2D texture)
@@ -614,9 +1374,30 @@ bool IsImageValid(Image image)
 }
 
 // Unload image from CPU memory (RAM)
+// NOTE: Pixel buffer is retained for reuse if image pool is enabled (SetImagePoolSize())
 void UnloadImage(Image image)
 {
-    RL_FREE(image.data);
+    UnloadImageBuffer(image.data, GetImageBufferSize(image), false);
+}
+
+// Set max number of pixel buffers retained by image pool for reuse
+// NOTE: Pool is disabled by default (0), buffers over the new size are freed
+void SetImagePoolSize(int count)
+{
+    void *released[MAX_IMAGE_POOL_BUFFERS] = { 0 };
+    int releasedCount = 0;
+
+    if (count < 0) count = 0;
+    if (count > MAX_IMAGE_POOL_BUFFERS) count = MAX_IMAGE_POOL_BUFFERS;
+
+    AcquireSpinLock(&imagePool.lock);
+
+    imagePool.maxCount = count;
+    while (imagePool.count > count) released[releasedCount++] = imagePool.buffers[--imagePool.count];
+
+    ReleaseSpinLock(&imagePool.lock);
+
+    for (int i = 0; i < releasedCount; i++) RL_FREE(released[i]);
 }
 
 // Export image data to file
@@ -648,7 +1429,7 @@ bool ExportImage(Image image, const char *fileName)
     if (IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+        unsigned char *fileData = EncodeImagePNG((const unsigned char *)imgData, image.width, image.height, channels, &dataSize);
         result = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
@@ -727,7 +1508,7 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        fileData = EncodeImagePNG((const unsigned char *)image.data, image.width, image.height, channels, dataSize);
     }
 #endif
 
@@ -736,6 +1517,18 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
     return fileData;
 }
 
+// Set PNG export options: compression level (0..8, default 4), rows filter mode and multithreaded compression
+// NOTE: Multithreaded compression splits image in parts compressed independently, files are slightly bigger
+void SetImageExportOptions(int compressionLevel, int filterMode, bool threaded)
+{
+    if (compressionLevel < 0) compressionLevel = 0;
+    if (compressionLevel > 8) compressionLevel = 8;
+
+    pngCompressionLevel = compressionLevel;
+    pngFilterMode = filterMode;
+    pngThreaded = threaded;
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool ExportImageAsCode(Image image, const char *fileName)
 {
@@ -794,314 +1587,424 @@ bool ExportImageAsCode(Image image, const char *fileName)
 }
 
 //------------------------------------------------------------------------------------
-// Image generation functions
+// Mapped image functions
 //------------------------------------------------------------------------------------
-// Generate image: plain color
-Image GenImageColor(int width, int height, Color color)
-{
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
-
-    for (int i = 0; i < width*height; i++) pixels[i] = color;
-
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
-
-    return image;
-}
 
-#if defined(SUPPORT_IMAGE_GENERATION)
-// Generate image: linear gradient
-// The direction value specifies the direction of the gradient (in degrees)
-// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
-// The gradient effectively rotates counter-clockwise by the specified amount
-Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
+// Load mapped image from RAW file data, pixel data is accessed through file memory mapping
+// NOTE: Only accessed regions are loaded in RAM (by the OS), writable images are created
+// or extended (zero filled) if required and changes are written to file on unload
+MappedImage LoadMappedImage(const char *fileName, int width, int height, int format, int headerSize, bool writable)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    MappedImage image = { 0 };
 
-    float radianDirection = (float)(90 - direction)/180.f*3.14159f;
-    float cosDir = cosf(radianDirection);
-    float sinDir = sinf(radianDirection);
+    if ((width <= 0) || (height <= 0) || (headerSize < 0)) return image;
 
-    for (int i = 0; i < width; i++)
+    if ((format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (i*cosDir + j*sinDir)/(width*cosDir + height*sinDir);
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped images only support uncompressed pixel formats");
+        return image;
+    }
 
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [0,1]
-            factor = (factor < 0.0f)? 0.0f : factor;  // Clamp to [0,1]
+    size_t size = (size_t)headerSize + (size_t)width*(size_t)height*(size_t)GetPixelDataSize(1, 1, format);
+    unsigned char *fileData = MapFileData(fileName, size, writable, &image.handle);
 
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
+    if (fileData != NULL)
+    {
+        image.data = fileData + headerSize;
+        image.width = width;
+        image.height = height;
+        image.format = format;
+        image.headerSize = headerSize;
+        image.writable = writable;
+
+        TRACELOG(LOG_INFO, "IMAGE: Mapped image loaded successfully (%ix%i | %s)", image.width, image.height, rlGetPixelFormatName(image.format));
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
-
     return image;
 }
 
-// Generate image: radial gradient
-Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+// Check if a mapped image is valid (data and parameters)
+bool IsMappedImageValid(MappedImage image)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+    return ((image.data != NULL) && (image.width > 0) && (image.height > 0) &&
+        (image.format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB));
+}
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
+// Unload mapped image, changes on writable images are written to file
+void UnloadMappedImage(MappedImage image)
+{
+    if (image.data == NULL) return;
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
+    size_t size = (size_t)image.headerSize + (size_t)image.width*(size_t)image.height*(size_t)GetPixelDataSize(1, 1, image.format);
+    UnmapFileData((unsigned char *)image.data - image.headerSize, size, image.handle);
+}
+
+// Load image from mapped image region (pixel data copied into RAM)
+// NOTE: Region is clipped to mapped image bounds
+Image LoadImageRegion(MappedImage image, Rectangle region)
+{
+    Image result = { 0 };
 
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+    if (!IsMappedImageValid(image)) return result;
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
+    int x0 = ((int)region.x < 0)? 0 : (int)region.x;
+    int y0 = ((int)region.y < 0)? 0 : (int)region.y;
+    int x1 = ((int)(region.x + region.width) > image.width)? image.width : (int)(region.x + region.width);
+    int y1 = ((int)(region.y + region.height) > image.height)? image.height : (int)(region.y + region.height);
+
+    if ((x1 <= x0) || (y1 <= y0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Requested region is out of mapped image bounds");
+        return result;
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+    int rowSize = (x1 - x0)*bytesPerPixel;
 
-    return image;
+    result.data = RL_MALLOC((size_t)rowSize*(y1 - y0));
+    result.width = x1 - x0;
+    result.height = y1 - y0;
+    result.mipmaps = 1;
+    result.format = image.format;
+
+    for (int y = y0; y < y1; y++)
+    {
+        memcpy((unsigned char *)result.data + (size_t)(y - y0)*rowSize, (unsigned char *)image.data + ((size_t)y*image.width + x0)*bytesPerPixel, rowSize);
+    }
+
+    return result;
 }
 
-// Generate image: square gradient
-Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer)
+// Update mapped image region with new pixel data
+// NOTE: Pixel data must be in mapped image format, region size defines pixels data size,
+// region is clipped to mapped image bounds
+void UpdateImageRegion(MappedImage image, Rectangle region, const void *pixels)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    if (!IsMappedImageValid(image) || (pixels == NULL)) return;
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
+    if (!image.writable)
     {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped image is not writable");
+        return;
+    }
 
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+    int width = (int)region.width;
+    int x0 = ((int)region.x < 0)? 0 : (int)region.x;
+    int y0 = ((int)region.y < 0)? 0 : (int)region.y;
+    int x1 = ((int)region.x + width > image.width)? image.width : (int)region.x + width;
+    int y1 = ((int)region.y + (int)region.height > image.height)? image.height : (int)region.y + (int)region.height;
 
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
+    if ((x1 <= x0) || (y1 <= y0)) return;
 
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
 
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
+    for (int y = y0; y < y1; y++)
+    {
+        const unsigned char *src = (const unsigned char *)pixels + ((size_t)(y - (int)region.y)*width + (x0 - (int)region.x))*bytesPerPixel;
+        memcpy((unsigned char *)image.data + ((size_t)y*image.width + x0)*bytesPerPixel, src, (size_t)(x1 - x0)*bytesPerPixel);
     }
+}
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+// Get number of tiles (tileSize x tileSize) covering mapped image
+int GetMappedImageTileCount(MappedImage image, int tileSize)
+{
+    if (!IsMappedImageValid(image) || (tileSize <= 0)) return 0;
 
-    return image;
+    return ((image.width + tileSize - 1)/tileSize)*((image.height + tileSize - 1)/tileSize);
 }
 
-// Generate image: checked
-Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+// Get mapped image tile rectangle, tiles are ordered by rows and clipped to image bounds
+// NOTE: Useful to iterate over a mapped image keeping a limited working set in RAM:
+// for (int i = 0; i < GetMappedImageTileCount(image, 512); i++) LoadImageRegion(image, GetMappedImageTile(image, 512, i))
+Rectangle GetMappedImageTile(MappedImage image, int tileSize, int index)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    Rectangle tile = { 0 };
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
-        }
-    }
+    if ((index < 0) || (index >= GetMappedImageTileCount(image, tileSize))) return tile;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    int columns = (image.width + tileSize - 1)/tileSize;
+    int x = (index%columns)*tileSize;
+    int y = (index/columns)*tileSize;
 
-    return image;
+    tile.x = (float)x;
+    tile.y = (float)y;
+    tile.width = (float)(((x + tileSize) > image.width)? (image.width - x) : tileSize);
+    tile.height = (float)(((y + tileSize) > image.height)? (image.height - y) : tileSize);
+
+    return tile;
 }
 
-// Generate image: white noise
-// NOTE: It requires GetRandomValue(), defined in [rcore]
-Image GenImageWhiteNoise(int width, int height, float factor)
+// Crop mapped image region into destination mapped image, pixels are converted to destination format
+// NOTE: Crop is clipped to source bounds and destination size, processed by tiles (in parallel)
+void MappedImageCrop(MappedImage src, Rectangle crop, MappedImage dst)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    if (!IsMappedImageValid(src) || !IsMappedImageValid(dst)) return;
 
-    for (int i = 0; i < width*height; i++)
+    if (!dst.writable)
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
+        TRACELOG(LOG_WARNING, "IMAGE: Destination mapped image is not writable");
+        return;
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    int x0 = ((int)crop.x < 0)? 0 : (int)crop.x;
+    int y0 = ((int)crop.y < 0)? 0 : (int)crop.y;
+    int x1 = ((int)(crop.x + crop.width) > src.width)? src.width : (int)(crop.x + crop.width);
+    int y1 = ((int)(crop.y + crop.height) > src.height)? src.height : (int)(crop.y + crop.height);
 
-    return image;
-}
+    MappedImagePass pass = { 0 };
+    pass.src = src;
+    pass.dst = dst;
+    pass.x = x0;
+    pass.y = y0;
+    pass.width = ((x1 - x0) > dst.width)? dst.width : (x1 - x0);
+    pass.height = ((y1 - y0) > dst.height)? dst.height : (y1 - y0);
 
-// Generate image: perlin noise
-Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
-{
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    if ((pass.width <= 0) || (pass.height <= 0)) return;
 
-    float aspectRatio = (float)width / (float)height;
-    for (int y = 0; y < height; y++)
+    if (src.format == dst.format)
     {
-        for (int x = 0; x < width; x++)
+        // Same format, rows are copied directly between mappings
+        int bytesPerPixel = GetPixelDataSize(1, 1, src.format);
+
+        for (int y = 0; y < pass.height; y++)
         {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
+            memcpy((unsigned char *)dst.data + (size_t)y*dst.width*bytesPerPixel,
+                (unsigned char *)src.data + ((size_t)(y0 + y)*src.width + x0)*bytesPerPixel, (size_t)pass.width*bytesPerPixel);
+        }
+    }
+    else
+    {
+        int columns = (pass.width + MAPPED_IMAGE_TILE_SIZE - 1)/MAPPED_IMAGE_TILE_SIZE;
+        int rows = (pass.height + MAPPED_IMAGE_TILE_SIZE - 1)/MAPPED_IMAGE_TILE_SIZE;
 
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
+        ParallelFor(columns*rows, 1, MappedImageConvertTiles, &pass);
+    }
+}
 
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+// Convert mapped image into destination mapped image format (same size required)
+void MappedImageFormat(MappedImage src, MappedImage dst)
+{
+    if ((src.width != dst.width) || (src.height != dst.height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped images size does not match, use MappedImageCrop()");
+        return;
+    }
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+    MappedImageCrop(src, (Rectangle){ 0, 0, (float)src.width, (float)src.height }, dst);
+}
 
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
+// Resize mapped image into destination mapped image size (Bicubic scaling algorithm)
+// NOTE: Destination is processed by bands of rows (in parallel), every band only reads
+// the source rows it requires, source and destination formats must match
+void MappedImageResize(MappedImage src, MappedImage dst)
+{
+    if (!IsMappedImageValid(src) || !IsMappedImageValid(dst)) return;
 
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    if (!dst.writable)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Destination mapped image is not writable");
+        return;
+    }
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
+    if (src.format != dst.format)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped images format does not match, use MappedImageFormat()");
+        return;
     }
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    if ((src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+        (src.format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+        (src.format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped image resize not supported for packed 16bit formats");
+        return;
+    }
 
-    return image;
+    MappedImagePass pass = { 0 };
+    pass.src = src;
+    pass.dst = dst;
+    pass.width = dst.width;
+    pass.height = dst.height;
+
+    ParallelFor((dst.height + MAPPED_IMAGE_TILE_SIZE - 1)/MAPPED_IMAGE_TILE_SIZE, 1, MappedImageResizeBands, &pass);
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
-Image GenImageCellular(int width, int height, int tileSize)
+//------------------------------------------------------------------------------------
+// Image generation functions
+//------------------------------------------------------------------------------------
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
 {
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_COLOR;
+    pass.colors[0] = color;
+
+    return GenImageFromPass(&pass);
+}
 
-    int seedsPerRow = width/tileSize;
-    int seedsPerCol = height/tileSize;
-    int seedCount = seedsPerRow*seedsPerCol;
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate image: linear gradient
+// The direction value specifies the direction of the gradient (in degrees)
+// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
+// The gradient effectively rotates counter-clockwise by the specified amount
+Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
+{
+    float radianDirection = (float)(90 - direction)/180.f*3.14159f;
+    float cosDir = cosf(radianDirection);
+    float sinDir = sinf(radianDirection);
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+    // Relative position of the pixel along the gradient direction: pos = (x*cosDir + y*sinDir)/length
+    float length = width*cosDir + height*sinDir;
 
-    for (int i = 0; i < seedCount; i++)
-    {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
-    }
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_GRADIENT_LINEAR;
+    pass.colors[0] = start;
+    pass.colors[1] = end;
+    pass.direction[0] = cosDir/length;
+    pass.direction[1] = sinDir/length;
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
+    return GenImageFromPass(&pass);
+}
 
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
+// Generate image: radial gradient
+Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
+{
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_GRADIENT_RADIAL;
+    pass.colors[0] = inner;
+    pass.colors[1] = outer;
+    pass.center[0] = (float)width/2.0f;
+    pass.center[1] = (float)height/2.0f;
+    pass.start = radius*density;
+    pass.scale = 1.0f/(radius*(1.0f - density));
+
+    return GenImageFromPass(&pass);
+}
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+// Generate image: square gradient
+Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_GRADIENT_SQUARE;
+    pass.colors[0] = inner;
+    pass.colors[1] = outer;
+    pass.center[0] = (float)width/2.0f;
+    pass.center[1] = (float)height/2.0f;
+    pass.start = density;
+    pass.scale = 1.0f/(1.0f - density);
+
+    return GenImageFromPass(&pass);
+}
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+// Generate image: checked
+Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_CHECKED;
+    pass.colors[0] = col1;
+    pass.colors[1] = col2;
+    pass.checks[0] = checksX;
+    pass.checks[1] = checksY;
+
+    return GenImageFromPass(&pass);
+}
+
+// Generate image: white noise
+// NOTE: It requires GetRandomValue(), defined in [rcore], to seed a per-pixel hash (independent of threads count)
+Image GenImageWhiteNoise(int width, int height, float factor)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_WHITE_NOISE;
+    pass.threshold = (unsigned int)((factor > 0.0f)? (int)(factor*100.0f) : 0);
+    pass.seed = ((unsigned int)GetRandomValue(0, 0x7fff) << 15) | (unsigned int)GetRandomValue(0, 0x7fff);
+
+    return GenImageFromPass(&pass);
+}
 
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+// Generate image: perlin noise
+// NOTE: Calculates a perlin noise using fbm (fractal brownian motion), same as GenImageNoise() with NOISE_FBM, 6 octaves and seed 0
+Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
+{
+    return GenImageNoise(width, height, offsetX, offsetY, scale, NOISE_FBM, 6, 0);
+}
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
+// Generate image: multi-octave perlin noise (NoiseType)
+// NOTE: Octaves use lacunarity 2.0 (spacing between successive octaves) and gain 0.5 (relative weighting of successive octaves),
+// different seeds select different noise permutations, output is normalized to [0..1] grayscale intensity
+Image GenImageNoise(int width, int height, int offsetX, int offsetY, float scale, int type, int octaves, int seed)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_NOISE;
+    pass.offset[0] = offsetX;
+    pass.offset[1] = offsetY;
+    pass.scale = scale;
+    pass.noiseType = type;
+    pass.octaves = octaves;
+    pass.seed = (unsigned int)seed;
+
+    return GenImageFromPass(&pass);
+}
 
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+// Generate image: multi-octave perlin noise (NoiseType) as float values, normalized to [0..1], i.e. for heightmaps
+// NOTE: Values are not quantized to 8 bit, image format is PIXELFORMAT_UNCOMPRESSED_R32
+Image GenImageNoiseFloat(int width, int height, int offsetX, int offsetY, float scale, int type, int octaves, int seed)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_NOISE;
+    pass.offset[0] = offsetX;
+    pass.offset[1] = offsetY;
+    pass.scale = scale;
+    pass.noiseType = type;
+    pass.octaves = octaves;
+    pass.seed = (unsigned int)seed;
+    pass.floatOutput = true;
+
+    return GenImageFromPass(&pass);
+}
 
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
+// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+Image GenImageCellular(int width, int height, int tileSize)
+{
+    GenImagePass pass = { 0 };
+    pass.width = width;
+    pass.height = height;
+    pass.generator = GEN_IMAGE_CELLULAR;
+    pass.tileSize = tileSize;
+    pass.cellsPerRow = width/tileSize;
+    pass.cellsPerCol = height/tileSize;
+
+    int seedCount = pass.cellsPerRow*pass.cellsPerCol;
+    int *seeds = (int *)RL_MALLOC(2*seedCount*sizeof(int));
+
+    for (int i = 0; i < seedCount; i++)
+    {
+        seeds[2*i + 1] = (i/pass.cellsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[2*i] = (i%pass.cellsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
     }
 
-    RL_FREE(seeds);
+    pass.cells = seeds;
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    Image image = GenImageFromPass(&pass);
+
+    RL_FREE(seeds);
 
     return image;
 }
@@ -1124,6 +2027,183 @@ Image GenImageText(int width, int height, const char *text)
 
     return image;
 }
+
+// Generate cubemap image from equirectangular panorama image, faces in a vertical line (CUBEMAP_LAYOUT_LINE_VERTICAL)
+// NOTE: Panorama top row is +Y direction and horizontal center is +X direction, panorama is bilinear sampled,
+// HDR panoramas (float and half float formats) generate R32G32B32A32 cubemaps, other formats generate R8G8B8A8 cubemaps
+Image GenImageCubemap(Image panorama, int size)
+{
+    Image image = { 0 };
+
+    if ((panorama.data == NULL) || (panorama.width <= 0) || (panorama.height <= 0) || (size <= 0) || (panorama.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Cubemap generation requires an uncompressed panorama image");
+        return image;
+    }
+
+    CubemapPass pass = { 0 };
+    pass.type = CUBEMAP_PASS_PANORAMA;
+    pass.size = size;
+    pass.panorama = LoadImageFloatPixels(panorama);
+    pass.panoramaWidth = panorama.width;
+    pass.panoramaHeight = panorama.height;
+    pass.output = (float *)RL_MALLOC((size_t)6*size*size*4*sizeof(float));
+
+    image = LoadCubemapImage(size, 1, ((panorama.format >= PIXELFORMAT_UNCOMPRESSED_R32) && (panorama.format <= PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))?
+        PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int minRows = GENERATION_BATCH_PIXELS/(size*8);
+    ParallelFor(6*size, (minRows > 1)? minRows : 1, GenCubemapRows, &pass);
+    StoreCubemapLevel(&image, 0, pass.output);
+
+    RL_FREE((void *)pass.panorama);
+    RL_FREE(pass.output);
+
+    return image;
+}
+
+// Generate diffuse irradiance cubemap image from cubemap image, faces in a vertical line (CUBEMAP_LAYOUT_LINE_VERTICAL)
+// NOTE: Irradiance is convolved with spherical harmonics (9 coefficients) and divided by PI,
+// an uniform environment generates the same color, small sizes are enough (i.e. 32)
+Image GenImageCubemapIrradiance(Image cubemap, int size)
+{
+    Image image = { 0 };
+
+    CubemapPass pass = { 0 };
+    if ((size <= 0) || (LoadCubemapLevels(&pass, cubemap, 0) == 0)) return image;
+
+    // Project source cubemap on spherical harmonics, per row sums are reduced in order (deterministic)
+    int sourceSize = pass.levelSizes[0];
+    pass.type = CUBEMAP_PASS_PROJECT;
+    pass.size = sourceSize;
+    pass.projection = (float *)RL_MALLOC((size_t)6*sourceSize*36*sizeof(float));
+
+    int minRows = GENERATION_BATCH_PIXELS/(sourceSize*4);
+    ParallelFor(6*sourceSize, (minRows > 1)? minRows : 1, GenCubemapRows, &pass);
+
+    double sh[36] = { 0 };
+    for (int i = 0; i < 6*sourceSize; i++)
+    {
+        for (int k = 0; k < 36; k++) sh[k] += pass.projection[i*36 + k];
+    }
+
+    // Lambertian convolution per band divided by PI: 1, 2/3, 1/4
+    for (int k = 0; k < 9; k++)
+    {
+        float band = (k == 0)? 1.0f : (k < 4)? 2.0f/3.0f : 0.25f;
+        for (int c = 0; c < 4; c++) pass.sh[k][c] = (float)sh[k*4 + c]*band;
+    }
+
+    pass.type = CUBEMAP_PASS_IRRADIANCE;
+    pass.size = size;
+    pass.output = (float *)RL_MALLOC((size_t)6*size*size*4*sizeof(float));
+
+    image = LoadCubemapImage(size, 1, ((cubemap.format >= PIXELFORMAT_UNCOMPRESSED_R32) && (cubemap.format <= PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))?
+        PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    minRows = GENERATION_BATCH_PIXELS/(size*8);
+    ParallelFor(6*size, (minRows > 1)? minRows : 1, GenCubemapRows, &pass);
+    StoreCubemapLevel(&image, 0, pass.output);
+
+    for (int i = 0; i < pass.levelCount; i++) RL_FREE((void *)pass.levels[i]);
+    RL_FREE(pass.projection);
+    RL_FREE(pass.output);
+
+    return image;
+}
+
+// Generate specular prefiltered cubemap image from cubemap image, faces in a vertical line (CUBEMAP_LAYOUT_LINE_VERTICAL)
+// NOTE: Every mipmap level is prefiltered with GGX distribution, roughness = level/(mipmaps - 1),
+// source is importance sampled from its own mipmap levels (filtered importance sampling)
+Image GenImageCubemapPrefiltered(Image cubemap, int size, int mipmaps)
+{
+    Image image = { 0 };
+
+    CubemapPass pass = { 0 };
+    if ((size <= 0) || (LoadCubemapLevels(&pass, cubemap, 1) == 0)) return image;
+
+    // Mipmap levels faces size must be exact (size/2^level), cubemap mipmaps data is loaded per face
+    int maxMipmaps = 1;
+    while (((size%(2 << (maxMipmaps - 1))) == 0) && (maxMipmaps < CUBEMAP_MAX_LEVELS)) maxMipmaps++;
+    if (mipmaps > maxMipmaps) mipmaps = maxMipmaps;
+    if (mipmaps < 1) mipmaps = 1;
+
+    image = LoadCubemapImage(size, mipmaps, ((cubemap.format >= PIXELFORMAT_UNCOMPRESSED_R32) && (cubemap.format <= PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))?
+        PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    float *samples = (float *)RL_MALLOC(CUBEMAP_PREFILTER_SAMPLES*5*sizeof(float));
+    pass.type = CUBEMAP_PASS_PREFILTER;
+    pass.samples = samples;
+    pass.output = (float *)RL_MALLOC((size_t)6*size*size*4*sizeof(float));
+
+    float texelSolidAngle = 4.0f*PI/(6.0f*pass.levelSizes[0]*pass.levelSizes[0]);
+
+    for (int level = 0; level < mipmaps; level++)
+    {
+        int levelSize = size >> level;
+        float roughness = (mipmaps > 1)? (float)level/(float)(mipmaps - 1) : 0.0f;
+        float alpha2 = roughness*roughness*roughness*roughness;
+
+        // Source level covering at least one output texel
+        float minSourceLevel = log2f((float)pass.levelSizes[0]/(float)levelSize);
+        if (minSourceLevel < 0.0f) minSourceLevel = 0.0f;
+
+        // Samples are the same for every texel in tangent space (N = V = R assumption)
+        pass.sampleCount = 0;
+
+        if (roughness == 0.0f)
+        {
+            float mirror[5] = { 0.0f, 0.0f, 1.0f, 1.0f, minSourceLevel };
+            memcpy(samples, mirror, sizeof(mirror));
+            pass.sampleCount = 1;
+        }
+        else
+        {
+            for (unsigned int i = 0; i < CUBEMAP_PREFILTER_SAMPLES; i++)
+            {
+                // Hammersley point set, GGX distribution half vector
+                unsigned int bits = i;
+                bits = (bits << 16) | (bits >> 16);
+                bits = ((bits & 0x55555555u) << 1) | ((bits & 0xaaaaaaaau) >> 1);
+                bits = ((bits & 0x33333333u) << 2) | ((bits & 0xccccccccu) >> 2);
+                bits = ((bits & 0x0f0f0f0fu) << 4) | ((bits & 0xf0f0f0f0u) >> 4);
+                bits = ((bits & 0x00ff00ffu) << 8) | ((bits & 0xff00ff00u) >> 8);
+
+                float phi = 2.0f*PI*(float)i/(float)CUBEMAP_PREFILTER_SAMPLES;
+                float e = (float)bits*2.3283064365386963e-10f;
+                float cosTheta = sqrtf((1.0f - e)/(1.0f + (alpha2 - 1.0f)*e));
+                float sinTheta = sqrtf(1.0f - cosTheta*cosTheta);
+
+                // Light direction reflected by half vector, weighted by NdotL
+                float nDotL = 2.0f*cosTheta*cosTheta - 1.0f;
+                if (nDotL <= 0.0f) continue;
+
+                float d = (cosTheta*cosTheta*(alpha2 - 1.0f) + 1.0f);
+                float pdf = alpha2/(PI*d*d)/4.0f;
+                float sourceLevel = 0.5f*log2f(1.0f/(CUBEMAP_PREFILTER_SAMPLES*pdf)/texelSolidAngle) + 1.0f;
+
+                float *sample = samples + pass.sampleCount*5;
+                sample[0] = 2.0f*cosTheta*sinTheta*cosf(phi);
+                sample[1] = 2.0f*cosTheta*sinTheta*sinf(phi);
+                sample[2] = nDotL;
+                sample[3] = nDotL;
+                sample[4] = (sourceLevel > minSourceLevel)? sourceLevel : minSourceLevel;
+                pass.sampleCount++;
+            }
+        }
+
+        pass.size = levelSize;
+        int minRows = GENERATION_BATCH_PIXELS/(levelSize*pass.sampleCount*8);
+        ParallelFor(6*levelSize, (minRows > 1)? minRows : 1, GenCubemapRows, &pass);
+        StoreCubemapLevel(&image, level, pass.output);
+    }
+
+    for (int i = 0; i < pass.levelCount; i++) RL_FREE((void *)pass.levels[i]);
+    RL_FREE(samples);
+    RL_FREE(pass.output);
+
+    return image;
+}
 #endif      // SUPPORT_IMAGE_GENERATION
 
 //------------------------------------------------------------------------------------
@@ -1249,189 +2329,203 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
-
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+            // Try a format-pair specialized conversion first, fallback to generic conversion through normalized float data
+            // NOTE: Formats pair support is checked before taking a pixel buffer from image pool
+            if (ConvertImageData(NULL, image->format, NULL, newFormat, 0))
+            {
+                void *data = LoadImageBuffer(GetPixelDataSize(image->width, image->height, newFormat));
+                ConvertImageData(image->data, image->format, data, newFormat, image->width*image->height);
 
-            switch (image->format)
+                UnloadImageBuffer(image->data, GetImageBufferSize(*image), false);  // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = data;
+                image->format = newFormat;
+            }
+            else
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
+
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                        for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: Image is converted to GRAYSCALE equivalent 32bit
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                        // WARNING: Image is converted to GRAYSCALE equivalent 16bit
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
-            }
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                            ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        }
+                    } break;
+                    default: break;
+                }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+                RL_FREE(pixels);
+                pixels = NULL;
+            }
 
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
@@ -1699,40 +2793,7 @@ Image ImageFromChannel(Image image, int selectedChannel)
 // Resize and image to new size using Nearest-Neighbor scaling algorithm
 void ImageResizeNN(Image *image,int newWidth,int newHeight)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    Color *pixels = LoadImageColors(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
-
-    // EDIT: added +1 to account for an early rounding problem
-    int xRatio = (int)((image->width << 16)/newWidth) + 1;
-    int yRatio = (int)((image->height << 16)/newHeight) + 1;
-
-    int x2, y2;
-    for (int y = 0; y < newHeight; y++)
-    {
-        for (int x = 0; x < newWidth; x++)
-        {
-            x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
-
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
-        }
-    }
-
-    int format = image->format;
-
-    RL_FREE(image->data);
-
-    image->data = output;
-    image->width = newWidth;
-    image->height = newHeight;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
+    ImageResizeEx(image, newWidth, newHeight, RESIZE_FILTER_NEAREST);
 }
 
 // Resize and image to new size
@@ -1740,54 +2801,88 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 // STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
 // STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
 void ImageResize(Image *image, int newWidth, int newHeight)
+{
+    ImageResizeEx(image, newWidth, newHeight, RESIZE_FILTER_BICUBIC);
+}
+
+// Resize image to new size using provided filter (ResizeFilter)
+// NOTE: Pixels are resampled in their native format (8 bit, half-float and float channels),
+// packed 16 bit formats are resampled as 32 bit RGBA, except for nearest-neighbor scaling
+void ImageResizeEx(Image *image, int newWidth, int newHeight, int filter)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((newWidth <= 0) || (newHeight <= 0)) return;
 
-    // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
+    }
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+    ResizePass pass = { 0 };
 
-        RL_FREE(image->data);
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: pass.channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: pass.channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: pass.channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: pass.channels = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: pass.channels = 1; pass.type = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: pass.channels = 3; pass.type = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: pass.channels = 4; pass.type = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: pass.channels = 1; pass.type = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: pass.channels = 3; pass.type = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: pass.channels = 4; pass.type = 2; break;
+        default: break;     // Packed 16 bit formats: R5G6B5, R5G5B5A1, R4G4B4A4
     }
-    else
+
+    if ((pass.channels == 0) && (filter != RESIZE_FILTER_NEAREST))
     {
-        // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
-        Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+        int format = image->format;
 
-        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        ImageResizeEx(image, newWidth, newHeight, filter);
+        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-        int format = image->format;
+        return;
+    }
 
-        UnloadImageColors(pixels);
-        RL_FREE(image->data);
+    pass.src = (const unsigned char *)image->data;
+    pass.srcWidth = image->width;
+    pass.srcHeight = image->height;
+    pass.dstWidth = newWidth;
+    pass.dstHeight = newHeight;
+    pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    pass.filter = filter;
+    pass.dst = (unsigned char *)LoadImageBuffer((size_t)newWidth*newHeight*pass.bytesPerPixel);
 
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
-        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    if (filter != RESIZE_FILTER_BICUBIC)
+    {
+        // Source columns are computed once, source rows are computed by every destination row
+        pass.columns = (int *)RL_MALLOC(2*newWidth*sizeof(int));
+        pass.weights = (int *)RL_MALLOC(newWidth*sizeof(int));
 
-        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        for (int x = 0; x < newWidth; x++) pass.weights[x] = GetResizeSamples(x, image->width, newWidth, filter, &pass.columns[2*x], &pass.columns[2*x + 1]);
+    }
+
+    int minRows = RESIZE_BATCH_PIXELS/newWidth;
+    ParallelFor(newHeight, (minRows > 1)? minRows : 1, ResizeImageRows, &pass);
+
+    RL_FREE(pass.columns);
+    RL_FREE(pass.weights);
+
+    UnloadImageBuffer(image->data, GetImageBufferSize(*image), false);
+
+    image->data = pass.dst;
+    image->width = newWidth;
+    image->height = newHeight;
+
+    // In case original image had mipmaps, regenerate them for new size (same as ImageFormat())
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+        ImageMipmaps(image);
     }
 }
 
@@ -1947,20 +3042,7 @@ void ImageAlphaClear(Image *image, Color color, float threshold)
                     }
                 }
             } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
-                for (int i = 3; i < image->width*image->height*4; i += 4)
-                {
-                    if (((unsigned char *)image->data)[i] <= thresholdValue)
-                    {
-                        ((unsigned char *)image->data)[i - 3] = color.r;
-                        ((unsigned char *)image->data)[i - 2] = color.g;
-                        ((unsigned char *)image->data)[i - 1] = color.b;
-                        ((unsigned char *)image->data)[i] = color.a;
-                    }
-                }
-            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: ClearAlphaColors((unsigned char *)image->data, image->width*image->height, color, (unsigned char)(threshold*255.0f)); break;
             case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
             {
                 for (int i = 3; i < image->width*image->height*4; i += 4)
@@ -1993,8 +3075,8 @@ void ImageAlphaClear(Image *image, Color color, float threshold)
 }
 
 // Apply alpha mask to image
-// NOTE 1: Returned image is GRAY_ALPHA (16bit) or RGBA (32bit)
-// NOTE 2: alphaMask should be same size as image
+// NOTE 1: Returned image is GRAY_ALPHA (16bit) for GRAYSCALE and GRAY_ALPHA images, RGBA (32bit) otherwise
+// NOTE 2: alphaMask should be same size as image, grayscale masks are used directly (no copy)
 void ImageAlphaMask(Image *image, Image alphaMask)
 {
     if ((image->width != alphaMask.width) || (image->height != alphaMask.height))
@@ -2008,8 +3090,12 @@ void ImageAlphaMask(Image *image, Image alphaMask)
     else
     {
         // Force mask to be Grayscale
-        Image mask = ImageCopy(alphaMask);
-        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        Image mask = alphaMask;
+        if (mask.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+        {
+            mask = ImageCopy(alphaMask);
+            ImageFormat(&mask, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+        }
 
         // In case image is only grayscale, we just add alpha channel
         if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
@@ -2017,216 +3103,239 @@ void ImageAlphaMask(Image *image, Image alphaMask)
             unsigned char *data = (unsigned char *)RL_MALLOC(image->width*image->height*2);
 
             // Apply alpha mask to alpha channel
-            for (int i = 0, k = 0; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 2)
-            {
-                data[k] = ((unsigned char *)image->data)[i];
-                data[k + 1] = ((unsigned char *)mask.data)[i];
-            }
+            for (int i = 0, k = 0; i < image->width*image->height; i++, k += 2) data[k] = ((unsigned char *)image->data)[i];
+            MergeAlphaMask(data, (unsigned char *)mask.data, image->width*image->height, 2);
 
             RL_FREE(image->data);
             image->data = data;
             image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
         }
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+        {
+            MergeAlphaMask((unsigned char *)image->data, (unsigned char *)mask.data, image->width*image->height, 2);
+        }
         else
         {
             // Convert image to RGBA
             if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
 
             // Apply alpha mask to alpha channel
-            for (int i = 0, k = 3; (i < mask.width*mask.height) || (i < image->width*image->height); i++, k += 4)
-            {
-                ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
-            }
+            MergeAlphaMask((unsigned char *)image->data, (unsigned char *)mask.data, image->width*image->height, 4);
         }
 
-        UnloadImage(mask);
+        if (mask.data != alphaMask.data) UnloadImage(mask);
     }
 }
 
 // Premultiply alpha channel
+// NOTE: Image pixel format is kept, formats without alpha channel are not modified
 void ImageAlphaPremultiply(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
     {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
+        int pixelCount = image->width*image->height;
+
+        switch (image->format)
         {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                unsigned char *pixels = (unsigned char *)image->data;
 
-    RL_FREE(image->data);
+                for (int i = 0; i < pixelCount*2; i += 2)
+                {
+                    int value = pixels[i]*pixels[i + 1] + 128;
+                    pixels[i] = (unsigned char)((value + (value >> 8)) >> 8);
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                for (int i = 0; i < pixelCount; i++) if ((((unsigned short *)image->data)[i] & 0x0001) == 0) ((unsigned short *)image->data)[i] = 0;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                for (int i = 0; i < pixelCount; i++)
+                {
+                    unsigned short pixel = ((unsigned short *)image->data)[i];
+                    int a = pixel & 0x000f;
 
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                    if (a < 15)
+                    {
+                        int r = ((pixel >> 12)*a + 7)/15;
+                        int g = (((pixel >> 8) & 0x000f)*a + 7)/15;
+                        int b = (((pixel >> 4) & 0x000f)*a + 7)/15;
 
-    ImageFormat(image, format);
+                        ((unsigned short *)image->data)[i] = (unsigned short)((r << 12) | (g << 8) | (b << 4) | a);
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: PremultiplyColors((unsigned char *)image->data, pixelCount); break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                float *pixels = (float *)image->data;
+
+                for (int i = 0; i < pixelCount*4; i += 4)
+                {
+                    pixels[i] *= pixels[i + 3];
+                    pixels[i + 1] *= pixels[i + 3];
+                    pixels[i + 2] *= pixels[i + 3];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                unsigned short *pixels = (unsigned short *)image->data;
+
+                for (int i = 0; i < pixelCount*4; i += 4)
+                {
+                    if (pixels[i + 3] == 0x3c00) continue;      // Alpha 1.0f, color not modified
+
+                    float alpha = HalfToFloat(pixels[i + 3]);
+                    pixels[i] = FloatToHalf(HalfToFloat(pixels[i])*alpha);
+                    pixels[i + 1] = FloatToHalf(HalfToFloat(pixels[i + 1])*alpha);
+                    pixels[i + 2] = FloatToHalf(HalfToFloat(pixels[i + 2])*alpha);
+                }
+            } break;
+            default: break;     // Formats without alpha channel
+        }
+    }
 }
 
-// Apply box blur to image
-void ImageBlurGaussian(Image *image, int blurSize)
+// Unpremultiply alpha channel (divide color by alpha)
+// NOTE: Image pixel format is kept, pixels with alpha 0 are not modified
+void ImageAlphaUnpremultiply(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    ImageAlphaPremultiply(image);
-
-    Color *pixels = LoadImageColors(*image);
-
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-
-    for (int i = 0; i < (image->height*image->width); i++)
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+        int pixelCount = image->width*image->height;
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
+        switch (image->format)
         {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
             {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
+                unsigned char *pixels = (unsigned char *)image->data;
 
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
+                for (int i = 0; i < pixelCount*2; i += 2)
                 {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
+                    if ((pixels[i + 1] > 0) && (pixels[i + 1] < 255))
+                    {
+                        int value = (pixels[i]*255 + pixels[i + 1]/2)/pixels[i + 1];
+                        pixels[i] = (unsigned char)((value > 255)? 255 : value);
+                    }
                 }
-
-                if (x+blurSize < image->width)
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                for (int i = 0; i < pixelCount; i++)
                 {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
+                    unsigned short pixel = ((unsigned short *)image->data)[i];
+                    int a = pixel & 0x000f;
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+                    if ((a > 0) && (a < 15))
+                    {
+                        int r = ((pixel >> 12)*15 + a/2)/a;
+                        int g = (((pixel >> 8) & 0x000f)*15 + a/2)/a;
+                        int b = (((pixel >> 4) & 0x000f)*15 + a/2)/a;
 
-            for (int i = 0; i < blurSize; i++)
+                        ((unsigned short *)image->data)[i] = (unsigned short)(((r > 15)? 15 : r) << 12 | ((g > 15)? 15 : g) << 8 | ((b > 15)? 15 : b) << 4 | a);
+                    }
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: UnpremultiplyColors((unsigned char *)image->data, pixelCount); break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
             {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+                float *pixels = (float *)image->data;
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
+                for (int i = 0; i < pixelCount*4; i += 4)
                 {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
+                    if (pixels[i + 3] > 0.0f)
+                    {
+                        float invAlpha = 1.0f/pixels[i + 3];
+                        pixels[i] *= invAlpha;
+                        pixels[i + 1] *= invAlpha;
+                        pixels[i + 2] *= invAlpha;
+                    }
                 }
-                if (y+blurSize < image->height)
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                unsigned short *pixels = (unsigned short *)image->data;
+
+                for (int i = 0; i < pixelCount*4; i += 4)
                 {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+                    if (pixels[i + 3] == 0x3c00) continue;      // Alpha 1.0f, color not modified
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
+                    float alpha = HalfToFloat(pixels[i + 3]);
+
+                    if (alpha > 0.0f)
+                    {
+                        pixels[i] = FloatToHalf(HalfToFloat(pixels[i])/alpha);
+                        pixels[i + 1] = FloatToHalf(HalfToFloat(pixels[i + 1])/alpha);
+                        pixels[i + 2] = FloatToHalf(HalfToFloat(pixels[i + 2])/alpha);
+                    }
+                }
+            } break;
+            default: break;     // Formats without alpha channel or 1 bit alpha
         }
     }
+}
+
+// Apply box blur to image
+// NOTE: Box blur is applied GAUSSIAN_BLUR_ITERATIONS times (approximating a gaussian) on alpha-premultiplied
+// pixels with integer running sums, cost is independent of blurSize; rows and columns are processed in parallel
+void ImageBlurGaussian(Image *image, int blurSize)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
+
+    int format = image->format;
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
+        TRACELOG(LOG_WARNING, "IMAGE: Blur not supported for compressed image formats");
+        return;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    // Rows are blurred and stored transposed, so the columns pass also processes contiguous rows
+    unsigned char *transposed = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    BoxBlurPass pass = { 0 };
+    pass.src = (const unsigned char *)image->data;
+    pass.dst = transposed;
+    pass.width = image->width;
+    pass.height = image->height;
+    pass.radius = blurSize;
+    pass.iterations = GAUSSIAN_BLUR_ITERATIONS;
+    pass.alphaMode = 1;     // Premultiply alpha on rows load
+    ParallelFor((image->height + BOX_BLUR_BLOCK_ROWS - 1)/BOX_BLUR_BLOCK_ROWS, 4, BoxBlurRowsTransposed, &pass);
+
+    pass.src = transposed;
+    pass.dst = (unsigned char *)image->data;
+    pass.width = image->height;
+    pass.height = image->width;
+    pass.alphaMode = 2;     // Reverse premultiply on columns store
+    ParallelFor((image->width + BOX_BLUR_BLOCK_ROWS - 1)/BOX_BLUR_BLOCK_ROWS, 4, BoxBlurRowsTransposed, &pass);
+
+    RL_FREE(transposed);
 
     ImageFormat(image, format);
 }
 
 // Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
+// NOTE: The convolution kernel matrix is expected to be square,
+// separable kernels (rank 1, i.e. gaussian or box) are automatically applied as two 1D passes
 void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 {
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (kernel == NULL)) return;
 
     int kernelWidth = (int)sqrtf((float)kernelSize);
 
@@ -2236,120 +3345,42 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         return;
     }
 
-    Color *pixels = LoadImageColors(*image);
-
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    ConvolutionPass pass = { 0 };
+    pass.kernelWidth = kernelWidth;
+    pass.kernelHeight = kernelWidth;
 
-    int startRange = 0, endRange = 0;
+    // Try to decompose kernel as the outer product of a column and a row kernel
+    // NOTE: For small kernels the two passes don't save any work
+    float *kernelX = (float *)RL_MALLOC(kernelWidth*sizeof(float));
+    float *kernelY = (float *)RL_MALLOC(kernelWidth*sizeof(float));
 
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
+    if ((kernelWidth >= 3) && DecomposeKernel(kernel, kernelWidth, kernelX, kernelY))
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
+        pass.kernelX = kernelX;
+        pass.kernelY = kernelY;
     }
+    else pass.kernel = kernel;
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+    ApplyConvolution(image, &pass);
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
-
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+    RL_FREE(kernelX);
+    RL_FREE(kernelY);
+}
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
+// Apply separable convolution kernel to image (horizontal kernel and vertical kernel)
+// NOTE: Result is the same as ImageKernelConvolution() with the outer product kernel (kernelY x kernelX)
+void ImageConvolveSeparable(Image *image, const float *kernelX, int kernelXSize, const float *kernelY, int kernelYSize)
+{
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) ||
+        (kernelX == NULL) || (kernelY == NULL) || (kernelXSize <= 0) || (kernelYSize <= 0)) return;
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    ConvolutionPass pass = { 0 };
+    pass.kernelX = kernelX;
+    pass.kernelY = kernelY;
+    pass.kernelWidth = kernelXSize;
+    pass.kernelHeight = kernelYSize;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
+    ApplyConvolution(image, &pass);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2538,136 +3569,216 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
 }
 
-// Flip image vertically
-void ImageFlipVertical(Image *image)
+// Quantize image colors to a reduced palette (median cut), with optional Floyd-Steinberg dithering
+// NOTE: Palette is computed from RGB channels of non-transparent pixels, alpha channel is kept,
+// colors are mapped through a histogram bins lookup table, so process is linear in pixels count
+void ImageQuantize(Image *image, int colors, bool dither)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (colors < 1)) return;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    if (colors > QUANTIZE_MAX_COLORS)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        TRACELOG(LOG_WARNING, "IMAGE: Quantization palette limited to %i colors", QUANTIZE_MAX_COLORS);
+        colors = QUANTIZE_MAX_COLORS;
+    }
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
+    int format = image->format;
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+    if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Quantization not supported for compressed image formats");
+        return;
     }
-}
 
-// Flip image horizontally
-void ImageFlipHorizontal(Image *image)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    const int shift = 8 - QUANTIZE_HISTOGRAM_BITS;
+    const unsigned char remainderMask = (1 << shift) - 1;
+    Color *pixels = (Color *)image->data;
+    int pixelCount = image->width*image->height;
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    // Compute colors histogram, every bin stores: pixels count and RGB remainders sums (bits lost on binning)
+    unsigned int *histogram = (unsigned int *)RL_CALLOC(QUANTIZE_HISTOGRAM_SIZE*4, sizeof(unsigned int));
+
+    for (int i = 0; i < pixelCount; i++)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        if (pixels[i].a == 0) continue;
 
-        for (int y = 0; y < image->height; y++)
+        unsigned int *bin = histogram + 4*(((pixels[i].r >> shift) << (2*QUANTIZE_HISTOGRAM_BITS)) | ((pixels[i].g >> shift) << QUANTIZE_HISTOGRAM_BITS) | (pixels[i].b >> shift));
+
+        bin[0]++;
+        bin[1] += pixels[i].r & remainderMask;
+        bin[2] += pixels[i].g & remainderMask;
+        bin[3] += pixels[i].b & remainderMask;
+    }
+
+    unsigned short *bins = (unsigned short *)RL_MALLOC(QUANTIZE_HISTOGRAM_SIZE*2*sizeof(unsigned short));
+    unsigned short *sorted = bins + QUANTIZE_HISTOGRAM_SIZE;
+    int binCount = 0;
+
+    for (int i = 0; i < QUANTIZE_HISTOGRAM_SIZE; i++) if (histogram[i*4] > 0) bins[binCount++] = (unsigned short)i;
+
+    Color palette[QUANTIZE_MAX_COLORS] = { 0 };
+    int paletteSize = 0;
+
+    if (binCount > 0)
+    {
+        // Median cut: split the box with the biggest (pixels*extent) at the median of its longest axis
+        QuantizeBox boxes[QUANTIZE_MAX_COLORS] = { 0 };
+        int boxCount = 1;
+
+        boxes[0].count = binCount;
+        QuantizeBoxBounds(&boxes[0], bins, histogram);
+
+        while (boxCount < colors)
         {
-            for (int x = 0; x < image->width; x++)
+            int selected = -1;
+            float maxScore = 0.0f;
+
+            for (int i = 0; i < boxCount; i++)
             {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+                if (boxes[i].count < 2) continue;
+
+                int extent = 0;
+                for (int c = 0; c < 3; c++) if ((boxes[i].max[c] - boxes[i].min[c]) > extent) extent = boxes[i].max[c] - boxes[i].min[c];
 
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
+                float score = (float)boxes[i].pixels*(float)extent;
+                if (score > maxScore) { maxScore = score; selected = i; }
             }
-        }
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+            if (selected < 0) break;    // All boxes contain a single bin
 
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
+            QuantizeBox *box = &boxes[selected];
+            int axis = 0;
+            for (int c = 1; c < 3; c++) if ((box->max[c] - box->min[c]) > (box->max[axis] - box->min[axis])) axis = c;
+
+            // Sort box bins by axis coordinate (counting sort)
+            int axisShift = (2 - axis)*QUANTIZE_HISTOGRAM_BITS;
+            int offsets[(1 << QUANTIZE_HISTOGRAM_BITS) + 1] = { 0 };
+
+            for (int i = box->start; i < (box->start + box->count); i++) offsets[((bins[i] >> axisShift) & ((1 << QUANTIZE_HISTOGRAM_BITS) - 1)) + 1]++;
+            for (int i = 1; i <= (1 << QUANTIZE_HISTOGRAM_BITS); i++) offsets[i] += offsets[i - 1];
+            for (int i = box->start; i < (box->start + box->count); i++) sorted[offsets[(bins[i] >> axisShift) & ((1 << QUANTIZE_HISTOGRAM_BITS) - 1)]++] = bins[i];
+            memcpy(bins + box->start, sorted, box->count*sizeof(unsigned short));
+
+            // Find median bin, both halves keep at least one bin
+            unsigned int accumulated = 0;
+            int split = 1;
+
+            for (int i = 0; i < (box->count - 1); i++)
+            {
+                accumulated += histogram[bins[box->start + i]*4];
+                split = i + 1;
+                if (accumulated >= box->pixels/2) break;
+            }
+
+            QuantizeBox *newBox = &boxes[boxCount];
+            newBox->start = box->start + split;
+            newBox->count = box->count - split;
+            box->count = split;
+
+            QuantizeBoxBounds(box, bins, histogram);
+            QuantizeBoxBounds(newBox, bins, histogram);
+            boxCount++;
+        }
+
+        // Palette colors are the boxes mean colors
+        for (int i = 0; i < boxCount; i++)
         {
-            for (int x = 0; x < image->width/2; x++)
+            double sum[3] = { 0 };
+
+            for (int j = boxes[i].start; j < (boxes[i].start + boxes[i].count); j++)
             {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
+                const unsigned int *bin = histogram + bins[j]*4;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    unsigned int coord = (bins[j] >> ((2 - c)*QUANTIZE_HISTOGRAM_BITS)) & ((1 << QUANTIZE_HISTOGRAM_BITS) - 1);
+                    sum[c] += (double)bin[0]*(double)(coord << shift) + (double)bin[c + 1];
+                }
             }
+
+            palette[i].r = (unsigned char)(sum[0]/boxes[i].pixels + 0.5);
+            palette[i].g = (unsigned char)(sum[1]/boxes[i].pixels + 0.5);
+            palette[i].b = (unsigned char)(sum[2]/boxes[i].pixels + 0.5);
+            palette[i].a = 255;
         }
-        */
+
+        paletteSize = boxCount;
     }
-}
 
-// Rotate image in degrees
-void ImageRotate(Image *image, int degrees)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    RL_FREE(bins);
+    RL_FREE(histogram);
 
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
+    if (paletteSize > 0)
     {
-        float rad = degrees*PI/180.0f;
-        float sinRadius = sinf(rad);
-        float cosRadius = cosf(rad);
-
-        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
-        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
+        unsigned char *lookup = (unsigned char *)RL_MALLOC(QUANTIZE_HISTOGRAM_SIZE*sizeof(unsigned char));
 
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
+        QuantizePass pass = { 0 };
+        pass.pixels = pixels;
+        pass.width = image->width;
+        pass.palette = palette;
+        pass.paletteSize = paletteSize;
+        pass.lookup = lookup;
+        ParallelFor(QUANTIZE_HISTOGRAM_SIZE, 1024, QuantizeLookup, &pass);
 
-        for (int y = 0; y < height; y++)
+        if (!dither) ParallelFor(image->height, 16, QuantizeRows, &pass);
+        else
         {
-            for (int x = 0; x < width; x++)
+            // Floyd-Steinberg dithering with serpentine scan, errors stored in 1/16 units for current and next rows
+            // NOTE: Error diffusion is sequential, every row depends on previous row errors
+            int width = image->width;
+            int *errors = (int *)RL_CALLOC((width + 2)*3*2, sizeof(int));
+
+            for (int y = 0; y < image->height; y++)
             {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
+                int *errorsRow = errors + (y%2)*(width + 2)*3;
+                int *errorsNextRow = errors + ((y + 1)%2)*(width + 2)*3;
+                int dir = ((y%2) == 0)? 1 : -1;
+
+                memset(errorsNextRow, 0, (width + 2)*3*sizeof(int));
 
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
+                for (int i = 0; i < width; i++)
                 {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
+                    int x = (dir > 0)? i : (width - 1 - i);
+                    Color *pixel = &pixels[y*width + x];
+                    int *error = errorsRow + (x + 1)*3;
+                    int *errorNext = errorsNextRow + (x + 1)*3;
 
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+                    int value[3] = { pixel->r + error[0]/16, pixel->g + error[1]/16, pixel->b + error[2]/16 };
+                    for (int c = 0; c < 3; c++) value[c] = (value[c] < 0)? 0 : ((value[c] > 255)? 255 : value[c]);
 
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+                    Color color = palette[lookup[((value[0] >> shift) << (2*QUANTIZE_HISTOGRAM_BITS)) | ((value[1] >> shift) << QUANTIZE_HISTOGRAM_BITS) | (value[2] >> shift)]];
+
+                    pixel->r = color.r;
+                    pixel->g = color.g;
+                    pixel->b = color.b;
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+                    if (pixel->a == 0) continue;    // Transparent pixels do not diffuse error
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                    int diff[3] = { value[0] - color.r, value[1] - color.g, value[2] - color.b };
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        error[dir*3 + c] += diff[c]*7;
+                        errorNext[-dir*3 + c] += diff[c]*3;
+                        errorNext[c] += diff[c]*5;
+                        errorNext[dir*3 + c] += diff[c];
                     }
                 }
             }
+
+            RL_FREE(errors);
         }
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        image->width = width;
-        image->height = height;
+        RL_FREE(lookup);
     }
+
+    ImageFormat(image, format);
 }
 
-// Rotate image clockwise 90deg
-void ImageRotateCW(Image *image)
+// Flip image vertically
+void ImageFlipVertical(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2676,30 +3787,39 @@ void ImageRotateCW(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        // Rows are swapped in place
+        TransformPass pass = { (unsigned char *)image->data, (unsigned char *)image->data, image->width, image->height };
+        pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        pass.mode = 1;
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+        int minRows = TRANSFORM_BATCH_PIXELS/image->width;
+        ParallelFor((image->height + 1)/2, (minRows > 1)? minRows : 1, FlipImageRows, &pass);
+    }
+}
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+// Flip image horizontally
+void ImageFlipHorizontal(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        // Rows pixels are reversed in place
+        TransformPass pass = { (unsigned char *)image->data, (unsigned char *)image->data, image->width, image->height };
+        pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        pass.mode = 0;
 
-        image->width = height;
-        image->height = width;
+        int minRows = TRANSFORM_BATCH_PIXELS/image->width;
+        ParallelFor(image->height, (minRows > 1)? minRows : 1, FlipImageRows, &pass);
     }
 }
 
-// Rotate image counter-clockwise 90deg
-void ImageRotateCCW(Image *image)
+// Rotate image in degrees
+// NOTE: Multiples of 90 degrees are rotated exactly, other angles use bilinear sampling
+void ImageRotate(Image *image, int degrees)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2708,80 +3828,177 @@ void ImageRotateCCW(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        degrees %= 360;
+        if (degrees < 0) degrees += 360;
 
-        for (int y = 0; y < image->height; y++)
+        switch (degrees)
         {
-            for (int x = 0; x < image->width; x++)
+            case 0: return;
+            case 90: ImageRotateCW(image); return;
+            case 270: ImageRotateCCW(image); return;
+            case 180:
             {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
+                // Rows are swapped and reversed in place
+                TransformPass pass = { (unsigned char *)image->data, (unsigned char *)image->data, image->width, image->height };
+                pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+                pass.mode = 2;
+
+                int minRows = TRANSFORM_BATCH_PIXELS/image->width;
+                ParallelFor((image->height + 1)/2, (minRows > 1)? minRows : 1, FlipImageRows, &pass);
+            } return;
+            default: break;
         }
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
+        // Bilinear sampling is computed on 8 bit or float channels,
+        // half-float and packed formats are rotated as float or 32 bit RGBA
+        int format = image->format;
+        int type = 0;
+
+        switch (format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: type = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R32); type = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R32G32B32); type = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32); type = 2; break;
+            default: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8); break;
+        }
+
+        float rad = degrees*PI/180.0f;
+        float sinRadius = sinf(rad);
+        float cosRadius = cosf(rad);
+
+        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
+        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
+
+        TransformPass pass = { (const unsigned char *)image->data, NULL, image->width, image->height, width, height };
+        pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        pass.mode = type;
+        pass.dst = (unsigned char *)LoadImageBuffer((size_t)width*height*pass.bytesPerPixel);
+
+        // Source position of destination origin and steps in fixed point, rows positions are stepped incrementally:
+        // oldX = (x - width/2)*cos + (y - height/2)*sin + image.width/2
+        // oldY = (y - height/2)*cos - (x - width/2)*sin + image.height/2
+        pass.startX = (long long)floor((-width/2.0*cosRadius - height/2.0*sinRadius + image->width/2.0)*65536.0);
+        pass.startY = (long long)floor((-height/2.0*cosRadius + width/2.0*sinRadius + image->height/2.0)*65536.0);
+        pass.stepX = (int)lround(cosRadius*65536.0);
+        pass.stepY = (int)lround(sinRadius*65536.0);
 
-        image->width = height;
-        image->height = width;
+        int minRows = TRANSFORM_BATCH_PIXELS/width;
+        ParallelFor(height, (minRows > 1)? minRows : 1, RotateImageRows, &pass);
+
+        UnloadImageBuffer(image->data, GetImageBufferSize(*image), false);
+        image->data = pass.dst;
+        image->width = width;
+        image->height = height;
+
+        if (image->format != format) ImageFormat(image, format);
     }
 }
 
-// Modify image color: tint
-void ImageColorTint(Image *image, Color color)
+// Rotate image clockwise 90deg
+void ImageRotateCW(Image *image)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
+    {
+        TransformPass pass = { (const unsigned char *)image->data, NULL, image->width, image->height, image->height, image->width };
+        pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        pass.mode = 0;
+        pass.dst = (unsigned char *)LoadImageBuffer((size_t)image->width*image->height*pass.bytesPerPixel);
+
+        int minBands = TRANSFORM_BATCH_PIXELS/(TRANSPOSE_TILE_SIZE*image->width);
+        ParallelFor((image->height + TRANSPOSE_TILE_SIZE - 1)/TRANSPOSE_TILE_SIZE, (minBands > 1)? minBands : 1, RotateImageTiles, &pass);
+
+        UnloadImageBuffer(image->data, GetImageBufferSize(*image), false);
+        image->data = pass.dst;
+        image->width = pass.dstWidth;
+        image->height = pass.dstHeight;
+    }
+}
 
-    for (int i = 0; i < image->width*image->height; i++)
+// Rotate image counter-clockwise 90deg
+void ImageRotateCCW(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else
     {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+        TransformPass pass = { (const unsigned char *)image->data, NULL, image->width, image->height, image->height, image->width };
+        pass.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        pass.mode = 1;
+        pass.dst = (unsigned char *)LoadImageBuffer((size_t)image->width*image->height*pass.bytesPerPixel);
+
+        int minBands = TRANSFORM_BATCH_PIXELS/(TRANSPOSE_TILE_SIZE*image->width);
+        ParallelFor((image->height + TRANSPOSE_TILE_SIZE - 1)/TRANSPOSE_TILE_SIZE, (minBands > 1)? minBands : 1, RotateImageTiles, &pass);
+
+        UnloadImageBuffer(image->data, GetImageBufferSize(*image), false);
+        image->data = pass.dst;
+        image->width = pass.dstWidth;
+        image->height = pass.dstHeight;
+    }
+}
+
+// Apply color adjustments to image in a single pass
+// NOTE: Adjustments are applied in ImageAdjustments fields order, image format and mipmap levels are kept
+void ImageAdjust(Image *image, const ImageAdjustments *adjustments)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (adjustments == NULL)) return;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Color adjustments not supported for compressed image formats");
+        return;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    AdjustPass pass = { 0 };
+    InitAdjustPass(&pass, image, adjustments);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    int minRows = ADJUST_BATCH_PIXELS/image->width;
+    ParallelFor((pass.pixelCount + image->width - 1)/image->width, (minRows > 1)? minRows : 1, AdjustImageRows, &pass);
 
-    ImageFormat(image, format);
+    RL_FREE(pass.packedLut);
 }
 
-// Modify image color: invert
-void ImageColorInvert(Image *image)
+// Modify image color: tint
+void ImageColorTint(Image *image, Color color)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    if ((color.r == 0) && (color.g == 0) && (color.b == 0) && (color.a == 0))
     {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
+        // BLANK tint means no tint for ImageAdjust(), all uncompressed formats encode BLANK as zeros
+        if (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) memset(image->data, 0, GetPixelDataSize(image->width, image->height, image->format));
+        return;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    ImageAdjustments adjustments = { 0 };
+    adjustments.tint = color;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    ImageAdjust(image, &adjustments);
+}
 
-    ImageFormat(image, format);
+// Modify image color: invert
+void ImageColorInvert(Image *image)
+{
+    ImageAdjustments adjustments = { 0 };
+    adjustments.invert = true;
+
+    ImageAdjust(image, &adjustments);
 }
 
 // Modify image color: grayscale
@@ -2794,96 +4011,20 @@ void ImageColorGrayscale(Image *image)
 // NOTE: Contrast values between -100 and 100
 void ImageColorContrast(Image *image, float contrast)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (contrast < -100) contrast = -100;
-    if (contrast > 100) contrast = 100;
-
-    contrast = (100.0f + contrast)/100.0f;
-    contrast *= contrast;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
+    ImageAdjustments adjustments = { 0 };
+    adjustments.contrast = contrast;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageAdjust(image, &adjustments);
 }
 
 // Modify image color: brightness
 // NOTE: Brightness values between -255 and 255
 void ImageColorBrightness(Image *image, int brightness)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (brightness < -255) brightness = -255;
-    if (brightness > 255) brightness = 255;
-
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
-
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
+    ImageAdjustments adjustments = { 0 };
+    adjustments.brightness = brightness;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ImageAdjust(image, &adjustments);
 }
 
 // Modify image color: replace color
@@ -2937,130 +4078,148 @@ Color *LoadImageColors(Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        bool converted = false;
+
+        // NOTE: Packed 16bit formats channels are expanded differently than in ImageFormat(), keep them in the generic path
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
         {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+            memcpy(pixels, image.data, image.width*image.height*sizeof(Color));
+            converted = true;
+        }
+        else if ((image.format != PIXELFORMAT_UNCOMPRESSED_R5G6B5) &&
+                 (image.format != PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) &&
+                 (image.format != PIXELFORMAT_UNCOMPRESSED_R4G4B4A4))
+        {
+            converted = ConvertImageData(image.data, image.format, pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, image.width*image.height);
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        if (!converted)
+        {
+            for (int i = 0, k = 0; i < image.width*image.height; i++)
+            {
+                switch (image.format)
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                    {
+                        pixels[i].r = ((unsigned char *)image.data)[i];
+                        pixels[i].g = ((unsigned char *)image.data)[i];
+                        pixels[i].b = ((unsigned char *)image.data)[i];
+                        pixels[i].a = 255;
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    {
+                        pixels[i].r = ((unsigned char *)image.data)[k];
+                        pixels[i].g = ((unsigned char *)image.data)[k];
+                        pixels[i].b = ((unsigned char *)image.data)[k];
+                        pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                        k += 2;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    {
+                        unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+                        pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                        pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                        pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                        pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                    {
+                        unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+                        pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                        pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                        pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                        pixels[i].a = 255;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                    {
+                        unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+                        pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                        pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                        pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                        pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                    {
+                        pixels[i].r = ((unsigned char *)image.data)[k];
+                        pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                        pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                        pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                        k += 4;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    {
+                        pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                        pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                        pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                        pixels[i].a = 255;
+
+                        k += 3;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                        pixels[i].g = 0;
+                        pixels[i].b = 0;
+                        pixels[i].a = 255;
+
+                        k += 1;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                    {
+                        pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                        pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                        pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                        pixels[i].a = 255;
+
+                        k += 3;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                    {
+                        pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                        pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                        pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                        pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+
+                        k += 4;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
+                    {
+                        pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                        pixels[i].g = 0;
+                        pixels[i].b = 0;
+                        pixels[i].a = 255;
+
+                        k += 1;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                    {
+                        pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                        pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                        pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                        pixels[i].a = 255;
+
+                        k += 3;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                    {
+                        pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                        pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                        pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                        pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+
+                        k += 4;
+                    } break;
+                    default: break;
+                }
             }
         }
     }
@@ -3084,38 +4243,40 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
+        // Palette colors are tracked with an open addressing hash set (linear probing),
+        // slots store palette index + 1, 0 means empty slot
+        int capacity = 64;
+        while (capacity < maxPaletteSize*2) capacity *= 2;
+        int *slots = (int *)RL_CALLOC(capacity, sizeof(int));
+
         for (int i = 0; i < image.width*image.height; i++)
         {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
+            // Check if the color is already on palette
+            if ((pixels[i].a == 0) || ((i > 0) && COLOR_EQUAL(pixels[i], pixels[i - 1]))) continue;
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+            unsigned int hash = ((unsigned int)pixels[i].r | ((unsigned int)pixels[i].g << 8) |
+                ((unsigned int)pixels[i].b << 16) | ((unsigned int)pixels[i].a << 24))*2654435761u;
+            int slot = (int)((hash ^ (hash >> 16)) & (unsigned int)(capacity - 1));
 
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+            while ((slots[slot] != 0) && !COLOR_EQUAL(pixels[i], palette[slots[slot] - 1])) slot = (slot + 1) & (capacity - 1);
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
-                    {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
-                    }
+            // Store color if not on the palette
+            if (slots[slot] == 0)
+            {
+                palette[palCount] = pixels[i];      // Add pixels[i] to palette
+                palCount++;
+                slots[slot] = palCount;
+
+                // We reached the limit of colors supported by palette
+                if (palCount >= maxPaletteSize)
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                    break;
                 }
             }
         }
 
+        RL_FREE(slots);
         UnloadImageColors(pixels);
     }
 
@@ -3137,41 +4298,46 @@ void UnloadImagePalette(Color *colors)
 }
 
 // Get image alpha border rectangle
-// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+// NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f, pixels are scanned in native format,
+// border rows are scanned from the image edges and inner rows only out of current border columns
 Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
     Rectangle crop = { 0 };
 
-    Color *pixels = LoadImageColors(image);
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return crop;
 
-    if (pixels != NULL)
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+        return crop;
+    }
 
-        for (int y = 0; y < image.height; y++)
-        {
-            for (int x = 0; x < image.width; x++)
-            {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
-        }
+    unsigned char thresholdValue = (unsigned char)(((threshold < 0.0f)? 0.0f : (threshold > 1.0f)? 1.0f : threshold)*255.0f);
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
+    // Find top row with pixels over threshold, check for empty blank image
+    int xMin = -1;
+    int yMin = 0;
+    while ((yMin < image.height) && ((xMin = FindImageAlphaPixel(image, yMin, 0, image.width, thresholdValue)) < 0)) yMin++;
+
+    if (xMin >= 0)
+    {
+        int xMax = FindImageAlphaPixel(image, yMin, image.width - 1, xMin - 1, thresholdValue);
+        int yMax = image.height - 1;
+
+        // Find bottom row with pixels over threshold (top row found at least)
+        while ((yMax > yMin) && (FindImageAlphaPixel(image, yMax, image.width - 1, -1, thresholdValue) < 0)) yMax--;
+
+        // Extend border columns with the remaining rows pixels out of current columns
+        for (int y = yMin + 1; y <= yMax; y++)
         {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+            int x = (xMin > 0)? FindImageAlphaPixel(image, y, 0, xMin, thresholdValue) : -1;
+            if (x >= 0) xMin = x;
+
+            x = (xMax < (image.width - 1))? FindImageAlphaPixel(image, y, image.width - 1, xMax, thresholdValue) : -1;
+            if (x >= 0) xMax = x;
         }
 
-        UnloadImageColors(pixels);
+        crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
     }
 
     return crop;
@@ -3304,167 +4470,147 @@ Color GetImageColor(Image image, int x, int y)
     return color;
 }
 
-//------------------------------------------------------------------------------------
-// Image drawing functions
-//------------------------------------------------------------------------------------
-// Clear image background with given color
-void ImageClearBackground(Image *dst, Color color)
+// Compare image against reference image: error metrics, PSNR, SSIM and pass/fail with tolerance
+// NOTE: Errors are normalized per channel, pixels differ if any channel difference is over tolerance,
+// images sharing an 8 bit per channel format are compared natively, other formats through normalized values
+ImageComparison ImageCompare(Image image, Image reference, float tolerance)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    ImageComparison result = { 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, image.width*image.height, false };
 
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
-
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    ComparePass pass = { 0 };
+    if (!InitComparePass(&pass, image, reference)) return result;
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
-    {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
-}
+    int bandCount = (image.height + SSIM_BLOCK_SIZE - 1)/SSIM_BLOCK_SIZE;
+    int blocksY = image.height/SSIM_BLOCK_SIZE;
 
-// Draw pixel within an image
-// NOTE: Compressed image formats not supported
-void ImageDrawPixel(Image *dst, int x, int y, Color color)
-{
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+    pass.tolerance = (tolerance > 0.0f)? tolerance : 0.0f;
+    pass.bands = (CompareStats *)RL_CALLOC(bandCount, sizeof(CompareStats));
 
-    switch (dst->format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    // SSIM windows are computed from 4x4 blocks statistics, smaller images use whole image statistics
+    pass.blocksX = image.width/SSIM_BLOCK_SIZE;
+    if ((pass.blocksX >= 2) && (blocksY >= 2)) pass.blocks = (float *)RL_MALLOC(pass.blocksX*blocksY*4*sizeof(float));
 
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
+    int minBands = COMPARE_BATCH_PIXELS/(SSIM_BLOCK_SIZE*image.width);
+    ParallelFor(bandCount, (minBands > 1)? minBands : 1, CompareImageBands, &pass);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    // Bands statistics reduced in order, results do not depend on threads count
+    double sumError = 0.0;
+    double sumSquares = 0.0;
+    double luma[4] = { 0 };
 
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
+    result.maxError = 0.0f;
+    result.diffPixels = 0;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    for (int i = 0; i < bandCount; i++)
+    {
+        sumError += pass.bands[i].sumError;
+        sumSquares += pass.bands[i].sumSquares;
+        if (pass.bands[i].maxError > result.maxError) result.maxError = pass.bands[i].maxError;
+        result.diffPixels += pass.bands[i].diffPixels;
+        for (int k = 0; k < 4; k++) luma[k] += pass.bands[i].luma[k];
+    }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    double count = (double)image.width*image.height*pass.channels;
+    result.meanError = (float)(sumError/count);
+    result.mse = (float)(sumSquares/count);
+    result.psnr = (sumSquares > 0.0)? (float)(10.0*log10(count/sumSquares)) : INFINITY;
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    if (pass.blocks != NULL)
+    {
+        double ssim = 0.0;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        for (int y = 0; y < blocksY - 1; y++)
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            for (int x = 0; x < pass.blocksX - 1; x++)
+            {
+                double sums[4] = { 0 };
+                const float *block = pass.blocks + (y*pass.blocksX + x)*4;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                for (int k = 0; k < 4; k++) sums[k] = (double)block[k] + block[4 + k] + block[pass.blocksX*4 + k] + block[pass.blocksX*4 + 4 + k];
+
+                ssim += ComputeSSIM(sums, 4*SSIM_BLOCK_SIZE*SSIM_BLOCK_SIZE);
+            }
+        }
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+        result.ssim = (float)(ssim/((double)(pass.blocksX - 1)*(blocksY - 1)));
+    }
+    else result.ssim = ComputeSSIM(luma, (double)image.width*image.height);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    result.passed = (result.diffPixels == 0);
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+    RL_FREE(pass.blocks);
+    RL_FREE(pass.bands);
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    return result;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
+// Generate image absolute differences against reference image
+// NOTE: Differences image keeps the image format if both images share an 8 bit per channel format,
+// R32G32B32A32 is used otherwise; image is opaque, alpha differences are shown as gray (max with color differences)
+Image ImageDiff(Image image, Image reference)
+{
+    Image diff = { 0 };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
+    ComparePass pass = { 0 };
+    if (!InitComparePass(&pass, image, reference)) return diff;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    pass.diffFormat = pass.native? image.format : PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+    pass.diff = (unsigned char *)LoadImageBuffer(GetPixelDataSize(image.width, image.height, pass.diffFormat));
 
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+    int minRows = COMPARE_BATCH_PIXELS/image.width;
+    ParallelFor(image.height, (minRows > 1)? minRows : 1, DiffImageRows, &pass);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    diff.data = pass.diff;
+    diff.width = image.width;
+    diff.height = image.height;
+    diff.mipmaps = 1;
+    diff.format = pass.diffFormat;
 
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    return diff;
+}
 
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
+// Set image drawing flags (ImageDrawFlags) for drawing primitives
+// NOTE: Flags apply to ImageDraw*() primitives, ImageDraw() and text drawing always blend
+void SetImageDrawFlags(unsigned int flags)
+{
+    imageDrawFlags = flags;
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+// Clear image background with given color
+void ImageClearBackground(Image *dst, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
 
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+    unsigned char *pixels = (unsigned char *)dst->data;
+    size_t size = (size_t)GetPixelDataSize(dst->width, dst->height, dst->format);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    // Fill in first pixel based on image format
+    SetPixelColor(pixels, color, dst->format);
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+    // Repeat the first pixel data throughout the image, filled data is doubled on every copy
+    for (size_t filled = GetPixelDataSize(1, 1, dst->format); filled < size; filled *= 2)
+    {
+        memcpy(pixels + filled, pixels, ((size - filled) < filled)? (size - filled) : filled);
+    }
+}
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+// Draw pixel within an image
+// NOTE: Compressed image formats not supported
+void ImageDrawPixel(Image *dst, int x, int y, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
-        } break;
-        default: break;
+    if (imageDrawFlags & IMAGE_DRAW_BLEND)
+    {
+        ImageSpanWriter writer = { 0 };
+        if (InitImageSpanWriter(&writer, dst, color)) DrawImageSpan(&writer, x, y, 1, NULL);
     }
+    else SetPixelColor((unsigned char *)dst->data + ((size_t)y*dst->width + x)*GetPixelDataSize(1, 1, dst->format), color, dst->format);
 }
 
 // Draw pixel within an image (Vector version)
@@ -3476,6 +4622,21 @@ void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 // Draw line within an image
 void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
+    ImageSpanWriter writer = { 0 };
+    if (!InitImageSpanWriter(&writer, dst, color)) return;
+
+    if (imageDrawFlags & IMAGE_DRAW_ANTIALIAS)
+    {
+        // Anti-aliased line drawn as a one pixel thick line
+        Vector2 points[2] = { { (float)startPosX, (float)startPosY }, { (float)endPosX, (float)endPosY } };
+        RasterEdgeList list;
+
+        InitRasterEdges(&list);
+        AddRasterPolyline(&list, points, 2, 1.0f, false);
+        RasterizeEdges(&writer, &list, true);
+        return;
+    }
+
     // Calculate differences in coordinates
     int shortLen = endPosY - startPosY;
     int longLen = endPosX - startPosX;
@@ -3505,24 +4666,32 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
     // Calculate fixed-point increment for shorter length
     int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
 
-    // Draw the line pixel by pixel
-    if (yLonger)
+    // Draw the line by spans of pixels, consecutive pixels in the same row are drawn together
+    for (int i = 0, j = 0; i != endVal;)
     {
-        // If line is more vertical, iterate over y-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
-        }
-    }
-    else
-    {
-        // If line is more horizontal, iterate over x-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
+        int y = yLonger? (startPosY + i) : (startPosY + (j >> 16));
+        int left = yLonger? (startPosX + (j >> 16)) : (startPosX + i);
+        int right = left;
+
+        i += sgnInc;
+        j += decInc;
+
+        // If line is more horizontal, extend span while row does not change
+        if (!yLonger)
         {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
+            for (; (i != endVal) && ((startPosY + (j >> 16)) == y); i += sgnInc, j += decInc)
+            {
+                if ((startPosX + i) < left) left = startPosX + i;
+                else right = startPosX + i;
+            }
         }
+
+        // Clip span to image bounds
+        if ((y < 0) || (y >= dst->height)) continue;
+        if (left < 0) left = 0;
+        if (right >= dst->width) right = dst->width - 1;
+
+        if (right >= left) DrawImageSpan(&writer, left, y, right - left + 1, NULL);
     }
 }
 
@@ -3540,63 +4709,56 @@ void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
 }
 
 // Draw a line defining thickness within an image
+// NOTE: Line is centered on start and end pixels centers
 void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color)
 {
-    // Round start and end positions to nearest integer coordinates
-    int x1 = (int)(start.x + 0.5f);
-    int y1 = (int)(start.y + 0.5f);
-    int x2 = (int)(end.x + 0.5f);
-    int y2 = (int)(end.y + 0.5f);
-
-    // Calculate differences in x and y coordinates
-    int dx = x2 - x1;
-    int dy = y2 - y1;
-
-    // Draw the main line between (x1, y1) and (x2, y2)
-    ImageDrawLine(dst, x1, y1, x2, y2, color);
-
-    // Determine if the line is more horizontal or vertical
-    if (dx != 0 && abs(dy/dx) < 1)
+    if ((thick <= 1) && !(imageDrawFlags & IMAGE_DRAW_ANTIALIAS))
     {
-        // Line is more horizontal
-        // Calculate half the width of the line
-        int wy = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dx));
-
-        // Draw additional lines above and below the main line
-        for (int i = 1; i <= wy; i++)
-        {
-            ImageDrawLine(dst, x1, y1 - i, x2, y2 - i, color); // Draw above the main line
-            ImageDrawLine(dst, x1, y1 + i, x2, y2 + i, color); // Draw below the main line
-        }
+        // Round start and end positions to nearest integer coordinates
+        ImageDrawLine(dst, (int)(start.x + 0.5f), (int)(start.y + 0.5f), (int)(end.x + 0.5f), (int)(end.y + 0.5f), color);
+        return;
     }
-    else if (dy != 0)
-    {
-        // Line is more vertical or perfectly horizontal
-        // Calculate half the width of the line
-        int wx = (thick - 1)*(int)sqrtf((float)(dx*dx + dy*dy))/(2*abs(dy));
 
-        // Draw additional lines to the left and right of the main line
-        for (int i = 1; i <= wx; i++)
-        {
-            ImageDrawLine(dst, x1 - i, y1, x2 - i, y2, color); // Draw left of the main line
-            ImageDrawLine(dst, x1 + i, y1, x2 + i, y2, color); // Draw right of the main line
-        }
-    }
+    ImageSpanWriter writer = { 0 };
+    if (!InitImageSpanWriter(&writer, dst, color)) return;
+
+    Vector2 points[2] = { start, end };
+    RasterEdgeList list;
+
+    InitRasterEdges(&list);
+    AddRasterPolyline(&list, points, 2, (thick > 1)? (float)thick : 1.0f, false);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
 }
 
 // Draw circle within an image
 void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
+    ImageSpanWriter writer = { 0 };
+    if ((radius < 0) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    if (imageDrawFlags & IMAGE_DRAW_ANTIALIAS)
+    {
+        // Anti-aliased circle covers pixels up to radius distance from center pixel
+        RasterEdgeList list;
+
+        InitRasterEdges(&list);
+        AddRasterCircle(&list, (Vector2){ (float)centerX + 0.5f, (float)centerY + 0.5f }, (float)radius + 0.5f, 0);
+        RasterizeEdges(&writer, &list, true);
+        return;
+    }
+
+    // Midpoint circle rows half widths, every row is drawn once
+    int localWidths[64] = { 0 };
+    int *halfWidths = (radius < 64)? localWidths : (int *)RL_CALLOC(radius + 1, sizeof(int));
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        if (x > halfWidths[y]) halfWidths[y] = x;
+        if (y > halfWidths[x]) halfWidths[x] = y;
         x++;
 
         if (decesionParameter > 0)
@@ -3606,6 +4768,22 @@ void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color col
         }
         else decesionParameter = decesionParameter + 4*x + 6;
     }
+
+    for (int i = 0; i <= radius; i++)
+    {
+        // NOTE: Rows with zero half width still draw the center pixel
+        int left = centerX - halfWidths[i];
+        int right = centerX + ((halfWidths[i] > 0)? halfWidths[i] : 1);
+
+        if (left < 0) left = 0;
+        if (right > dst->width) right = dst->width;
+        if (right <= left) continue;
+
+        if (((centerY + i) >= 0) && ((centerY + i) < dst->height)) DrawImageSpan(&writer, left, centerY + i, right - left, NULL);
+        if ((i > 0) && ((centerY - i) >= 0) && ((centerY - i) < dst->height)) DrawImageSpan(&writer, left, centerY - i, right - left, NULL);
+    }
+
+    if (halfWidths != localWidths) RL_FREE(halfWidths);
 }
 
 // Draw circle within an image (Vector version)
@@ -3617,20 +4795,42 @@ void ImageDrawCircleV(Image* dst, Vector2 center, int radius, Color color)
 // Draw circle outline within an image
 void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
 {
+    ImageSpanWriter writer = { 0 };
+    if ((radius < 0) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    if (imageDrawFlags & IMAGE_DRAW_ANTIALIAS)
+    {
+        // Anti-aliased circle outline drawn as a one pixel thick ring, inner circle added as a hole
+        Vector2 center = { (float)centerX + 0.5f, (float)centerY + 0.5f };
+        RasterEdgeList list;
+
+        InitRasterEdges(&list);
+        AddRasterCircle(&list, center, (float)radius + 0.5f, 1);
+        AddRasterCircle(&list, center, (float)radius - 0.5f, -1);
+        RasterizeEdges(&writer, &list, true);
+        return;
+    }
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        int points[8][2] = { { x, y }, { -x, y }, { x, -y }, { -x, -y }, { y, x }, { -y, x }, { y, -x }, { -y, -x } };
+
+        for (int i = 0; i < 8; i++)
+        {
+            // Skip points repeated by the octants symmetry, pixels are drawn once
+            bool repeated = false;
+            for (int k = 0; (k < i) && !repeated; k++) repeated = ((points[k][0] == points[i][0]) && (points[k][1] == points[i][1]));
+
+            int px = centerX + points[i][0];
+            int py = centerY + points[i][1];
+
+            if (!repeated && (px >= 0) && (px < dst->width) && (py >= 0) && (py < dst->height)) DrawImageSpan(&writer, px, py, 1, NULL);
+        }
+
         x++;
 
         if (decesionParameter > 0)
@@ -3663,8 +4863,20 @@ void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color
 // Draw rectangle within an image
 void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    ImageSpanWriter writer = { 0 };
+    if (!InitImageSpanWriter(&writer, dst, color)) return;
+
+    if (imageDrawFlags & IMAGE_DRAW_ANTIALIAS)
+    {
+        // Anti-aliased rectangle keeps fractional position and size
+        Vector2 points[4] = { { rec.x, rec.y }, { rec.x + rec.width, rec.y }, { rec.x + rec.width, rec.y + rec.height }, { rec.x, rec.y + rec.height } };
+        RasterEdgeList list;
+
+        InitRasterEdges(&list);
+        AddRasterPolygon(&list, points, 4, 0);
+        RasterizeEdges(&writer, &list, true);
+        return;
+    }
 
     // Security check to avoid drawing out of bounds in case of bad user data
     if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
@@ -3680,28 +4892,15 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
     if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
 
-    int sy = (int)rec.y;
     int sx = (int)rec.x;
+    int sy = (int)rec.y;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
 
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
-
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
-
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
-
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
-    {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
-
-    // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
+    // Fill every row span based on image format
+    if (width > 0)
     {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
+        for (int y = sy; y < (sy + height); y++) DrawImageSpan(&writer, sx, y, width, NULL);
     }
 }
 
@@ -3715,191 +4914,148 @@ void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
 }
 
 // Draw triangle within an image
+// NOTE: Pixels are filled if their center is inside the triangle, any vertex order is valid
 void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
-
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
-
-    // Check the order of the vertices to determine if it's a front or back face
-    // NOTE: if signedArea is equal to 0, the face is degenerate
-    float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
-
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
-
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
-    {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
-    }
-
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
-
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
-    {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+    ImageSpanWriter writer = { 0 };
+    if (!InitImageSpanWriter(&writer, dst, color)) return;
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is then we can draw the pixel with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
-
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    Vector2 points[3] = { v1, v2, v3 };
+    RasterEdgeList list;
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
+    InitRasterEdges(&list);
+    AddRasterPolygon(&list, points, 3, 0);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
 }
 
 // Draw triangle with interpolated colors within an image
 void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3)
 {
-    // Calculate the 2D bounding box of the triangle
-    // Determine the minimum and maximum x and y coordinates of the triangle vertices
-    int xMin = (int)((v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x));
-    int yMin = (int)((v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y));
-    int xMax = (int)((v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x));
-    int yMax = (int)((v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y));
-
-    // Clamp the bounding box to the image dimensions
-    if (xMin < 0) xMin = 0;
-    if (yMin < 0) yMin = 0;
-    if (xMax > dst->width) xMax = dst->width;
-    if (yMax > dst->height) yMax = dst->height;
+    ImageSpanWriter writer = { 0 };
+    if (!InitImageSpanWriter(&writer, dst, c1)) return;
 
     // Check the order of the vertices to determine if it's a front or back face
     // NOTE: if signedArea is equal to 0, the face is degenerate
     float signedArea = (v2.x - v1.x)*(v3.y - v1.y) - (v3.x - v1.x)*(v2.y - v1.y);
-    bool isBackFace = (signedArea > 0);
-
-    // Barycentric interpolation setup
-    // Calculate the step increments for the barycentric coordinates
-    int w1XStep = (int)(v3.y - v2.y), w1YStep = (int)(v2.x - v3.x);
-    int w2XStep = (int)(v1.y - v3.y), w2YStep = (int)(v3.x - v1.x);
-    int w3XStep = (int)(v2.y - v1.y), w3YStep = (int)(v1.x - v2.x);
-
-    // If the triangle is a back face, invert the steps
-    if (isBackFace)
-    {
-        w1XStep = -w1XStep, w1YStep = -w1YStep;
-        w2XStep = -w2XStep, w2YStep = -w2YStep;
-        w3XStep = -w3XStep, w3YStep = -w3YStep;
-    }
-
-    // Calculate the initial barycentric coordinates for the top-left point of the bounding box
-    int w1Row = (int)((xMin - v2.x)*w1XStep + w1YStep*(yMin - v2.y));
-    int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
-    int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
+    if (fabsf(signedArea) < 1e-6f) return;
 
-    // Calculate the inverse of the sum of the barycentric coordinates for normalization
-    // NOTE 1: Here, we act as if we multiply by 255 the reciprocal, which avoids additional
-    //         calculations in the loop. This is acceptable because we are only interpolating colors.
-    // NOTE 2: This sum remains constant throughout the triangle
-    float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
+    // Color channels planes, colors are interpolated linearly between vertices
+    const unsigned char values[3][4] = { { c1.r, c1.g, c1.b, c1.a }, { c2.r, c2.g, c2.b, c2.a }, { c3.r, c3.g, c3.b, c3.a } };
 
-    // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
+    for (int c = 0; c < 4; c++)
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
-
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            if ((w1 | w2 | w3) >= 0)
-            {
-                // Compute the normalized barycentric coordinates
-                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
-                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
-                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+        float delta2 = (float)values[1][c] - (float)values[0][c];
+        float delta3 = (float)values[2][c] - (float)values[0][c];
 
-                // Interpolate the color using the barycentric coordinates
-                Color finalColor = { 0 };
-                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
-                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
-                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
-                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+        writer.shade[c][0] = (delta2*(v3.y - v1.y) - delta3*(v2.y - v1.y))/signedArea;
+        writer.shade[c][1] = (delta3*(v2.x - v1.x) - delta2*(v3.x - v1.x))/signedArea;
+        writer.shade[c][2] = (float)values[0][c] - writer.shade[c][0]*v1.x - writer.shade[c][1]*v1.y;
+    }
 
-                // Draw the pixel with the interpolated color
-                ImageDrawPixel(dst, x, y, finalColor);
-            }
+    writer.shaded = true;
+    writer.blend = ((imageDrawFlags & IMAGE_DRAW_BLEND) != 0);
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+    Vector2 points[3] = { v1, v2, v3 };
+    RasterEdgeList list;
 
-        // Move to the next row in the bounding box
-        w1Row += w1YStep;
-        w2Row += w2YStep;
-        w3Row += w3YStep;
-    }
+    InitRasterEdges(&list);
+    AddRasterPolygon(&list, points, 3, 0);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
 }
 
 // Draw triangle outline within an image
 void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
+    if (imageDrawFlags & IMAGE_DRAW_ANTIALIAS)
+    {
+        Vector2 points[3] = { v1, v2, v3 };
+        ImageDrawPolygonLines(dst, points, 3, 1.0f, color);
+        return;
+    }
+
     ImageDrawLine(dst, (int)v1.x, (int)v1.y, (int)v2.x, (int)v2.y, color);
     ImageDrawLine(dst, (int)v2.x, (int)v2.y, (int)v3.x, (int)v3.y, color);
     ImageDrawLine(dst, (int)v3.x, (int)v3.y, (int)v1.x, (int)v1.y, color);
 }
 
 // Draw a triangle fan defined by points within an image (first vertex is the center)
+// NOTE: Triangles are rasterized together, pixels covered by several triangles are drawn once
 void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color)
 {
-    if (pointCount >= 3)
+    ImageSpanWriter writer = { 0 };
+    if ((points == NULL) || (pointCount < 3) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    RasterEdgeList list;
+    InitRasterEdges(&list);
+
+    for (int i = 1; i < pointCount - 1; i++)
     {
-        for (int i = 1; i < pointCount - 1; i++)
-        {
-            ImageDrawTriangle(dst, points[0], points[i], points[i + 1], color);
-        }
+        Vector2 triangle[3] = { points[0], points[i], points[i + 1] };
+        AddRasterPolygon(&list, triangle, 3, 1);
     }
+
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
 }
 
 // Draw a triangle strip defined by points within an image
+// NOTE: Triangles are rasterized together, pixels covered by several triangles are drawn once
 void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color)
 {
-    if (pointCount >= 3)
+    ImageSpanWriter writer = { 0 };
+    if ((points == NULL) || (pointCount < 3) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    RasterEdgeList list;
+    InitRasterEdges(&list);
+
+    for (int i = 2; i < pointCount; i++)
     {
-        for (int i = 2; i < pointCount; i++)
-        {
-            if ((i%2) == 0) ImageDrawTriangle(dst, points[i], points[i - 2], points[i - 1], color);
-            else ImageDrawTriangle(dst, points[i], points[i - 1], points[i - 2], color);
-        }
+        Vector2 triangle[3] = { points[i], points[i - 2], points[i - 1] };
+        AddRasterPolygon(&list, triangle, 3, 1);
     }
+
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
+}
+
+// Draw lines sequence defining thickness within an image
+// NOTE: Lines are centered on points pixels centers, joined with round joins
+void ImageDrawLineStrip(Image *dst, const Vector2 *points, int pointCount, float thick, Color color)
+{
+    ImageSpanWriter writer = { 0 };
+    if ((points == NULL) || (pointCount < 2) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    RasterEdgeList list;
+
+    InitRasterEdges(&list);
+    AddRasterPolyline(&list, points, pointCount, thick, false);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
+}
+
+// Draw a filled polygon defined by points within an image
+// NOTE: Self-intersecting polygons are filled with non-zero winding rule
+void ImageDrawPolygon(Image *dst, const Vector2 *points, int pointCount, Color color)
+{
+    ImageSpanWriter writer = { 0 };
+    if ((points == NULL) || (pointCount < 3) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    RasterEdgeList list;
+
+    InitRasterEdges(&list);
+    AddRasterPolygon(&list, points, pointCount, 0);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
+}
+
+// Draw polygon outline defining thickness within an image
+// NOTE: Lines are centered on points pixels centers, joined with round joins
+void ImageDrawPolygonLines(Image *dst, const Vector2 *points, int pointCount, float thick, Color color)
+{
+    ImageSpanWriter writer = { 0 };
+    if ((points == NULL) || (pointCount < 2) || !InitImageSpanWriter(&writer, dst, color)) return;
+
+    RasterEdgeList list;
+
+    InitRasterEdges(&list);
+    AddRasterPolyline(&list, points, pointCount, thick, true);
+    RasterizeEdges(&writer, &list, (imageDrawFlags & IMAGE_DRAW_ANTIALIAS) != 0);
 }
 
 // Draw an image (source) within an image (destination)
@@ -3965,9 +5121,8 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
-
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
+        //    [x] Consider fast path: format-pair specialized rows blending (SIMD)
+        //    [x] Support f32bit channels drawing
 
         Color colSrc, colDst, blend;
         bool blendRequired = true;
@@ -3992,16 +5147,96 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
+        // Fast path: 8bit source formats into RGBA8/RGB8 destination, source and destination rows
+        // are converted to RGBA8 (if required) and blended with a specialized row function
+        bool blendRows8bit = (((dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+            (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)) &&
+            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)));
+
+        // Float channels destination, blending is computed on RGBA32F rows to avoid precision loss
+        bool blendRowsFloat = ((dst->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) ||
+            (dst->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16));
+
+        int width = (int)srcRec.width;
+        unsigned char *rowSrc = NULL;       // Source row converted to RGBA8/RGBA32F
+        unsigned char *rowDst = NULL;       // Destination row converted to RGBA8/RGBA32F
+
+        if (blendRows8bit && (width > 0))
+        {
+            if (srcPtr->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) rowSrc = (unsigned char *)RL_MALLOC(width*4);
+            if (dst->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) rowDst = (unsigned char *)RL_MALLOC(width*4);
+        }
+        else if (blendRowsFloat && (width > 0))
+        {
+            if (srcPtr->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) rowSrc = (unsigned char *)RL_MALLOC(width*4*sizeof(float));
+            if (dst->format != PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) rowDst = (unsigned char *)RL_MALLOC(width*4*sizeof(float));
+        }
+
+        Vector4 tintNormalized = ColorNormalize(tint);
+
         for (int y = 0; y < (int)srcRec.height; y++)
         {
             unsigned char *pSrc = pSrcBase;
             unsigned char *pDst = pDstBase;
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, width*bytesPerPixelSrc);
+            else if (blendRows8bit)
+            {
+                unsigned char *srcRow = pSrc;
+                unsigned char *dstRow = pDst;
+
+                if (rowSrc != NULL)
+                {
+                    ConvertImageData(pSrc, srcPtr->format, rowSrc, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, width);
+                    srcRow = rowSrc;
+                }
+
+                if (!blendRequired)
+                {
+                    if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) memcpy(pDst, srcRow, width*4);
+                    else ConvertImageData(srcRow, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pDst, dst->format, width);
+                }
+                else
+                {
+                    if (rowDst != NULL)
+                    {
+                        ConvertImageData(pDst, dst->format, rowDst, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, width);
+                        dstRow = rowDst;
+                    }
+
+                    BlendImageRowRGBA8(dstRow, srcRow, width, tint);
+
+                    if (rowDst != NULL) ConvertImageData(rowDst, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pDst, dst->format, width);
+                }
+            }
+            else if (blendRowsFloat)
+            {
+                float *srcRow = (float *)pSrc;
+                float *dstRow = (rowDst != NULL)? (float *)rowDst : (float *)pDst;
+
+                if (rowSrc != NULL)
+                {
+                    LoadImageRowNormalized(pSrc, srcPtr->format, (float *)rowSrc, width);
+                    srcRow = (float *)rowSrc;
+                }
+
+                if (!blendRequired) memcpy(dstRow, srcRow, width*4*sizeof(float));
+                else
+                {
+                    if (rowDst != NULL) HalfToFloatArray((unsigned short *)pDst, dstRow, width*4);
+
+                    BlendImageRowFloat(dstRow, srcRow, width, tintNormalized);
+                }
+
+                if (rowDst != NULL) FloatToHalfArray(dstRow, (unsigned short *)pDst, width*4);
+            }
             else
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
+                for (int x = 0; x < width; x++)
                 {
                     colSrc = GetPixelColor(pSrc, srcPtr->format);
                     colDst = GetPixelColor(pDst, dst->format);
@@ -4021,6 +5256,9 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
             pDstBase += strideDst;
         }
 
+        RL_FREE(rowSrc);
+        RL_FREE(rowDst);
+
         if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
 
         if ((dst->mipmaps > 1) && (src.mipmaps > 1))
@@ -4089,6 +5327,9 @@ Texture2D LoadTexture(const char *fileName)
 {
     Texture2D texture = { 0 };
 
+    // GPU texture files are uploaded from mapped file data if possible, avoiding file data and pixels copies
+    if (LoadTextureFromMappedFile(fileName, &texture)) return texture;
+
     Image image = LoadImage(fileName);
 
     if (image.data != NULL)
@@ -4100,6 +5341,19 @@ Texture2D LoadTexture(const char *fileName)
     return texture;
 }
 
+// Load texture from file asynchronously, image loading runs on a worker thread
+// NOTE: Texture is uploaded and set by UpdateAsyncLoads() when image is loaded,
+// destination must remain valid until then
+unsigned int LoadTextureAsync(const char *fileName, Texture2D *texture)
+{
+    if ((fileName == NULL) || (texture == NULL)) return 0;
+
+    AsyncImageLoad *request = LoadAsyncImageRequest(fileName);
+    request->dstTexture = texture;
+
+    return LoadAsync(LoadAsyncImage, FinishAsyncImage, ReleaseAsyncImage, request);
+}
+
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
 Texture2D LoadTextureFromImage(Image image)
@@ -4120,6 +5374,18 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
+// Load texture from mapped image region
+// NOTE: Only region pixels are copied into RAM for upload
+Texture2D LoadTextureFromMappedImage(MappedImage image, Rectangle region)
+{
+    Image regionImage = LoadImageRegion(image, region);
+    Texture2D texture = LoadTextureFromImage(regionImage);
+
+    UnloadImage(regionImage);
+
+    return texture;
+}
+
 // Load cubemap from image, multiple image cubemap layouts supported
 TextureCubemap LoadTextureCubemap(Image image, int layout)
 {
@@ -4212,7 +5478,7 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
         if (cubemap.id != 0)
         {
             cubemap.format = faces.format;
-            cubemap.mipmaps = 1;
+            cubemap.mipmaps = faces.mipmaps;
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
 
@@ -4797,6 +6063,240 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
     }
 }
 
+//------------------------------------------------------------------------------------
+// Virtual texture functions
+//------------------------------------------------------------------------------------
+
+// Export mapped image as virtual texture tiles file: tiled mip pyramid, RGBA8 tiles with borders
+// NOTE: Base level tiles are read from mapped image regions and smaller levels are generated from
+// previous level tiles in the file, only tiles being processed are kept in RAM
+bool ExportVirtualTexture(MappedImage image, const char *fileName, int tileSize)
+{
+    bool success = false;
+
+    VirtualTextureData texture = { 0 };
+    if (!IsMappedImageValid(image) || (fileName == NULL) || !InitVirtualTextureLayout(&texture, image.width, image.height, tileSize, VIRTUAL_TEXTURE_BORDER)) return false;
+
+    texture.fileSize = VIRTUAL_TEXTURE_HEADER_SIZE + (size_t)texture.tileCount*texture.tileDataSize;
+    texture.fileData = MapFileData(fileName, texture.fileSize, true, &texture.fileHandle);
+
+    if (texture.fileData != NULL)
+    {
+        int header[8] = { 0, 1, texture.width, texture.height, texture.tileSize, texture.border, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, texture.levels };
+        memcpy(header, "rVTX", 4);
+        memcpy(texture.fileData, header, VIRTUAL_TEXTURE_HEADER_SIZE);
+
+        // Levels are exported in order, every level tiles are generated from previous level tiles
+        VirtualTextureExport pass = { &texture, image, 0 };
+
+        for (int i = 0; i < texture.levels; i++)
+        {
+            pass.level = i;
+            ParallelFor(texture.levelTiles[i][0]*texture.levelTiles[i][1], 1, ExportVirtualTextureTiles, &pass);
+        }
+
+        UnmapFileData(texture.fileData, texture.fileSize, texture.fileHandle);
+        success = true;
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Virtual texture exported successfully (%i levels, %i tiles)", fileName, texture.levels, texture.tileCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export virtual texture", fileName);
+
+    return success;
+}
+
+// Load virtual texture from tiles file, tiles are streamed into a cache texture (cacheSize x cacheSize pixels)
+// NOTE: GPU memory is bounded by cache size, smallest levels are loaded on load and kept resident
+VirtualTexture LoadVirtualTexture(const char *fileName, int cacheSize)
+{
+    VirtualTexture texture = { 0 };
+
+    // Header is mapped first to get tiles file layout
+    void *handle = NULL;
+    unsigned char *headerData = MapFileData(fileName, VIRTUAL_TEXTURE_HEADER_SIZE, false, &handle);
+    if (headerData == NULL) return texture;
+
+    int header[8] = { 0 };
+    memcpy(header, headerData, VIRTUAL_TEXTURE_HEADER_SIZE);
+    UnmapFileData(headerData, VIRTUAL_TEXTURE_HEADER_SIZE, handle);
+
+    VirtualTextureData *data = (VirtualTextureData *)RL_CALLOC(1, sizeof(VirtualTextureData));
+
+    if ((memcmp(header, "rVTX", 4) != 0) || (header[1] != 1) || (header[6] != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+        !InitVirtualTextureLayout(data, header[2], header[3], header[4], header[5]) || (data->levels != header[7]))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Virtual texture tiles file not valid", fileName);
+        RL_FREE(data);
+        return texture;
+    }
+
+    data->fileSize = VIRTUAL_TEXTURE_HEADER_SIZE + (size_t)data->tileCount*data->tileDataSize;
+    data->fileData = MapFileData(fileName, data->fileSize, false, &data->fileHandle);
+
+    if (data->fileData == NULL)
+    {
+        RL_FREE(data);
+        return texture;
+    }
+
+    // Cache texture slots, at least 2x2 slots
+    int slotSize = data->tileSize + 2*data->border;
+    data->slotsPerRow = (cacheSize/slotSize > 2)? cacheSize/slotSize : 2;
+    data->slotCount = data->slotsPerRow*data->slotsPerRow;
+
+    data->cache.id = rlLoadTexture(NULL, data->slotsPerRow*slotSize, data->slotsPerRow*slotSize, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    data->cache.width = data->slotsPerRow*slotSize;
+    data->cache.height = data->slotsPerRow*slotSize;
+    data->cache.mipmaps = 1;
+    data->cache.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    SetTextureFilter(data->cache, TEXTURE_FILTER_BILINEAR);
+
+    data->tileSlots = (int *)RL_MALLOC(data->tileCount*sizeof(int));
+    data->slotTiles = (int *)RL_MALLOC(data->slotCount*sizeof(int));
+    data->slotUsed = (unsigned int *)RL_CALLOC(data->slotCount, sizeof(unsigned int));
+    for (int i = 0; i < data->tileCount; i++) data->tileSlots[i] = -1;
+    for (int i = 0; i < data->slotCount; i++) data->slotTiles[i] = -1;
+
+    // Smallest levels are pinned in up to a quarter of cache slots, there is always a resident tile to draw
+    for (int i = data->levels - 1, pinned = 0; i >= 0; i--)
+    {
+        int count = data->levelTiles[i][0]*data->levelTiles[i][1];
+        if ((i < data->levels - 1) && ((pinned + count) > data->slotCount/4)) break;
+
+        for (int k = 0; k < count; k++)
+        {
+            int tile = data->levelOffset[i] + k;
+            UploadVirtualTextureTile(data, tile, data->fileData + VIRTUAL_TEXTURE_HEADER_SIZE + (size_t)tile*data->tileDataSize, true);
+        }
+
+        pinned += count;
+    }
+
+    texture.width = data->width;
+    texture.height = data->height;
+    texture.tileSize = data->tileSize;
+    texture.levels = data->levels;
+    texture.cache = data->cache;
+    texture.data = data;
+
+    TRACELOG(LOG_INFO, "TEXTURE: Virtual texture loaded successfully (%ix%i | %i levels | %i cache slots)", texture.width, texture.height, texture.levels, data->slotCount);
+
+    return texture;
+}
+
+// Check if a virtual texture is valid (tiles file mapped and cache texture loaded)
+bool IsVirtualTextureValid(VirtualTexture texture)
+{
+    return ((texture.data != NULL) && (texture.cache.id > 0));
+}
+
+// Unload virtual texture, tiles file is unmapped once pending tiles loads finish
+void UnloadVirtualTexture(VirtualTexture texture)
+{
+    VirtualTextureData *data = (VirtualTextureData *)texture.data;
+    if (data == NULL) return;
+
+    UnloadTexture(data->cache);
+    data->unloading = true;
+
+    if (data->loadCount == 0) UnloadVirtualTextureData(data);
+}
+
+// Request virtual texture tiles covering region (base level pixels) at mip level
+// NOTE: Tiles are loaded asynchronously, finished loads are uploaded by UpdateAsyncLoads(),
+// requests over MAX_VIRTUAL_TEXTURE_LOADS in flight are ignored (they are requested again on next draw)
+void RequestVirtualTextureRegion(VirtualTexture texture, Rectangle region, int level)
+{
+    VirtualTextureData *data = (VirtualTextureData *)texture.data;
+    if (!IsVirtualTextureValid(texture) || data->unloading) return;
+
+    if (level < 0) level = 0;
+    if (level > data->levels - 1) level = data->levels - 1;
+
+    int tileExtent = data->tileSize << level;
+    int x0 = (region.x > 0.0f)? (int)region.x/tileExtent : 0;
+    int y0 = (region.y > 0.0f)? (int)region.y/tileExtent : 0;
+    int x1 = (int)ceilf((region.x + region.width)/tileExtent);
+    int y1 = (int)ceilf((region.y + region.height)/tileExtent);
+    if (x1 > data->levelTiles[level][0]) x1 = data->levelTiles[level][0];
+    if (y1 > data->levelTiles[level][1]) y1 = data->levelTiles[level][1];
+
+    for (int y = y0; y < y1; y++)
+    {
+        for (int x = x0; x < x1; x++) RequestVirtualTextureTile(data, data->levelOffset[level] + y*data->levelTiles[level][0] + x);
+    }
+}
+
+// Draw virtual texture region (base level pixels) using resident tiles, visible tiles are requested
+// NOTE: Mip level is selected from source to destination scale (destination in screen pixels),
+// tiles not resident yet are drawn from the closest resident smaller level
+void DrawVirtualTexture(VirtualTexture texture, Rectangle source, Rectangle dest, Color tint)
+{
+    VirtualTextureData *data = (VirtualTextureData *)texture.data;
+    if (!IsVirtualTextureValid(texture) || (source.width <= 0.0f) || (source.height <= 0.0f) || (dest.width <= 0.0f) || (dest.height <= 0.0f)) return;
+
+    // Source clipped to virtual texture bounds, destination clipped accordingly
+    float scaleX = dest.width/source.width;
+    float scaleY = dest.height/source.height;
+    float x0 = (source.x > 0.0f)? source.x : 0.0f;
+    float y0 = (source.y > 0.0f)? source.y : 0.0f;
+    float x1 = (source.x + source.width < (float)data->width)? source.x + source.width : (float)data->width;
+    float y1 = (source.y + source.height < (float)data->height)? source.y + source.height : (float)data->height;
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    // Finest level with at least one texel per destination pixel
+    float texelsPerPixel = (scaleX < scaleY)? 1.0f/scaleX : 1.0f/scaleY;
+    int level = 0;
+    while ((level < data->levels - 1) && ((float)(2 << level) <= texelsPerPixel)) level++;
+
+    RequestVirtualTextureRegion(texture, (Rectangle){ x0, y0, x1 - x0, y1 - y0 }, level);
+    data->useStamp++;
+
+    int slotSize = data->tileSize + 2*data->border;
+    int tileExtent = data->tileSize << level;
+
+    for (int ty = (int)y0/tileExtent; ty < data->levelTiles[level][1]; ty++)
+    {
+        if ((float)ty*tileExtent >= y1) break;
+
+        for (int tx = (int)x0/tileExtent; tx < data->levelTiles[level][0]; tx++)
+        {
+            if ((float)tx*tileExtent >= x1) break;
+
+            // Page table lookup, falling back to closest resident smaller level tile
+            int resident = level;
+            int rx = tx, ry = ty;
+            int slot = data->tileSlots[data->levelOffset[level] + ty*data->levelTiles[level][0] + tx];
+
+            while ((slot < 0) && (resident < data->levels - 1))
+            {
+                resident++;
+                rx /= 2;
+                ry /= 2;
+                slot = data->tileSlots[data->levelOffset[resident] + ry*data->levelTiles[resident][0] + rx];
+            }
+
+            if (slot < 0) continue;
+            if (data->slotUsed[slot] != UINT_MAX) data->slotUsed[slot] = data->useStamp;
+
+            // Tile region clipped to source, mapped into resident tile texels and destination
+            float left = ((float)tx*tileExtent > x0)? (float)tx*tileExtent : x0;
+            float top = ((float)ty*tileExtent > y0)? (float)ty*tileExtent : y0;
+            float right = ((float)(tx + 1)*tileExtent < x1)? (float)(tx + 1)*tileExtent : x1;
+            float bottom = ((float)(ty + 1)*tileExtent < y1)? (float)(ty + 1)*tileExtent : y1;
+            float texelSize = (float)(1 << resident);
+
+            Rectangle cacheRec = {
+                (float)((slot%data->slotsPerRow)*slotSize + data->border) + (left - (float)rx*(data->tileSize << resident))/texelSize,
+                (float)((slot/data->slotsPerRow)*slotSize + data->border) + (top - (float)ry*(data->tileSize << resident))/texelSize,
+                (right - left)/texelSize, (bottom - top)/texelSize };
+            Rectangle destRec = { dest.x + (left - source.x)*scaleX, dest.y + (top - source.y)*scaleY, (right - left)*scaleX, (bottom - top)*scaleY };
+
+            DrawTexturePro(data->cache, cacheRec, destRec, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+        }
+    }
+}
+
 // Check if two colors are equal
 bool ColorIsEqual(Color col1, Color col2)
 {
@@ -5159,7 +6659,7 @@ Color GetPixelColor(void *srcPtr, int format)
         {
             color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
             color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 1) & 0b0000000000011111)*255/31);
             color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
 
         } break;
@@ -5309,6 +6809,62 @@ void SetPixelColor(void *dstPtr, Color color, int format)
             ((unsigned char *)dstPtr)[2] = color.b;
             ((unsigned char *)dstPtr)[3] = color.a;
 
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x;
+            ((float *)dstPtr)[1] = coln.y;
+            ((float *)dstPtr)[2] = coln.z;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((float *)dstPtr)[0] = coln.x;
+            ((float *)dstPtr)[1] = coln.y;
+            ((float *)dstPtr)[2] = coln.z;
+            ((float *)dstPtr)[3] = coln.w;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short *)dstPtr)[0] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned short *)dstPtr)[0] = FloatToHalf(coln.x);
+            ((unsigned short *)dstPtr)[1] = FloatToHalf(coln.y);
+            ((unsigned short *)dstPtr)[2] = FloatToHalf(coln.z);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            ((unsigned short *)dstPtr)[0] = FloatToHalf(coln.x);
+            ((unsigned short *)dstPtr)[1] = FloatToHalf(coln.y);
+            ((unsigned short *)dstPtr)[2] = FloatToHalf(coln.z);
+            ((unsigned short *)dstPtr)[3] = FloatToHalf(coln.w);
+
         } break;
         default: break;
     }
@@ -5482,6 +7038,7 @@ static Vector4 *LoadImageDataNormalized(Image image)
                     pixels[i].z = 0.0f;
                     pixels[i].w = 1.0f;
 
+                    k += 1;
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                 {
@@ -5507,6 +7064,8 @@ static Vector4 *LoadImageDataNormalized(Image image)
                     pixels[i].y = 0.0f;
                     pixels[i].z = 0.0f;
                     pixels[i].w = 1.0f;
+
+                    k += 1;
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                 {
@@ -5534,4 +7093,5136 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Convert half-float array to float array
+static void HalfToFloatArray(const unsigned short *src, float *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_F16C)
+    for (; i + 4 <= count; i += 4) _mm_storeu_ps(dst + i, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)(src + i))));
+#elif defined(RTEXTURES_SIMD_NEON64)
+    for (; i + 4 <= count; i += 4) vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+#endif
+
+    for (; i < count; i++) dst[i] = HalfToFloat(src[i]);
+}
+
+// Convert float array to half-float array
+// NOTE: Hardware conversion rounds ties to even, software conversion rounds ties away from zero
+static void FloatToHalfArray(const float *src, unsigned short *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_F16C)
+    for (; i + 4 <= count; i += 4) _mm_storel_epi64((__m128i *)(dst + i), _mm_cvtps_ph(_mm_loadu_ps(src + i), 0));
+#elif defined(RTEXTURES_SIMD_NEON64)
+    for (; i + 4 <= count; i += 4) vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+#endif
+
+    for (; i < count; i++) dst[i] = FloatToHalf(src[i]);
+}
+
+// Convert float normalized array to unsigned char array
+static void FloatToUnorm8Array(const float *src, unsigned char *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 scale = _mm_set1_ps(255.0f);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i v0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+        __m128i v1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale));
+        __m128i v2 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 8), scale));
+        __m128i v3 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 12), scale));
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint16x4_t v0 = vqmovn_u32(vcvtq_u32_f32(vmulq_f32(vld1q_f32(src + i), scale)));
+        uint16x4_t v1 = vqmovn_u32(vcvtq_u32_f32(vmulq_f32(vld1q_f32(src + i + 4), scale)));
+
+        vst1_u8(dst + i, vqmovn_u16(vcombine_u16(v0, v1)));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = (unsigned char)(src[i]*255.0f);
+}
+
+#if defined(RTEXTURES_SIMD_SSE2)
+// Reduce 8bit channels (16-bit lanes) to [0..max] range: (value*max + 127)/255
+static inline __m128i ReduceChannelSSE2(__m128i value, int max)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(value, _mm_set1_epi16((short)max)), _mm_set1_epi16(127));
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)), _mm_srli_epi16(t, 8)), 8);
+}
+#elif defined(RTEXTURES_SIMD_NEON)
+// Reduce 8bit channels (16-bit lanes) to [0..max] range: (value*max + 127)/255
+static inline uint16x8_t ReduceChannelNEON(uint16x8_t value, unsigned short max)
+{
+    uint16x8_t t = vmlaq_n_u16(vdupq_n_u16(127), value, max);
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(t, vdupq_n_u16(1)), vshrq_n_u16(t, 8)), 8);
+}
+#endif
+
+// Convert pixel data with a format-pair specialized kernel
+// NOTE: Results match the generic conversion through LoadImageDataNormalized(),
+// function returns false if the formats pair has no specialized kernel; with no pixels
+// (pixelCount 0, data can be NULL) it only checks if the formats pair is supported
+static bool ConvertImageData(const void *srcData, int srcFormat, void *dstData, int dstFormat, int pixelCount)
+{
+    bool result = true;
+
+    const unsigned char *src8 = (const unsigned char *)srcData;
+    unsigned char *dst8 = (unsigned char *)dstData;
+    int i = 0;
+
+    if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(RTEXTURES_SIMD_SSE2)
+        const __m128i alpha = _mm_set1_epi8((char)0xff);
+
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            __m128i gray = _mm_loadu_si128((const __m128i *)(src8 + i));
+            __m128i gg = _mm_unpacklo_epi8(gray, gray);
+            __m128i ga = _mm_unpacklo_epi8(gray, alpha);
+
+            _mm_storeu_si128((__m128i *)(dst8 + i*4), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(dst8 + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+
+            gg = _mm_unpackhi_epi8(gray, gray);
+            ga = _mm_unpackhi_epi8(gray, alpha);
+
+            _mm_storeu_si128((__m128i *)(dst8 + i*4 + 32), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(dst8 + i*4 + 48), _mm_unpackhi_epi16(gg, ga));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            uint8x16x4_t rgba;
+            rgba.val[0] = vld1q_u8(src8 + i);
+            rgba.val[1] = rgba.val[0];
+            rgba.val[2] = rgba.val[0];
+            rgba.val[3] = vdupq_n_u8(255);
+
+            vst4q_u8(dst8 + i*4, rgba);
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            dst8[i*4] = src8[i];
+            dst8[i*4 + 1] = src8[i];
+            dst8[i*4 + 2] = src8[i];
+            dst8[i*4 + 3] = 255;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(RTEXTURES_SIMD_SSE2)
+        const __m128i mask = _mm_set1_epi16(0x00ff);
+
+        for (; i + 8 <= pixelCount; i += 8)
+        {
+            __m128i ga = _mm_loadu_si128((const __m128i *)(src8 + i*2));
+            __m128i gray = _mm_and_si128(ga, mask);
+            __m128i gg = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+            _mm_storeu_si128((__m128i *)(dst8 + i*4), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(dst8 + i*4 + 16), _mm_unpackhi_epi16(gg, ga));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            uint8x16x2_t ga = vld2q_u8(src8 + i*2);
+            uint8x16x4_t rgba;
+            rgba.val[0] = ga.val[0];
+            rgba.val[1] = ga.val[0];
+            rgba.val[2] = ga.val[0];
+            rgba.val[3] = ga.val[1];
+
+            vst4q_u8(dst8 + i*4, rgba);
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            dst8[i*4] = src8[i*2];
+            dst8[i*4 + 1] = src8[i*2];
+            dst8[i*4 + 2] = src8[i*2];
+            dst8[i*4 + 3] = src8[i*2 + 1];
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+    #if defined(RTEXTURES_SIMD_SSSE3)
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+        // NOTE: Every load reads 16 bytes (5.33 pixels), last pixels are processed by the scalar loop
+        for (; i + 6 <= pixelCount; i += 4)
+        {
+            __m128i rgb = _mm_loadu_si128((const __m128i *)(src8 + i*3));
+            _mm_storeu_si128((__m128i *)(dst8 + i*4), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            uint8x16x3_t rgb = vld3q_u8(src8 + i*3);
+            uint8x16x4_t rgba;
+            rgba.val[0] = rgb.val[0];
+            rgba.val[1] = rgb.val[1];
+            rgba.val[2] = rgb.val[2];
+            rgba.val[3] = vdupq_n_u8(255);
+
+            vst4q_u8(dst8 + i*4, rgba);
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            dst8[i*4] = src8[i*3];
+            dst8[i*4 + 1] = src8[i*3 + 1];
+            dst8[i*4 + 2] = src8[i*3 + 2];
+            dst8[i*4 + 3] = 255;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+    {
+    #if defined(RTEXTURES_SIMD_SSSE3)
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+        // Compact 16 pixels (4 loads) into 3 stores of 16 bytes
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src8 + i*4)), shuffle);
+            __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src8 + i*4 + 16)), shuffle);
+            __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src8 + i*4 + 32)), shuffle);
+            __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src8 + i*4 + 48)), shuffle);
+
+            _mm_storeu_si128((__m128i *)(dst8 + i*3), _mm_or_si128(v0, _mm_slli_si128(v1, 12)));
+            _mm_storeu_si128((__m128i *)(dst8 + i*3 + 16), _mm_or_si128(_mm_srli_si128(v1, 4), _mm_slli_si128(v2, 8)));
+            _mm_storeu_si128((__m128i *)(dst8 + i*3 + 32), _mm_or_si128(_mm_srli_si128(v2, 8), _mm_slli_si128(v3, 4)));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; i + 16 <= pixelCount; i += 16)
+        {
+            uint8x16x4_t rgba = vld4q_u8(src8 + i*4);
+            uint8x16x3_t rgb;
+            rgb.val[0] = rgba.val[0];
+            rgb.val[1] = rgba.val[1];
+            rgb.val[2] = rgba.val[2];
+
+            vst3q_u8(dst8 + i*3, rgb);
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            dst8[i*3] = src8[i*4];
+            dst8[i*3 + 1] = src8[i*4 + 1];
+            dst8[i*3 + 2] = src8[i*4 + 2];
+        }
+    }
+    else if (((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8)) &&
+             ((dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)))
+    {
+        // NOTE: Luminance is computed in float, same as the generic conversion, to get identical results
+        int srcStride = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 3;
+        int dstStride = (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        if (srcStride == 4)
+        {
+            const __m128i mask = _mm_set1_epi32(0xff);
+            const __m128 norm = _mm_set1_ps(255.0f);
+
+            for (; i + 4 <= pixelCount; i += 4)
+            {
+                __m128i rgba = _mm_loadu_si128((const __m128i *)(src8 + i*4));
+                __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(rgba, mask)), norm);
+                __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), mask)), norm);
+                __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), mask)), norm);
+                __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+                __m128i gray = _mm_cvttps_epi32(_mm_mul_ps(y, norm));
+
+                if (dstStride == 2)
+                {
+                    // Alpha goes through the float normalization unchanged
+                    __m128i ga = _mm_packus_epi16(_mm_packs_epi32(gray, _mm_srli_epi32(rgba, 24)), _mm_setzero_si128());
+                    _mm_storel_epi64((__m128i *)(dst8 + i*2), _mm_unpacklo_epi8(ga, _mm_srli_si128(ga, 4)));
+                }
+                else
+                {
+                    gray = _mm_packs_epi32(gray, gray);
+                    int packed = _mm_cvtsi128_si32(_mm_packus_epi16(gray, gray));
+                    memcpy(dst8 + i, &packed, 4);
+                }
+            }
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            float r = (float)src8[i*srcStride]/255.0f;
+            float g = (float)src8[i*srcStride + 1]/255.0f;
+            float b = (float)src8[i*srcStride + 2]/255.0f;
+
+            dst8[i*dstStride] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+            if (dstStride == 2) dst8[i*2 + 1] = (srcStride == 4)? src8[i*4 + 3] : 255;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+             ((dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+              (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+              (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)))
+    {
+        // Channels are reduced with round(value*max/255), computed exactly in integers
+        // as (value*max + 127)/255, where x/255 = (x + 1 + (x >> 8)) >> 8 for the required range
+        unsigned short *dst16 = (unsigned short *)dstData;
+
+        // Channels max values and bit shifts
+        int rMax = 31, gMax = 63, bMax = 31, aMax = 0;
+        int rShift = 11, gShift = 5, bShift = 0;
+
+        if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) { gMax = 31; gShift = 6; bShift = 1; }
+        else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) { rMax = 15; gMax = 15; bMax = 15; aMax = 15; rShift = 12; gShift = 8; bShift = 4; }
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        const __m128i mask = _mm_set1_epi16(0xff);
+        const __m128i one = _mm_set1_epi16(1);
+        const __m128i threshold = _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD);
+
+        for (; i + 8 <= pixelCount; i += 8)
+        {
+            // Deinterleave 8 pixels into 16-bit lanes: rg = r | g << 16, ba = b | a << 16
+            __m128i p0 = _mm_loadu_si128((const __m128i *)(src8 + i*4));
+            __m128i p1 = _mm_loadu_si128((const __m128i *)(src8 + i*4 + 16));
+            __m128i rb0 = _mm_and_si128(p0, mask);
+            __m128i rb1 = _mm_and_si128(p1, mask);
+            __m128i ga0 = _mm_srli_epi16(p0, 8);
+            __m128i ga1 = _mm_srli_epi16(p1, 8);
+
+            // Gather even lanes (r, g) and odd lanes (b, a) from both pixel groups
+            rb0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(rb0, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            rb1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(rb1, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            ga0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ga0, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            ga1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ga1, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            rb0 = _mm_shuffle_epi32(rb0, _MM_SHUFFLE(3, 1, 2, 0));
+            rb1 = _mm_shuffle_epi32(rb1, _MM_SHUFFLE(3, 1, 2, 0));
+            ga0 = _mm_shuffle_epi32(ga0, _MM_SHUFFLE(3, 1, 2, 0));
+            ga1 = _mm_shuffle_epi32(ga1, _MM_SHUFFLE(3, 1, 2, 0));
+
+            __m128i r = _mm_unpacklo_epi64(rb0, rb1);
+            __m128i b = _mm_unpackhi_epi64(rb0, rb1);
+            __m128i g = _mm_unpacklo_epi64(ga0, ga1);
+            __m128i a = _mm_unpackhi_epi64(ga0, ga1);
+
+            __m128i result = _mm_sll_epi16(ReduceChannelSSE2(r, rMax), _mm_cvtsi32_si128(rShift));
+            result = _mm_or_si128(result, _mm_sll_epi16(ReduceChannelSSE2(g, gMax), _mm_cvtsi32_si128(gShift)));
+            result = _mm_or_si128(result, _mm_sll_epi16(ReduceChannelSSE2(b, bMax), _mm_cvtsi32_si128(bShift)));
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) result = _mm_or_si128(result, _mm_and_si128(_mm_cmpgt_epi16(a, threshold), one));
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) result = _mm_or_si128(result, ReduceChannelSSE2(a, aMax));
+
+            _mm_storeu_si128((__m128i *)(dst16 + i), result);
+        }
+    #elif defined(RTEXTURES_SIMD_NEON)
+        for (; i + 8 <= pixelCount; i += 8)
+        {
+            uint8x8x4_t rgba = vld4_u8(src8 + i*4);
+            uint16x8_t r = ReduceChannelNEON(vmovl_u8(rgba.val[0]), (unsigned short)rMax);
+            uint16x8_t g = ReduceChannelNEON(vmovl_u8(rgba.val[1]), (unsigned short)gMax);
+            uint16x8_t b = ReduceChannelNEON(vmovl_u8(rgba.val[2]), (unsigned short)bMax);
+            uint16x8_t result = vorrq_u16(vorrq_u16(vshlq_u16(r, vdupq_n_s16((short)rShift)), vshlq_u16(g, vdupq_n_s16((short)gShift))), vshlq_u16(b, vdupq_n_s16((short)bShift)));
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) result = vorrq_u16(result, vmovl_u8(vshr_n_u8(vcgt_u8(rgba.val[3], vdup_n_u8(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), 7)));
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) result = vorrq_u16(result, ReduceChannelNEON(vmovl_u8(rgba.val[3]), (unsigned short)aMax));
+
+            vst1q_u16(dst16 + i, result);
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            const unsigned char *pixel = src8 + i*4;
+            unsigned short value = (unsigned short)((((pixel[0]*rMax + 127)/255) << rShift) | (((pixel[1]*gMax + 127)/255) << gShift) | (((pixel[2]*bMax + 127)/255) << bShift));
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) value |= (pixel[3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+            else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) value |= (unsigned short)((pixel[3]*aMax + 127)/255);
+
+            dst16[i] = value;
+        }
+    }
+    else if (((srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+              (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+              (srcFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        // Channels expansion lookup tables, computed with the generic conversion operations
+        unsigned char expand4[16] = { 0 };
+        unsigned char expand5[32] = { 0 };
+        unsigned char expand6[64] = { 0 };
+
+        for (int n = 0; n < 16; n++) expand4[n] = (unsigned char)(((float)n*(1.0f/15))*255.0f);
+        for (int n = 0; n < 32; n++) expand5[n] = (unsigned char)(((float)n*(1.0f/31))*255.0f);
+        for (int n = 0; n < 64; n++) expand6[n] = (unsigned char)(((float)n*(1.0f/63))*255.0f);
+
+        const unsigned short *src16 = (const unsigned short *)srcData;
+
+        if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+        {
+            for (; i < pixelCount; i++)
+            {
+                dst8[i*4] = expand5[src16[i] >> 11];
+                dst8[i*4 + 1] = expand6[(src16[i] >> 5) & 0x3f];
+                dst8[i*4 + 2] = expand5[src16[i] & 0x1f];
+                dst8[i*4 + 3] = 255;
+            }
+        }
+        else if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+        {
+            for (; i < pixelCount; i++)
+            {
+                dst8[i*4] = expand5[src16[i] >> 11];
+                dst8[i*4 + 1] = expand5[(src16[i] >> 6) & 0x1f];
+                dst8[i*4 + 2] = expand5[(src16[i] >> 1) & 0x1f];
+                dst8[i*4 + 3] = (src16[i] & 0x1)? 255 : 0;
+            }
+        }
+        else
+        {
+            for (; i < pixelCount; i++)
+            {
+                dst8[i*4] = expand4[src16[i] >> 12];
+                dst8[i*4 + 1] = expand4[(src16[i] >> 8) & 0xf];
+                dst8[i*4 + 2] = expand4[(src16[i] >> 4) & 0xf];
+                dst8[i*4 + 3] = expand4[src16[i] & 0xf];
+            }
+        }
+    }
+    else if (((srcFormat >= PIXELFORMAT_UNCOMPRESSED_R32) && (srcFormat <= PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        // NOTE: Half-float data is converted to float in blocks, then processed as float data
+        bool half = (srcFormat >= PIXELFORMAT_UNCOMPRESSED_R16);
+        int channels = 1;
+        if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16)) channels = 3;
+        else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) || (srcFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) channels = 4;
+
+        float block[256] = { 0 };
+        int blockPixels = 256/channels;
+
+        for (int start = 0; start < pixelCount; start += blockPixels)
+        {
+            int count = ((pixelCount - start) < blockPixels)? (pixelCount - start) : blockPixels;
+            const float *values = NULL;
+
+            if (half)
+            {
+                HalfToFloatArray((const unsigned short *)srcData + start*channels, block, count*channels);
+                values = block;
+            }
+            else values = (const float *)srcData + start*channels;
+
+            if (channels == 4) FloatToUnorm8Array(values, dst8 + start*4, count*4);
+            else
+            {
+                for (int k = 0; k < count; k++)
+                {
+                    unsigned char *pixel = dst8 + (start + k)*4;
+
+                    pixel[0] = (unsigned char)(values[k*channels]*255.0f);
+                    pixel[1] = (channels == 3)? (unsigned char)(values[k*channels + 1]*255.0f) : 0;
+                    pixel[2] = (channels == 3)? (unsigned char)(values[k*channels + 2]*255.0f) : 0;
+                    pixel[3] = 255;
+                }
+            }
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        float *dst32 = (float *)dstData;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        const __m128 norm = _mm_set1_ps(255.0f);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 4 <= pixelCount; i += 4)
+        {
+            __m128i rgba = _mm_loadu_si128((const __m128i *)(src8 + i*4));
+            __m128i lo = _mm_unpacklo_epi8(rgba, zero);
+            __m128i hi = _mm_unpackhi_epi8(rgba, zero);
+
+            _mm_storeu_ps(dst32 + i*4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), norm));
+            _mm_storeu_ps(dst32 + i*4 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), norm));
+            _mm_storeu_ps(dst32 + i*4 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), norm));
+            _mm_storeu_ps(dst32 + i*4 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), norm));
+        }
+    #elif defined(RTEXTURES_SIMD_NEON64)
+        const float32x4_t norm = vdupq_n_f32(255.0f);
+
+        for (; i + 4 <= pixelCount; i += 4)
+        {
+            uint8x16_t rgba = vld1q_u8(src8 + i*4);
+            uint16x8_t lo = vmovl_u8(vget_low_u8(rgba));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(rgba));
+
+            vst1q_f32(dst32 + i*4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), norm));
+            vst1q_f32(dst32 + i*4 + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), norm));
+            vst1q_f32(dst32 + i*4 + 8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), norm));
+            vst1q_f32(dst32 + i*4 + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), norm));
+        }
+    #endif
+        for (; i < pixelCount; i++)
+        {
+            dst32[i*4] = (float)src8[i*4]/255.0f;
+            dst32[i*4 + 1] = (float)src8[i*4 + 1]/255.0f;
+            dst32[i*4 + 2] = (float)src8[i*4 + 2]/255.0f;
+            dst32[i*4 + 3] = (float)src8[i*4 + 3]/255.0f;
+        }
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
+    {
+        // Only 256 possible values per channel, use a lookup table
+        unsigned short halfs[256] = { 0 };
+        for (int n = 0; n < 256; n++) halfs[n] = FloatToHalf((float)n/255.0f);
+
+        unsigned short *dst16 = (unsigned short *)dstData;
+        for (; i < pixelCount*4; i++) dst16[i] = halfs[src8[i]];
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        HalfToFloatArray((const unsigned short *)srcData, (float *)dstData, pixelCount*4);
+    }
+    else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))
+    {
+        FloatToHalfArray((const float *)srcData, (unsigned short *)dstData, pixelCount*4);
+    }
+    else result = false;
+
+    return result;
+}
+
+// Alpha blend (source-over) one RGBA8 pixel into RGBA8 destination, tint factors are (tint + 1)
+// NOTE: Results match ColorAlphaBlend(), opaque destination avoids the division by output alpha
+static inline void BlendPixelRGBA8(unsigned char *dst, const unsigned char *src, const unsigned int *tintFactor)
+{
+    unsigned int srcA = (src[3]*tintFactor[3]) >> 8;
+
+    if (srcA == 0) return;
+
+    unsigned int srcR = (src[0]*tintFactor[0]) >> 8;
+    unsigned int srcG = (src[1]*tintFactor[1]) >> 8;
+    unsigned int srcB = (src[2]*tintFactor[2]) >> 8;
+
+    if (srcA == 255)
+    {
+        dst[0] = (unsigned char)srcR;
+        dst[1] = (unsigned char)srcG;
+        dst[2] = (unsigned char)srcB;
+        dst[3] = 255;
+    }
+    else
+    {
+        unsigned int alpha = srcA + 1;
+
+        if (dst[3] == 255)
+        {
+            // Output alpha is 255: out = (src*alpha*256 + dst*255*(256 - alpha))/(255*256)
+            unsigned int dstFactor = 255*(256 - alpha);
+
+            dst[0] = (unsigned char)((srcR*alpha*256 + dst[0]*dstFactor)/65280);
+            dst[1] = (unsigned char)((srcG*alpha*256 + dst[1]*dstFactor)/65280);
+            dst[2] = (unsigned char)((srcB*alpha*256 + dst[2]*dstFactor)/65280);
+        }
+        else
+        {
+            // NOTE: Output alpha is never 0 here, alpha*256 >= 512
+            unsigned int outA = (alpha*256 + dst[3]*(256 - alpha)) >> 8;
+            unsigned int dstFactor = dst[3]*(256 - alpha);
+
+            dst[0] = (unsigned char)(((srcR*alpha*256 + dst[0]*dstFactor)/outA) >> 8);
+            dst[1] = (unsigned char)(((srcG*alpha*256 + dst[1]*dstFactor)/outA) >> 8);
+            dst[2] = (unsigned char)(((srcB*alpha*256 + dst[2]*dstFactor)/outA) >> 8);
+            dst[3] = (unsigned char)outA;
+        }
+    }
+}
+
+// Alpha blend (source-over) a row of RGBA8 pixels into RGBA8 destination, tint applied to source
+// NOTE: Results match ColorAlphaBlend(), SIMD path processes groups of pixels that are fully
+// transparent, fully opaque or blended over an opaque destination, the division by 255*256
+// is computed as t = (x1 + x2 - ceil(x2/256)), out = (t + 1 + (t >> 8)) >> 8 on 16-bit lanes
+static void BlendImageRowRGBA8(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    const unsigned int tintFactor[4] = { (unsigned int)tint.r + 1, (unsigned int)tint.g + 1, (unsigned int)tint.b + 1, (unsigned int)tint.a + 1 };
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i factor = _mm_setr_epi16((short)tintFactor[0], (short)tintFactor[1], (short)tintFactor[2], (short)tintFactor[3],
+                                          (short)tintFactor[0], (short)tintFactor[1], (short)tintFactor[2], (short)tintFactor[3]);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+
+        // Apply tint: (src*(tint + 1)) >> 8
+        __m128i sLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), factor), 8);
+        __m128i sHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), factor), 8);
+        s = _mm_packus_epi16(sLo, sHi);
+
+        __m128i srcAlpha = _mm_and_si128(s, alphaMask);
+        __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zero);
+        __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+
+        if (_mm_movemask_epi8(transparent) == 0xffff) continue;
+        if (_mm_movemask_epi8(opaque) == 0xffff) { _mm_storeu_si128((__m128i *)(dst + i*4), s); continue; }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(d, alphaMask), alphaMask)) == 0xffff)
+        {
+            __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128i x1Lo = _mm_mullo_epi16(sLo, _mm_add_epi16(aLo, one));
+            __m128i x1Hi = _mm_mullo_epi16(sHi, _mm_add_epi16(aHi, one));
+            __m128i x2Lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(c255, aLo));
+            __m128i x2Hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(c255, aHi));
+
+            __m128i tLo = _mm_sub_epi16(_mm_add_epi16(x1Lo, x2Lo), _mm_srli_epi16(_mm_add_epi16(x2Lo, c255), 8));
+            __m128i tHi = _mm_sub_epi16(_mm_add_epi16(x1Hi, x2Hi), _mm_srli_epi16(_mm_add_epi16(x2Hi, c255), 8));
+            tLo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(tLo, one), _mm_srli_epi16(tLo, 8)), 8);
+            tHi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(tHi, one), _mm_srli_epi16(tHi, 8)), 8);
+
+            __m128i blend = _mm_or_si128(_mm_packus_epi16(tLo, tHi), alphaMask);
+
+            // Select per pixel: transparent source keeps destination, opaque source replaces it
+            blend = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, blend));
+            blend = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, blend));
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), blend);
+        }
+        else
+        {
+            for (int k = 0; k < 4; k++) BlendPixelRGBA8(dst + (i + k)*4, src + (i + k)*4, tintFactor);
+        }
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t c255 = vdupq_n_u16(255);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t s = vld4_u8(src + i*4);
+        uint8x8x4_t d = vld4_u8(dst + i*4);
+
+        // Apply tint: (src*(tint + 1)) >> 8
+        for (int c = 0; c < 4; c++) s.val[c] = vshrn_n_u16(vmulq_n_u16(vmovl_u8(s.val[c]), (unsigned short)tintFactor[c]), 8);
+
+        unsigned long long srcAlpha = vget_lane_u64(vreinterpret_u64_u8(s.val[3]), 0);
+
+        if (srcAlpha == 0) continue;
+        if (srcAlpha == 0xffffffffffffffffULL) { vst4_u8(dst + i*4, s); continue; }
+
+        if (vget_lane_u64(vreinterpret_u64_u8(d.val[3]), 0) == 0xffffffffffffffffULL)
+        {
+            uint8x8_t transparent = vceq_u8(s.val[3], vdup_n_u8(0));
+            uint8x8_t opaque = vceq_u8(s.val[3], vdup_n_u8(255));
+            uint16x8_t a = vmovl_u8(s.val[3]);
+            uint16x8_t alpha = vaddq_u16(a, one);
+            uint16x8_t invAlpha = vsubq_u16(c255, a);
+
+            for (int c = 0; c < 3; c++)
+            {
+                uint16x8_t x1 = vmulq_u16(vmovl_u8(s.val[c]), alpha);
+                uint16x8_t x2 = vmulq_u16(vmovl_u8(d.val[c]), invAlpha);
+                uint16x8_t t = vsubq_u16(vaddq_u16(x1, x2), vshrq_n_u16(vaddq_u16(x2, c255), 8));
+                uint8x8_t blend = vmovn_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(t, one), vshrq_n_u16(t, 8)), 8));
+
+                // Select per pixel: transparent source keeps destination, opaque source replaces it
+                d.val[c] = vbsl_u8(opaque, s.val[c], vbsl_u8(transparent, d.val[c], blend));
+            }
+
+            vst4_u8(dst + i*4, d);
+        }
+        else
+        {
+            for (int k = 0; k < 8; k++) BlendPixelRGBA8(dst + (i + k)*4, src + (i + k)*4, tintFactor);
+        }
+    }
+#endif
+
+    for (; i < count; i++) BlendPixelRGBA8(dst + i*4, src + i*4, tintFactor);
+}
+
+// Alpha blend (source-over) a row of RGBA32F pixels into RGBA32F destination, tint applied to source
+// NOTE: Values are not clamped, blending is computed at full float precision
+static void BlendImageRowFloat(float *dst, const float *src, int count, Vector4 tint)
+{
+    for (int i = 0; i < count*4; i += 4)
+    {
+        float srcA = src[i + 3]*tint.w;
+
+        if (srcA <= 0.0f) continue;
+
+        float srcR = src[i]*tint.x;
+        float srcG = src[i + 1]*tint.y;
+        float srcB = src[i + 2]*tint.z;
+
+        if (srcA >= 1.0f)
+        {
+            dst[i] = srcR;
+            dst[i + 1] = srcG;
+            dst[i + 2] = srcB;
+            dst[i + 3] = srcA;
+        }
+        else
+        {
+            float dstFactor = dst[i + 3]*(1.0f - srcA);
+            float outA = srcA + dstFactor;
+
+            dst[i] = (srcR*srcA + dst[i]*dstFactor)/outA;
+            dst[i + 1] = (srcG*srcA + dst[i + 1]*dstFactor)/outA;
+            dst[i + 2] = (srcB*srcA + dst[i + 2]*dstFactor)/outA;
+            dst[i + 3] = outA;
+        }
+    }
+}
+
+// Load a row of pixels as RGBA32F normalized values
+static void LoadImageRowNormalized(const void *src, int format, float *dst, int count)
+{
+    if (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) memcpy(dst, src, count*4*sizeof(float));
+    else if (!ConvertImageData(src, format, dst, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, count))
+    {
+        int bytesPerPixel = GetPixelDataSize(1, 1, format);
+
+        for (int i = 0; i < count; i++)
+        {
+            const unsigned char *pixel = (const unsigned char *)src + i*bytesPerPixel;
+
+            switch (format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_R32: dst[i*4] = dst[i*4 + 1] = dst[i*4 + 2] = ((const float *)pixel)[0]; dst[i*4 + 3] = 1.0f; break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    dst[i*4] = ((const float *)pixel)[0];
+                    dst[i*4 + 1] = ((const float *)pixel)[1];
+                    dst[i*4 + 2] = ((const float *)pixel)[2];
+                    dst[i*4 + 3] = 1.0f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16: dst[i*4] = dst[i*4 + 1] = dst[i*4 + 2] = HalfToFloat(((const unsigned short *)pixel)[0]); dst[i*4 + 3] = 1.0f; break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    dst[i*4] = HalfToFloat(((const unsigned short *)pixel)[0]);
+                    dst[i*4 + 1] = HalfToFloat(((const unsigned short *)pixel)[1]);
+                    dst[i*4 + 2] = HalfToFloat(((const unsigned short *)pixel)[2]);
+                    dst[i*4 + 3] = 1.0f;
+                } break;
+                default:
+                {
+                    Color color = GetPixelColor((void *)pixel, format);
+
+                    dst[i*4] = (float)color.r/255.0f;
+                    dst[i*4 + 1] = (float)color.g/255.0f;
+                    dst[i*4 + 2] = (float)color.b/255.0f;
+                    dst[i*4 + 3] = (float)color.a/255.0f;
+                } break;
+            }
+        }
+    }
+}
+
+// Box blur one line of pixels (4 channels, 8.8 fixed point) using running sums
+// NOTE: Window is clipped at line borders, sums are scaled by precomputed window size reciprocals
+static void BoxBlurLine(const unsigned int *src, unsigned int *dst, int width, int radius, const float *reciprocals)
+{
+    int count = (radius < width)? (radius + 1) : width;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    __m128i sum = _mm_setzero_si128();
+    for (int i = 0; i < count; i++) sum = _mm_add_epi32(sum, _mm_loadu_si128((const __m128i *)(src + i*4)));
+
+    for (int x = 0; x < width; x++)
+    {
+        _mm_storeu_si128((__m128i *)(dst + x*4), _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_set1_ps(reciprocals[count]))));
+
+        // Slide window from [x - radius, x + radius] to [x - radius + 1, x + radius + 1]
+        int next = x + radius + 1;
+        int prev = x - radius;
+
+        if (next < width) { sum = _mm_add_epi32(sum, _mm_loadu_si128((const __m128i *)(src + next*4))); count++; }
+        if (prev >= 0) { sum = _mm_sub_epi32(sum, _mm_loadu_si128((const __m128i *)(src + prev*4))); count--; }
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint32x4_t sum = vdupq_n_u32(0);
+    for (int i = 0; i < count; i++) sum = vaddq_u32(sum, vld1q_u32(src + i*4));
+
+    for (int x = 0; x < width; x++)
+    {
+        vst1q_u32(dst + x*4, vcvtq_u32_f32(vmlaq_n_f32(vdupq_n_f32(0.5f), vcvtq_f32_u32(sum), reciprocals[count])));
+
+        // Slide window from [x - radius, x + radius] to [x - radius + 1, x + radius + 1]
+        int next = x + radius + 1;
+        int prev = x - radius;
+
+        if (next < width) { sum = vaddq_u32(sum, vld1q_u32(src + next*4)); count++; }
+        if (prev >= 0) { sum = vsubq_u32(sum, vld1q_u32(src + prev*4)); count--; }
+    }
+#else
+    unsigned int sum[4] = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        sum[0] += src[i*4];
+        sum[1] += src[i*4 + 1];
+        sum[2] += src[i*4 + 2];
+        sum[3] += src[i*4 + 3];
+    }
+
+    for (int x = 0; x < width; x++)
+    {
+        dst[x*4] = (unsigned int)((float)sum[0]*reciprocals[count] + 0.5f);
+        dst[x*4 + 1] = (unsigned int)((float)sum[1]*reciprocals[count] + 0.5f);
+        dst[x*4 + 2] = (unsigned int)((float)sum[2]*reciprocals[count] + 0.5f);
+        dst[x*4 + 3] = (unsigned int)((float)sum[3]*reciprocals[count] + 0.5f);
+
+        // Slide window from [x - radius, x + radius] to [x - radius + 1, x + radius + 1]
+        int next = x + radius + 1;
+        int prev = x - radius;
+
+        if (next < width)
+        {
+            sum[0] += src[next*4];
+            sum[1] += src[next*4 + 1];
+            sum[2] += src[next*4 + 2];
+            sum[3] += src[next*4 + 3];
+            count++;
+        }
+
+        if (prev >= 0)
+        {
+            sum[0] -= src[prev*4];
+            sum[1] -= src[prev*4 + 1];
+            sum[2] -= src[prev*4 + 2];
+            sum[3] -= src[prev*4 + 3];
+            count--;
+        }
+    }
+#endif
+}
+
+// Box blur blocks of rows and store them transposed (ParallelFor() task)
+// NOTE: Every block of BOX_BLUR_BLOCK_ROWS rows is stored as contiguous segments of destination rows
+static void BoxBlurRowsTransposed(int start, int end, void *userData)
+{
+    const BoxBlurPass *pass = (const BoxBlurPass *)userData;
+    const int width = pass->width;
+    const int height = pass->height;
+    const int windowMax = ((2*pass->radius + 1) < width)? (2*pass->radius + 1) : width;
+
+    unsigned int *line = (unsigned int *)RL_MALLOC(width*4*sizeof(unsigned int));
+    unsigned int *temp = (unsigned int *)RL_MALLOC(width*4*sizeof(unsigned int));
+    unsigned int *block = (unsigned int *)RL_MALLOC(width*BOX_BLUR_BLOCK_ROWS*sizeof(unsigned int));
+    float *reciprocals = (float *)RL_MALLOC((windowMax + 1)*sizeof(float));
+    float alphaReciprocals[256] = { 0 };            // 255/alpha, zero for fully transparent pixels
+
+    for (int n = 1; n <= windowMax; n++) reciprocals[n] = 1.0f/(float)n;
+    for (int a = 1; a < 256; a++) alphaReciprocals[a] = 255.0f/(float)a;
+
+    for (int b = start; b < end; b++)
+    {
+        int y0 = b*BOX_BLUR_BLOCK_ROWS;
+        int rows = ((height - y0) < BOX_BLUR_BLOCK_ROWS)? (height - y0) : BOX_BLUR_BLOCK_ROWS;
+
+        for (int k = 0; k < rows; k++)
+        {
+            const unsigned char *src = pass->src + (size_t)(y0 + k)*width*4;
+
+            int x = 0;
+
+            // Load row into 8.8 fixed point, premultiplying alpha if required: c*a/255 ~= (c*a*257 + 128) >> 8
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; x + 2 <= width; x += 2)
+            {
+                __m128i pixels = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + x*4)), _mm_setzero_si128());
+                __m128i value = _mm_slli_epi16(pixels, 8);
+
+                if (pass->alphaMode == 1)
+                {
+                    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                    __m128i color = _mm_mullo_epi16(pixels, alpha);
+                    color = _mm_add_epi16(color, _mm_srli_epi16(_mm_add_epi16(color, _mm_set1_epi16(128)), 8));
+
+                    const __m128i alphaMask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+                    value = _mm_or_si128(_mm_andnot_si128(alphaMask, color), _mm_and_si128(alphaMask, value));
+                }
+
+                _mm_storeu_si128((__m128i *)(line + x*4), _mm_unpacklo_epi16(value, _mm_setzero_si128()));
+                _mm_storeu_si128((__m128i *)(line + x*4 + 4), _mm_unpackhi_epi16(value, _mm_setzero_si128()));
+            }
+        #endif
+            for (; x < width; x++)
+            {
+                unsigned int a = src[x*4 + 3];
+
+                if (pass->alphaMode == 1)
+                {
+                    line[x*4] = (src[x*4]*a*257 + 128) >> 8;
+                    line[x*4 + 1] = (src[x*4 + 1]*a*257 + 128) >> 8;
+                    line[x*4 + 2] = (src[x*4 + 2]*a*257 + 128) >> 8;
+                }
+                else
+                {
+                    line[x*4] = (unsigned int)src[x*4] << 8;
+                    line[x*4 + 1] = (unsigned int)src[x*4 + 1] << 8;
+                    line[x*4 + 2] = (unsigned int)src[x*4 + 2] << 8;
+                }
+
+                line[x*4 + 3] = a << 8;
+            }
+
+            for (int i = 0; i < pass->iterations; i++)
+            {
+                BoxBlurLine(line, temp, width, pass->radius, reciprocals);
+
+                unsigned int *swap = line;
+                line = temp;
+                temp = swap;
+            }
+
+            // Store row as RGBA8 into block, reversing alpha premultiply if required
+            x = 0;
+        #if defined(RTEXTURES_SIMD_SSE2)
+            for (; x < width; x++)
+            {
+                __m128i value = _mm_srli_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i *)(line + x*4)), _mm_set1_epi32(128)), 8);
+
+                if (pass->alphaMode == 2)
+                {
+                    float scale = alphaReciprocals[_mm_cvtsi128_si32(_mm_srli_si128(value, 12)) & 0xff];
+                    value = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(value), _mm_setr_ps(scale, scale, scale, 1.0f)));
+                }
+
+                value = _mm_packs_epi32(value, value);
+                block[k*width + x] = (unsigned int)_mm_cvtsi128_si32(_mm_packus_epi16(value, value));
+            }
+        #endif
+            for (; x < width; x++)
+            {
+                unsigned int r = (line[x*4] + 128) >> 8;
+                unsigned int g = (line[x*4 + 1] + 128) >> 8;
+                unsigned int b = (line[x*4 + 2] + 128) >> 8;
+                unsigned int a = (line[x*4 + 3] + 128) >> 8;
+
+                if (a > 255) a = 255;
+
+                if (pass->alphaMode == 2)
+                {
+                    r = (unsigned int)((float)r*alphaReciprocals[a] + 0.5f);
+                    g = (unsigned int)((float)g*alphaReciprocals[a] + 0.5f);
+                    b = (unsigned int)((float)b*alphaReciprocals[a] + 0.5f);
+                }
+
+                unsigned char *pixel = (unsigned char *)&block[k*width + x];
+                pixel[0] = (r > 255)? 255 : (unsigned char)r;
+                pixel[1] = (g > 255)? 255 : (unsigned char)g;
+                pixel[2] = (b > 255)? 255 : (unsigned char)b;
+                pixel[3] = (unsigned char)a;
+            }
+        }
+
+        // Store block transposed: column x of the block goes to destination row x
+        for (int x = 0; x < width; x++)
+        {
+            unsigned int *dst = (unsigned int *)pass->dst + (size_t)x*height + y0;
+            for (int k = 0; k < rows; k++) dst[k] = block[k*width + x];
+        }
+    }
+
+    RL_FREE(line);
+    RL_FREE(temp);
+    RL_FREE(block);
+    RL_FREE(reciprocals);
+}
+
+// Convert a range of mapped image tiles into destination format (ParallelFor() task)
+static void MappedImageConvertTiles(int start, int end, void *userData)
+{
+    MappedImagePass *pass = (MappedImagePass *)userData;
+    int columns = (pass->width + MAPPED_IMAGE_TILE_SIZE - 1)/MAPPED_IMAGE_TILE_SIZE;
+
+    for (int i = start; i < end; i++)
+    {
+        int x = (i%columns)*MAPPED_IMAGE_TILE_SIZE;
+        int y = (i/columns)*MAPPED_IMAGE_TILE_SIZE;
+        int width = ((x + MAPPED_IMAGE_TILE_SIZE) > pass->width)? (pass->width - x) : MAPPED_IMAGE_TILE_SIZE;
+        int height = ((y + MAPPED_IMAGE_TILE_SIZE) > pass->height)? (pass->height - y) : MAPPED_IMAGE_TILE_SIZE;
+
+        Image tile = LoadImageRegion(pass->src, (Rectangle){ (float)(pass->x + x), (float)(pass->y + y), (float)width, (float)height });
+        ImageFormat(&tile, pass->dst.format);
+        UpdateImageRegion(pass->dst, (Rectangle){ (float)x, (float)y, (float)width, (float)height }, tile.data);
+        UnloadImage(tile);
+    }
+}
+
+// Resize a range of mapped image bands of rows (ParallelFor() task)
+static void MappedImageResizeBands(int start, int end, void *userData)
+{
+    MappedImagePass *pass = (MappedImagePass *)userData;
+
+    int channels = 4;
+    stbir_datatype type = STBIR_TYPE_UINT8;
+
+    switch (pass->src.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: channels = 1; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: channels = 3; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: channels = 4; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: channels = 1; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: channels = 3; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: channels = 4; type = STBIR_TYPE_HALF_FLOAT; break;
+        default: break;
+    }
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, pass->src.format);
+
+    // Float channels are filtered independently, alpha weighting is not clamped for them
+    stbir_pixel_layout layout = (stbir_pixel_layout)channels;
+    if ((type != STBIR_TYPE_UINT8) && (channels == 4)) layout = STBIR_4CHANNEL;
+
+    for (int i = start; i < end; i++)
+    {
+        int y = i*MAPPED_IMAGE_TILE_SIZE;
+        int height = ((y + MAPPED_IMAGE_TILE_SIZE) > pass->height)? (pass->height - y) : MAPPED_IMAGE_TILE_SIZE;
+
+        // NOTE: Output pointer refers to full destination image, subrect sampling matches a full image resize
+        STBIR_RESIZE resize = { 0 };
+        stbir_resize_init(&resize, pass->src.data, pass->src.width, pass->src.height, pass->src.width*bytesPerPixel,
+            pass->dst.data, pass->dst.width, pass->dst.height, pass->dst.width*bytesPerPixel, layout, type);
+        stbir_set_pixel_subrect(&resize, 0, y, pass->dst.width, height);
+        stbir_resize_extended(&resize);
+    }
+}
+
+// Get resize source samples for destination coordinate, using fixed point stepping
+// NOTE: Returns source samples pair (nearest, bilinear) or source range [first, second) (box),
+// second sample weight is returned in 16 bit fixed point (bilinear)
+static int GetResizeSamples(int coord, int srcSize, int dstSize, int filter, int *first, int *second)
+{
+    int weight = 0;
+
+    switch (filter)
+    {
+        case RESIZE_FILTER_NEAREST:
+        {
+            // NOTE: Step is rounded up to account for an early rounding problem
+            long long step = ((long long)srcSize << 16)/dstSize + 1;
+
+            *first = (int)(((long long)coord*step) >> 16);
+            if (*first > (srcSize - 1)) *first = srcSize - 1;
+            *second = *first;
+        } break;
+        case RESIZE_FILTER_BILINEAR:
+        {
+            // Pixel centers are aligned: src = (dst + 0.5)*srcSize/dstSize - 0.5
+            long long position = (((long long)(2*coord + 1)*srcSize - dstSize) << 16)/(2*dstSize);
+            if (position < 0) position = 0;
+
+            *first = (int)(position >> 16);
+            weight = (int)(position & 0xffff);
+
+            if (*first >= (srcSize - 1)) { *first = srcSize - 1; weight = 0; }
+            *second = (*first < (srcSize - 1))? (*first + 1) : *first;
+        } break;
+        case RESIZE_FILTER_BOX:
+        {
+            *first = (int)((long long)coord*srcSize/dstSize);
+            *second = (int)((long long)(coord + 1)*srcSize/dstSize);
+            if (*second <= *first) *second = *first + 1;
+        } break;
+        default: *first = *second = 0; break;
+    }
+
+    return weight;
+}
+
+// Resize a range of destination image rows (ParallelFor() task)
+static void ResizeImageRows(int start, int end, void *userData)
+{
+    ResizePass *pass = (ResizePass *)userData;
+    int srcRowSize = pass->srcWidth*pass->bytesPerPixel;
+    int dstRowSize = pass->dstWidth*pass->bytesPerPixel;
+    int srcCount = pass->srcWidth*pass->channels;
+    int dstCount = pass->dstWidth*pass->channels;
+
+    switch (pass->filter)
+    {
+        case RESIZE_FILTER_NEAREST:
+        {
+            int previous = -1;
+
+            for (int y = start; y < end; y++)
+            {
+                int sy = 0, sy1 = 0;
+                GetResizeSamples(y, pass->srcHeight, pass->dstHeight, RESIZE_FILTER_NEAREST, &sy, &sy1);
+
+                const unsigned char *src = pass->src + (size_t)sy*srcRowSize;
+                unsigned char *dst = pass->dst + (size_t)y*dstRowSize;
+
+                // Upscaled rows repeat previous row
+                if (sy == previous) { memcpy(dst, dst - dstRowSize, dstRowSize); continue; }
+                previous = sy;
+
+                switch (pass->bytesPerPixel)
+                {
+                    case 1: for (int x = 0; x < pass->dstWidth; x++) dst[x] = src[pass->columns[2*x]]; break;
+                    case 2: for (int x = 0; x < pass->dstWidth; x++) ((unsigned short *)dst)[x] = ((const unsigned short *)src)[pass->columns[2*x]]; break;
+                    case 4: for (int x = 0; x < pass->dstWidth; x++) ((unsigned int *)dst)[x] = ((const unsigned int *)src)[pass->columns[2*x]]; break;
+                    case 8: for (int x = 0; x < pass->dstWidth; x++) ((unsigned long long *)dst)[x] = ((const unsigned long long *)src)[pass->columns[2*x]]; break;
+                    default:
+                    {
+                        for (int x = 0; x < pass->dstWidth; x++) memcpy(dst + x*pass->bytesPerPixel, src + pass->columns[2*x]*pass->bytesPerPixel, pass->bytesPerPixel);
+                    } break;
+                }
+            }
+        } break;
+        case RESIZE_FILTER_BILINEAR:
+        {
+            // Horizontally resized source rows are cached, upscaled destination rows share them
+            int rows[2] = { -1, -1 };
+
+            if (pass->type == 0)
+            {
+                unsigned short *buffers[2] = { (unsigned short *)RL_MALLOC(dstCount*sizeof(unsigned short)), (unsigned short *)RL_MALLOC(dstCount*sizeof(unsigned short)) };
+
+                for (int y = start; y < end; y++)
+                {
+                    int sy[2] = { 0 };
+                    int weight = GetResizeSamples(y, pass->srcHeight, pass->dstHeight, RESIZE_FILTER_BILINEAR, &sy[0], &sy[1]);
+
+                    if ((sy[0] == rows[1]) && (sy[0] != rows[0]))
+                    {
+                        unsigned short *buffer = buffers[0]; buffers[0] = buffers[1]; buffers[1] = buffer;
+                        rows[1] = rows[0]; rows[0] = sy[0];
+                    }
+
+                    for (int i = 0; i < 2; i++)
+                    {
+                        if (sy[i] != rows[i]) ResizeRowHorizontal(pass->src + (size_t)sy[i]*srcRowSize, buffers[i], pass);
+                        rows[i] = sy[i];
+                    }
+
+                    BlendResizeRows(buffers[0], buffers[1], (weight + 256) >> 9, pass->dst + (size_t)y*dstRowSize, dstCount);
+                }
+
+                RL_FREE(buffers[0]);
+                RL_FREE(buffers[1]);
+            }
+            else
+            {
+                float *buffers[2] = { (float *)RL_MALLOC(dstCount*sizeof(float)), (float *)RL_MALLOC(dstCount*sizeof(float)) };
+                float *srcRow = (pass->type == 1)? (float *)RL_MALLOC(srcCount*sizeof(float)) : NULL;
+                float *dstRow = (pass->type == 1)? (float *)RL_MALLOC(dstCount*sizeof(float)) : NULL;
+
+                for (int y = start; y < end; y++)
+                {
+                    int sy[2] = { 0 };
+                    int weight = GetResizeSamples(y, pass->srcHeight, pass->dstHeight, RESIZE_FILTER_BILINEAR, &sy[0], &sy[1]);
+
+                    if ((sy[0] == rows[1]) && (sy[0] != rows[0]))
+                    {
+                        float *buffer = buffers[0]; buffers[0] = buffers[1]; buffers[1] = buffer;
+                        rows[1] = rows[0]; rows[0] = sy[0];
+                    }
+
+                    for (int i = 0; i < 2; i++)
+                    {
+                        if (sy[i] != rows[i])
+                        {
+                            const unsigned char *src = pass->src + (size_t)sy[i]*srcRowSize;
+
+                            if (pass->type == 1)
+                            {
+                                HalfToFloatArray((const unsigned short *)src, srcRow, srcCount);
+                                ResizeRowHorizontalFloat(srcRow, buffers[i], pass);
+                            }
+                            else ResizeRowHorizontalFloat((const float *)src, buffers[i], pass);
+                        }
+                        rows[i] = sy[i];
+                    }
+
+                    unsigned char *dst = pass->dst + (size_t)y*dstRowSize;
+
+                    if (pass->type == 1)
+                    {
+                        BlendResizeRowsFloat(buffers[0], buffers[1], weight/65536.0f, dstRow, dstCount);
+                        FloatToHalfArray(dstRow, (unsigned short *)dst, dstCount);
+                    }
+                    else BlendResizeRowsFloat(buffers[0], buffers[1], weight/65536.0f, (float *)dst, dstCount);
+                }
+
+                RL_FREE(buffers[0]);
+                RL_FREE(buffers[1]);
+                RL_FREE(srcRow);
+                RL_FREE(dstRow);
+            }
+        } break;
+        case RESIZE_FILTER_BOX:
+        {
+            // Source rows are accumulated per column, then destination pixels average their columns range
+            const int channels = pass->channels;
+
+            if (pass->type == 0)
+            {
+                unsigned int *sums = (unsigned int *)RL_MALLOC(srcCount*sizeof(unsigned int));
+
+                for (int y = start; y < end; y++)
+                {
+                    int sy0 = 0, sy1 = 0;
+                    GetResizeSamples(y, pass->srcHeight, pass->dstHeight, RESIZE_FILTER_BOX, &sy0, &sy1);
+
+                    memset(sums, 0, srcCount*sizeof(unsigned int));
+                    for (int sy = sy0; sy < sy1; sy++) AccumulateResizeRow(pass->src + (size_t)sy*srcRowSize, sums, srcCount);
+
+                    unsigned char *dst = pass->dst + (size_t)y*dstRowSize;
+
+                    for (int x = 0; x < pass->dstWidth; x++)
+                    {
+                        int sx0 = pass->columns[2*x];
+                        int sx1 = pass->columns[2*x + 1];
+                        unsigned int count = (unsigned int)((sx1 - sx0)*(sy1 - sy0));
+
+                        for (int c = 0; c < channels; c++)
+                        {
+                            unsigned int sum = 0;
+                            for (int sx = sx0; sx < sx1; sx++) sum += sums[sx*channels + c];
+
+                            dst[x*channels + c] = (unsigned char)((sum + count/2)/count);
+                        }
+                    }
+                }
+
+                RL_FREE(sums);
+            }
+            else
+            {
+                float *sums = (float *)RL_MALLOC(srcCount*sizeof(float));
+                float *srcRow = (pass->type == 1)? (float *)RL_MALLOC(srcCount*sizeof(float)) : NULL;
+                float *dstRow = (float *)RL_MALLOC(dstCount*sizeof(float));
+
+                for (int y = start; y < end; y++)
+                {
+                    int sy0 = 0, sy1 = 0;
+                    GetResizeSamples(y, pass->srcHeight, pass->dstHeight, RESIZE_FILTER_BOX, &sy0, &sy1);
+
+                    memset(sums, 0, srcCount*sizeof(float));
+                    for (int sy = sy0; sy < sy1; sy++)
+                    {
+                        const unsigned char *src = pass->src + (size_t)sy*srcRowSize;
+
+                        if (pass->type == 1)
+                        {
+                            HalfToFloatArray((const unsigned short *)src, srcRow, srcCount);
+                            AccumulateLine(sums, srcRow, 1.0f, srcCount);
+                        }
+                        else AccumulateLine(sums, (const float *)src, 1.0f, srcCount);
+                    }
+
+                    for (int x = 0; x < pass->dstWidth; x++)
+                    {
+                        int sx0 = pass->columns[2*x];
+                        int sx1 = pass->columns[2*x + 1];
+                        float scale = 1.0f/(float)((sx1 - sx0)*(sy1 - sy0));
+
+                        for (int c = 0; c < channels; c++)
+                        {
+                            float sum = 0.0f;
+                            for (int sx = sx0; sx < sx1; sx++) sum += sums[sx*channels + c];
+
+                            dstRow[x*channels + c] = sum*scale;
+                        }
+                    }
+
+                    unsigned char *dst = pass->dst + (size_t)y*dstRowSize;
+
+                    if (pass->type == 1) FloatToHalfArray(dstRow, (unsigned short *)dst, dstCount);
+                    else memcpy(dst, dstRow, dstCount*sizeof(float));
+                }
+
+                RL_FREE(sums);
+                RL_FREE(srcRow);
+                RL_FREE(dstRow);
+            }
+        } break;
+        case RESIZE_FILTER_BICUBIC:
+        {
+            // NOTE: Output subrect sampling matches a full image resize
+            stbir_datatype type = (pass->type == 0)? STBIR_TYPE_UINT8 : ((pass->type == 1)? STBIR_TYPE_HALF_FLOAT : STBIR_TYPE_FLOAT);
+
+            // Float channels are filtered independently, alpha weighting is not clamped and
+            // divides colors by near zero alpha, out of range values are produced
+            stbir_pixel_layout layout = (stbir_pixel_layout)pass->channels;
+            if ((pass->type != 0) && (pass->channels == 4)) layout = STBIR_4CHANNEL;
+
+            STBIR_RESIZE resize = { 0 };
+            stbir_resize_init(&resize, pass->src, pass->srcWidth, pass->srcHeight, srcRowSize,
+                pass->dst, pass->dstWidth, pass->dstHeight, dstRowSize, layout, type);
+            stbir_set_pixel_subrect(&resize, 0, start, pass->dstWidth, end - start);
+            stbir_resize_extended(&resize);
+        } break;
+        default: break;
+    }
+}
+
+// Resize 8 bit row horizontally (bilinear), 7 bit fixed point weights
+// NOTE: Output values are scaled by 128, vertical blending applies the remaining scale
+static void ResizeRowHorizontal(const unsigned char *src, unsigned short *dst, const ResizePass *pass)
+{
+    const int channels = pass->channels;
+
+    for (int x = 0; x < pass->dstWidth; x++)
+    {
+        const unsigned char *p0 = src + pass->columns[2*x]*channels;
+        const unsigned char *p1 = src + pass->columns[2*x + 1]*channels;
+        int weight = (pass->weights[x] + 256) >> 9;
+
+        for (int c = 0; c < channels; c++) dst[x*channels + c] = (unsigned short)(p0[c]*(128 - weight) + p1[c]*weight);
+    }
+}
+
+// Resize float row horizontally (bilinear)
+static void ResizeRowHorizontalFloat(const float *src, float *dst, const ResizePass *pass)
+{
+    const int channels = pass->channels;
+
+    for (int x = 0; x < pass->dstWidth; x++)
+    {
+        const float *p0 = src + pass->columns[2*x]*channels;
+        const float *p1 = src + pass->columns[2*x + 1]*channels;
+        float weight = pass->weights[x]/65536.0f;
+
+        for (int c = 0; c < channels; c++) dst[x*channels + c] = p0[c] + (p1[c] - p0[c])*weight;
+    }
+}
+
+// Blend horizontally resized 8 bit rows (bilinear), 7 bit fixed point weight
+static void BlendResizeRows(const unsigned short *row0, const unsigned short *row1, int weight, unsigned char *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    // Interleaved rows values multiplied by weights pair and added: row0*(128 - weight) + row1*weight
+    const __m128i weights = _mm_set1_epi32(((unsigned int)weight << 16) | (unsigned int)(128 - weight));
+    const __m128i rounding = _mm_set1_epi32(1 << 13);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(row0 + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(row1 + i));
+        __m128i lo = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), weights), rounding), 14);
+        __m128i hi = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), weights), rounding), 14);
+        __m128i result = _mm_packs_epi32(lo, hi);
+
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(result, result));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    const uint16x4_t weight0 = vdup_n_u16((unsigned short)(128 - weight));
+    const uint16x4_t weight1 = vdup_n_u16((unsigned short)weight);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint16x8_t a = vld1q_u16(row0 + i);
+        uint16x8_t b = vld1q_u16(row1 + i);
+        uint32x4_t lo = vmlal_u16(vmull_u16(vget_low_u16(a), weight0), vget_low_u16(b), weight1);
+        uint32x4_t hi = vmlal_u16(vmull_u16(vget_high_u16(a), weight0), vget_high_u16(b), weight1);
+
+        vst1_u8(dst + i, vqmovn_u16(vcombine_u16(vrshrn_n_u32(lo, 14), vrshrn_n_u32(hi, 14))));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = (unsigned char)((row0[i]*(128 - weight) + row1[i]*weight + (1 << 13)) >> 14);
+}
+
+// Blend horizontally resized float rows (bilinear)
+static void BlendResizeRowsFloat(const float *row0, const float *row1, float weight, float *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(row0 + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(row1 + i), a), w)));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t a = vld1q_f32(row0 + i);
+        vst1q_f32(dst + i, vmlaq_n_f32(a, vsubq_f32(vld1q_f32(row1 + i), a), weight));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = row0[i] + (row1[i] - row0[i])*weight;
+}
+
+// Accumulate 8 bit row into sums (box)
+static void AccumulateResizeRow(const unsigned char *src, unsigned int *sums, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i values = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo = _mm_unpacklo_epi8(values, zero);
+        __m128i hi = _mm_unpackhi_epi8(values, zero);
+
+        _mm_storeu_si128((__m128i *)(sums + i), _mm_add_epi32(_mm_loadu_si128((const __m128i *)(sums + i)), _mm_unpacklo_epi16(lo, zero)));
+        _mm_storeu_si128((__m128i *)(sums + i + 4), _mm_add_epi32(_mm_loadu_si128((const __m128i *)(sums + i + 4)), _mm_unpackhi_epi16(lo, zero)));
+        _mm_storeu_si128((__m128i *)(sums + i + 8), _mm_add_epi32(_mm_loadu_si128((const __m128i *)(sums + i + 8)), _mm_unpacklo_epi16(hi, zero)));
+        _mm_storeu_si128((__m128i *)(sums + i + 12), _mm_add_epi32(_mm_loadu_si128((const __m128i *)(sums + i + 12)), _mm_unpackhi_epi16(hi, zero)));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t values = vld1q_u8(src + i);
+        uint16x8_t lo = vmovl_u8(vget_low_u8(values));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(values));
+
+        vst1q_u32(sums + i, vaddw_u16(vld1q_u32(sums + i), vget_low_u16(lo)));
+        vst1q_u32(sums + i + 4, vaddw_u16(vld1q_u32(sums + i + 4), vget_high_u16(lo)));
+        vst1q_u32(sums + i + 8, vaddw_u16(vld1q_u32(sums + i + 8), vget_low_u16(hi)));
+        vst1q_u32(sums + i + 12, vaddw_u16(vld1q_u32(sums + i + 12), vget_high_u16(hi)));
+    }
+#endif
+
+    for (; i < count; i++) sums[i] += src[i];
+}
+
+// Flip a range of image rows in place (ParallelFor() task)
+// NOTE: Vertical and both axis flips process pairs of rows, range refers to top rows
+static void FlipImageRows(int start, int end, void *userData)
+{
+    TransformPass *pass = (TransformPass *)userData;
+    int rowSize = pass->width*pass->bytesPerPixel;
+
+    if (pass->mode == 0)
+    {
+        for (int y = start; y < end; y++) ReverseImageRow(pass->dst + (size_t)y*rowSize, pass->width, pass->bytesPerPixel);
+        return;
+    }
+
+    unsigned char *temp = (unsigned char *)RL_MALLOC(rowSize);
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *top = pass->dst + (size_t)y*rowSize;
+        unsigned char *bottom = pass->dst + (size_t)(pass->height - 1 - y)*rowSize;
+
+        if (top != bottom)
+        {
+            memcpy(temp, top, rowSize);
+            memcpy(top, bottom, rowSize);
+            memcpy(bottom, temp, rowSize);
+
+            if (pass->mode == 2) ReverseImageRow(bottom, pass->width, pass->bytesPerPixel);
+        }
+
+        if (pass->mode == 2) ReverseImageRow(top, pass->width, pass->bytesPerPixel);
+    }
+
+    RL_FREE(temp);
+}
+
+// Reverse image row pixels in place
+// NOTE: Pixel blocks from both ends are loaded, reversed and stored swapped
+static void ReverseImageRow(unsigned char *row, int width, int bytesPerPixel)
+{
+    int left = 0;
+    int right = width - 1;
+
+#if defined(RTEXTURES_SIMD_SSE2) || defined(RTEXTURES_SIMD_NEON)
+    // Pixels per 16 bytes block, only for power of two pixel sizes
+    int blockPixels = ((bytesPerPixel == 1) || (bytesPerPixel == 2) || (bytesPerPixel == 4) || (bytesPerPixel == 8))? 16/bytesPerPixel : 0;
+    #if defined(RTEXTURES_SIMD_SSE2) && !defined(RTEXTURES_SIMD_SSSE3)
+    if (bytesPerPixel == 1) blockPixels = 0;    // Bytes shuffle requires SSSE3
+    #endif
+
+    while ((blockPixels > 0) && ((right - left + 1) >= 2*blockPixels))
+    {
+        unsigned char *leftBlock = row + left*bytesPerPixel;
+        unsigned char *rightBlock = row + (right - blockPixels + 1)*bytesPerPixel;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        __m128i a = _mm_loadu_si128((const __m128i *)leftBlock);
+        __m128i b = _mm_loadu_si128((const __m128i *)rightBlock);
+
+        switch (bytesPerPixel)
+        {
+        #if defined(RTEXTURES_SIMD_SSSE3)
+            case 1:
+            {
+                const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+                a = _mm_shuffle_epi8(a, reverse);
+                b = _mm_shuffle_epi8(b, reverse);
+            } break;
+        #endif
+            case 2:
+            {
+                a = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0x1b), 0x1b), 0x4e);
+                b = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(b, 0x1b), 0x1b), 0x4e);
+            } break;
+            case 4: a = _mm_shuffle_epi32(a, 0x1b); b = _mm_shuffle_epi32(b, 0x1b); break;
+            case 8: a = _mm_shuffle_epi32(a, 0x4e); b = _mm_shuffle_epi32(b, 0x4e); break;
+            default: break;
+        }
+
+        _mm_storeu_si128((__m128i *)leftBlock, b);
+        _mm_storeu_si128((__m128i *)rightBlock, a);
+    #elif defined(RTEXTURES_SIMD_NEON)
+        uint8x16_t a = vld1q_u8(leftBlock);
+        uint8x16_t b = vld1q_u8(rightBlock);
+
+        switch (bytesPerPixel)
+        {
+            case 1: a = vrev64q_u8(a); b = vrev64q_u8(b); break;
+            case 2: a = vreinterpretq_u8_u16(vrev64q_u16(vreinterpretq_u16_u8(a))); b = vreinterpretq_u8_u16(vrev64q_u16(vreinterpretq_u16_u8(b))); break;
+            case 4: a = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(a))); b = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(b))); break;
+            default: break;
+        }
+
+        // Reverse 64 bit halves (pixels within halves reversed above)
+        vst1q_u8(leftBlock, vcombine_u8(vget_high_u8(b), vget_low_u8(b)));
+        vst1q_u8(rightBlock, vcombine_u8(vget_high_u8(a), vget_low_u8(a)));
+    #endif
+
+        left += blockPixels;
+        right -= blockPixels;
+    }
+#endif
+
+    switch (bytesPerPixel)
+    {
+        case 1: for (; left < right; left++, right--) { unsigned char temp = row[left]; row[left] = row[right]; row[right] = temp; } break;
+        case 2:
+        {
+            unsigned short *pixels = (unsigned short *)row;
+            for (; left < right; left++, right--) { unsigned short temp = pixels[left]; pixels[left] = pixels[right]; pixels[right] = temp; }
+        } break;
+        case 4:
+        {
+            unsigned int *pixels = (unsigned int *)row;
+            for (; left < right; left++, right--) { unsigned int temp = pixels[left]; pixels[left] = pixels[right]; pixels[right] = temp; }
+        } break;
+        default:
+        {
+            unsigned char temp[16] = { 0 };
+            for (; left < right; left++, right--)
+            {
+                memcpy(temp, row + left*bytesPerPixel, bytesPerPixel);
+                memcpy(row + left*bytesPerPixel, row + right*bytesPerPixel, bytesPerPixel);
+                memcpy(row + right*bytesPerPixel, temp, bytesPerPixel);
+            }
+        } break;
+    }
+}
+
+// Rotate 90 degrees a range of source tiles bands (ParallelFor() task)
+// NOTE: Source tiles are transposed into destination, every source column is written as a contiguous destination row segment
+static void RotateImageTiles(int start, int end, void *userData)
+{
+    TransformPass *pass = (TransformPass *)userData;
+    const int bpp = pass->bytesPerPixel;
+    const int width = pass->width;
+    const int height = pass->height;
+    const bool clockwise = (pass->mode == 0);
+
+    for (int band = start; band < end; band++)
+    {
+        int y0 = band*TRANSPOSE_TILE_SIZE;
+        int y1 = ((y0 + TRANSPOSE_TILE_SIZE) < height)? (y0 + TRANSPOSE_TILE_SIZE) : height;
+
+        for (int x0 = 0; x0 < width; x0 += TRANSPOSE_TILE_SIZE)
+        {
+            int x1 = ((x0 + TRANSPOSE_TILE_SIZE) < width)? (x0 + TRANSPOSE_TILE_SIZE) : width;
+
+            for (int x = x0; x < x1; x++)
+            {
+                // Destination row for source column, destination pixels stepped by source rows
+                size_t dstRow = (size_t)(clockwise? x : (width - 1 - x))*height;
+                int dstStep = clockwise? -1 : 1;
+                int dstX = clockwise? (height - 1 - y0) : y0;
+
+                switch (bpp)
+                {
+                    case 1: for (int y = y0; y < y1; y++, dstX += dstStep) pass->dst[dstRow + dstX] = pass->src[(size_t)y*width + x]; break;
+                    case 2: for (int y = y0; y < y1; y++, dstX += dstStep) ((unsigned short *)pass->dst)[dstRow + dstX] = ((const unsigned short *)pass->src)[(size_t)y*width + x]; break;
+                    case 4: for (int y = y0; y < y1; y++, dstX += dstStep) ((unsigned int *)pass->dst)[dstRow + dstX] = ((const unsigned int *)pass->src)[(size_t)y*width + x]; break;
+                    case 8: for (int y = y0; y < y1; y++, dstX += dstStep) ((unsigned long long *)pass->dst)[dstRow + dstX] = ((const unsigned long long *)pass->src)[(size_t)y*width + x]; break;
+                    default:
+                    {
+                        for (int y = y0; y < y1; y++, dstX += dstStep) memcpy(pass->dst + (dstRow + dstX)*bpp, pass->src + ((size_t)y*width + x)*bpp, bpp);
+                    } break;
+                }
+            }
+        }
+    }
+}
+
+// Rotate a range of destination rows by arbitrary angle (ParallelFor() task)
+// NOTE: Source position is stepped incrementally in 16.16 fixed point, pixels outside source are cleared,
+// destination is processed in tiles so source pixels read along rotated rows stay in cache
+static void RotateImageRows(int start, int end, void *userData)
+{
+    TransformPass *pass = (TransformPass *)userData;
+    const int bpp = pass->bytesPerPixel;
+    const long long maxX = (long long)pass->width << 16;
+    const long long maxY = (long long)pass->height << 16;
+
+    for (int tileY = start; tileY < end; tileY += TRANSPOSE_TILE_SIZE)
+    for (int tileX = 0; tileX < pass->dstWidth; tileX += TRANSPOSE_TILE_SIZE)
+    for (int y = tileY; (y < (tileY + TRANSPOSE_TILE_SIZE)) && (y < end); y++)
+    {
+        // Tile row origin: oldX = startX + x*cos + y*sin, oldY = startY + y*cos - x*sin
+        long long sx = pass->startX + (long long)tileX*pass->stepX + (long long)y*pass->stepY;
+        long long sy = pass->startY + (long long)y*pass->stepX - (long long)tileX*pass->stepY;
+        unsigned char *dst = pass->dst + ((size_t)y*pass->dstWidth + tileX)*bpp;
+        int tileEnd = ((tileX + TRANSPOSE_TILE_SIZE) < pass->dstWidth)? (tileX + TRANSPOSE_TILE_SIZE) : pass->dstWidth;
+
+        for (int x = tileX; x < tileEnd; x++, sx += pass->stepX, sy -= pass->stepY, dst += bpp)
+        {
+            if ((sx < 0) || (sx >= maxX) || (sy < 0) || (sy >= maxY)) { memset(dst, 0, bpp); continue; }
+
+            int x1 = (int)(sx >> 16);
+            int y1 = (int)(sy >> 16);
+            int x2 = (x1 < (pass->width - 1))? (x1 + 1) : x1;
+            int y2 = (y1 < (pass->height - 1))? (y1 + 1) : y1;
+
+            if (pass->mode == 0)
+            {
+                // 8 bit weights, channels interpolated with integer arithmetic
+                const unsigned char *p11 = pass->src + ((size_t)y1*pass->width + x1)*bpp;
+                const unsigned char *p21 = pass->src + ((size_t)y1*pass->width + x2)*bpp;
+                const unsigned char *p12 = pass->src + ((size_t)y2*pass->width + x1)*bpp;
+                const unsigned char *p22 = pass->src + ((size_t)y2*pass->width + x2)*bpp;
+                int px = (int)((sx >> 8) & 0xff);
+                int py = (int)((sy >> 8) & 0xff);
+
+                for (int i = 0; i < bpp; i++)
+                {
+                    int top = p11[i]*(256 - px) + p21[i]*px;
+                    int bottom = p12[i]*(256 - px) + p22[i]*px;
+
+                    dst[i] = (unsigned char)((top*(256 - py) + bottom*py + (1 << 15)) >> 16);
+                }
+            }
+            else
+            {
+                const int channels = bpp/(int)sizeof(float);
+                const float *p11 = (const float *)pass->src + ((size_t)y1*pass->width + x1)*channels;
+                const float *p21 = (const float *)pass->src + ((size_t)y1*pass->width + x2)*channels;
+                const float *p12 = (const float *)pass->src + ((size_t)y2*pass->width + x1)*channels;
+                const float *p22 = (const float *)pass->src + ((size_t)y2*pass->width + x2)*channels;
+                float px = (sx & 0xffff)/65536.0f;
+                float py = (sy & 0xffff)/65536.0f;
+
+                for (int i = 0; i < channels; i++)
+                {
+                    float top = p11[i] + (p21[i] - p11[i])*px;
+                    float bottom = p12[i] + (p22[i] - p12[i])*px;
+
+                    ((float *)dst)[i] = top + (bottom - top)*py;
+                }
+            }
+        }
+    }
+}
+
+// Generate image rows in parallel, image data allocated for pass size
+static Image GenImageFromPass(GenImagePass *pass)
+{
+    Image image = {
+        .width = pass->width,
+        .height = pass->height,
+        .format = pass->floatOutput? PIXELFORMAT_UNCOMPRESSED_R32 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
+
+    image.data = LoadImageBuffer(GetPixelDataSize(image.width, image.height, image.format));
+    pass->data = image.data;
+
+    if ((image.data != NULL) && (pass->width > 0) && (pass->height > 0))
+    {
+        // Noise pixels are expensive, a smaller number of rows are generated by every worker
+        int pixelCost = (pass->generator == GEN_IMAGE_NOISE)? ((pass->octaves > 1)? pass->octaves : 1)*8 : 1;
+        int minRows = GENERATION_BATCH_PIXELS/(pass->width*pixelCost);
+
+        ParallelFor(pass->height, (minRows > 1)? minRows : 1, GenImageRows, pass);
+    }
+
+    return image;
+}
+
+// Generate a range of image rows (ParallelFor() task)
+static void GenImageRows(int start, int end, void *userData)
+{
+    GenImagePass *pass = (GenImagePass *)userData;
+    const int width = pass->width;
+    const Color c0 = pass->colors[0];
+    const Color c1 = pass->colors[1];
+    float *buffers = NULL;
+
+    if (pass->generator == GEN_IMAGE_NOISE) buffers = (float *)RL_MALLOC(4*width*sizeof(float));
+
+    for (int y = start; y < end; y++)
+    {
+        Color *row = (Color *)pass->data + (size_t)y*width;
+
+        switch (pass->generator)
+        {
+            case GEN_IMAGE_COLOR: for (int x = 0; x < width; x++) row[x] = c0; break;
+            case GEN_IMAGE_GRADIENT_LINEAR:
+            case GEN_IMAGE_GRADIENT_RADIAL:
+            case GEN_IMAGE_GRADIENT_SQUARE:
+            {
+                float dy = (float)y - pass->center[1];
+                float rowDistance = fabsf(dy)/pass->center[1];
+
+                for (int x = 0; x < width; x++)
+                {
+                    float factor = 0.0f;
+
+                    if (pass->generator == GEN_IMAGE_GRADIENT_LINEAR) factor = x*pass->direction[0] + y*pass->direction[1];
+                    else if (pass->generator == GEN_IMAGE_GRADIENT_RADIAL)
+                    {
+                        float dx = (float)x - pass->center[0];
+                        factor = (sqrtf(dx*dx + dy*dy) - pass->start)*pass->scale;
+                    }
+                    else
+                    {
+                        // Maximum of normalized distances from the center (square distance)
+                        float distance = fabsf((float)x - pass->center[0])/pass->center[0];
+                        if (rowDistance > distance) distance = rowDistance;
+
+                        // The gradient starts from the center when density is 0, and from the edge when density is 1
+                        factor = (distance - pass->start)*pass->scale;
+                    }
+
+                    // Clamp the factor between 0 and 1
+                    factor = (factor > 1.0f)? 1.0f : factor;
+                    factor = (factor < 0.0f)? 0.0f : factor;
+
+                    row[x].r = (int)((float)c1.r*factor + (float)c0.r*(1.0f - factor));
+                    row[x].g = (int)((float)c1.g*factor + (float)c0.g*(1.0f - factor));
+                    row[x].b = (int)((float)c1.b*factor + (float)c0.b*(1.0f - factor));
+                    row[x].a = (int)((float)c1.a*factor + (float)c0.a*(1.0f - factor));
+                }
+            } break;
+            case GEN_IMAGE_CHECKED:
+            {
+                // Row filled by spans of checks
+                int check = (y/pass->checks[1])%2;
+
+                for (int x = 0; x < width; x += pass->checks[0], check ^= 1)
+                {
+                    int spanEnd = ((x + pass->checks[0]) < width)? (x + pass->checks[0]) : width;
+                    Color color = (check == 0)? c0 : c1;
+
+                    for (int i = x; i < spanEnd; i++) row[i] = color;
+                }
+            } break;
+            case GEN_IMAGE_WHITE_NOISE:
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    // Pixel index hashed with seed (lowbias32 integer hash)
+                    unsigned int hash = (unsigned int)(y*width + x) ^ pass->seed;
+                    hash ^= hash >> 16; hash *= 0x7feb352dU;
+                    hash ^= hash >> 15; hash *= 0x846ca68bU;
+                    hash ^= hash >> 16;
+
+                    row[x] = ((hash%100) < pass->threshold)? WHITE : BLACK;
+                }
+            } break;
+#if defined(SUPPORT_IMAGE_GENERATION)
+            case GEN_IMAGE_NOISE:
+            {
+                float *values = buffers + 3*width;
+                GenNoiseRow(pass, y, buffers, values);
+
+                if (pass->floatOutput) memcpy((float *)pass->data + (size_t)y*width, values, width*sizeof(float));
+                else
+                {
+                    for (int x = 0; x < width; x++)
+                    {
+                        unsigned char intensity = (unsigned char)(int)(values[x]*255.0f);
+                        row[x] = (Color){ intensity, intensity, intensity, 255 };
+                    }
+                }
+            } break;
+            case GEN_IMAGE_CELLULAR:
+            {
+                const int tileSize = pass->tileSize;
+                int tileY = y/tileSize;
+
+                for (int x = 0; x < width; x++)
+                {
+                    int tileX = x/tileSize;
+
+                    // Check all adjacent tiles, minimum squared distance computed on integers
+                    int minDistance = 0x7fffffff;
+
+                    for (int j = -1; j < 2; j++)
+                    {
+                        if ((tileY + j < 0) || (tileY + j >= pass->cellsPerCol)) continue;
+
+                        for (int i = -1; i < 2; i++)
+                        {
+                            if ((tileX + i < 0) || (tileX + i >= pass->cellsPerRow)) continue;
+
+                            const int *seed = pass->cells + 2*((tileY + j)*pass->cellsPerRow + tileX + i);
+                            int dx = x - seed[0];
+                            int dy = y - seed[1];
+                            int distance = dx*dx + dy*dy;
+
+                            if (distance < minDistance) minDistance = distance;
+                        }
+                    }
+
+                    // I made this up, but it seems to give good results at all tile sizes
+                    float distance = (minDistance < 0x7fffffff)? sqrtf((float)minDistance) : 65536.0f;
+                    int intensity = (int)(distance*256.0f/tileSize);
+                    if (intensity > 255) intensity = 255;
+
+                    row[x] = (Color){ intensity, intensity, intensity, 255 };
+                }
+            } break;
+#endif
+            default: break;
+        }
+    }
+
+    RL_FREE(buffers);
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate a row of multi-octave noise values, normalized to [0..1]
+// NOTE: Octaves are evaluated for the full row, same results as stb_perlin_fbm_noise3(), stb_perlin_ridge_noise3() and
+// stb_perlin_turbulence_noise3() with z = 1.0f; seeds over 255 select additional z slices
+// Required buffers: positions, octave values and previous octave values (ridged), width floats each
+static void GenNoiseRow(const GenImagePass *pass, int y, float *buffers, float *values)
+{
+    const int width = pass->width;
+    float *positions = buffers;
+    float *octave = buffers + width;
+    float *previous = buffers + 2*width;
+    const float aspectRatio = (float)width/(float)pass->height;
+
+    float ny = (float)(y + pass->offset[1])*(pass->scale/(float)pass->height);
+    if (width <= pass->height) ny /= aspectRatio;
+
+    for (int x = 0; x < width; x++)
+    {
+        positions[x] = (float)(x + pass->offset[0])*(pass->scale/(float)width);
+
+        // Apply aspect ratio compensation to wider side
+        if (width > pass->height) positions[x] *= aspectRatio;
+
+        values[x] = 0.0f;
+    }
+
+    float z = 1.0f + (float)(pass->seed >> 8);
+    float frequency = 1.0f;
+    float amplitude = (pass->noiseType == NOISE_RIDGED)? 0.5f : 1.0f;
+
+    for (int i = 0; i < pass->octaves; i++)
+    {
+        if (i > 0) for (int x = 0; x < width; x++) positions[x] *= 2.0f;
+
+        PerlinNoiseRow(positions, ny*frequency, z*frequency, (unsigned char)(pass->seed + i), octave, width);
+
+        switch (pass->noiseType)
+        {
+            case NOISE_RIDGED:
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    float r = 1.0f - fabsf(octave[x]);
+                    r = r*r;
+                    values[x] += r*amplitude*((i == 0)? 1.0f : previous[x]);
+                    previous[x] = r;
+                }
+            } break;
+            case NOISE_TURBULENCE: for (int x = 0; x < width; x++) values[x] += fabsf(octave[x]*amplitude); break;
+            default: for (int x = 0; x < width; x++) values[x] += octave[x]*amplitude; break;
+        }
+
+        frequency *= 2.0f;
+        amplitude *= 0.5f;
+    }
+
+    for (int x = 0; x < width; x++)
+    {
+        // fBm values are normalized from [-1..1] to [0..1]
+        float value = (pass->noiseType == NOISE_FBM)? (values[x] + 1.0f)/2.0f : values[x];
+
+        values[x] = (value < 0.0f)? 0.0f : ((value > 1.0f)? 1.0f : value);
+    }
+}
+
+// Evaluate perlin noise for a row of positions (stb_perlin_noise3() compatible, no wrapping)
+// NOTE: Row positions share y and z lattice coordinates, computed once, gradients are gathered and evaluated 4 positions at a time
+static void PerlinNoiseRow(const float *positions, float y, float z, unsigned char seed, float *values, int count)
+{
+    static const float gradX[12] = { 1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0 };
+    static const float gradY[12] = { 1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 1, -1 };
+    static const float gradZ[12] = { 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1 };
+
+    #define PERLIN_FLOOR(a) (((a) < (float)(int)(a))? ((int)(a) - 1) : (int)(a))
+    #define PERLIN_EASE(a) ((((a)*6 - 15)*(a) + 10)*(a)*(a)*(a))
+    #define PERLIN_LERP(a, b, t) ((a) + ((b) - (a))*(t))
+
+    int py = PERLIN_FLOOR(y);
+    int pz = PERLIN_FLOOR(z);
+    int y0 = py & 255, y1 = (py + 1) & 255;
+    int z0 = pz & 255, z1 = (pz + 1) & 255;
+    y -= py;
+    z -= pz;
+    float v = PERLIN_EASE(y);
+    float w = PERLIN_EASE(z);
+
+    // Gradients y and z terms, for lattice corners at y/y - 1 and z/z - 1
+    float termY[2][12] = { 0 };
+    float termZ[2][12] = { 0 };
+    for (int g = 0; g < 12; g++)
+    {
+        termY[0][g] = gradY[g]*y; termY[1][g] = gradY[g]*(y - 1);
+        termZ[0][g] = gradZ[g]*z; termZ[1][g] = gradZ[g]*(z - 1);
+    }
+
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2) || defined(RTEXTURES_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        // Lattice hashing per position, gradient terms gathered for 8 corners: [corner][term][lane]
+        float terms[8][3][4];
+        float fraction[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            float x = positions[i + k];
+            int px = PERLIN_FLOOR(x);
+            int r0 = stb__perlin_randtab[(px & 255) + seed];
+            int r1 = stb__perlin_randtab[((px + 1) & 255) + seed];
+            int r[4] = { stb__perlin_randtab[r0 + y0], stb__perlin_randtab[r0 + y1], stb__perlin_randtab[r1 + y0], stb__perlin_randtab[r1 + y1] };
+
+            fraction[k] = x - px;
+
+            for (int c = 0; c < 8; c++)
+            {
+                int g = stb__perlin_randtab_grad_idx[r[c >> 1] + ((c & 1)? z1 : z0)];
+
+                terms[c][0][k] = gradX[g];
+                terms[c][1][k] = termY[(c >> 1) & 1][g];
+                terms[c][2][k] = termZ[c & 1][g];
+            }
+        }
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        __m128 x = _mm_loadu_ps(fraction);
+        __m128 x1 = _mm_sub_ps(x, _mm_set1_ps(1.0f));
+        __m128 u = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(x, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), x), _mm_set1_ps(10.0f)), x), x), x);
+        __m128 n[8];
+
+        for (int c = 0; c < 8; c++) n[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(terms[c][0]), (c < 4)? x : x1), _mm_loadu_ps(terms[c][1])), _mm_loadu_ps(terms[c][2]));
+
+        #define PERLIN_LERP4(a, b, t) _mm_add_ps((a), _mm_mul_ps(_mm_sub_ps((b), (a)), (t)))
+        __m128 vw = _mm_set1_ps(w), vv = _mm_set1_ps(v);
+        __m128 n0 = PERLIN_LERP4(PERLIN_LERP4(n[0], n[1], vw), PERLIN_LERP4(n[2], n[3], vw), vv);
+        __m128 n1 = PERLIN_LERP4(PERLIN_LERP4(n[4], n[5], vw), PERLIN_LERP4(n[6], n[7], vw), vv);
+        _mm_storeu_ps(values + i, PERLIN_LERP4(n0, n1, u));
+        #undef PERLIN_LERP4
+    #elif defined(RTEXTURES_SIMD_NEON)
+        float32x4_t x = vld1q_f32(fraction);
+        float32x4_t x1 = vsubq_f32(x, vdupq_n_f32(1.0f));
+        float32x4_t u = vmulq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vsubq_f32(vmulq_n_f32(x, 6.0f), vdupq_n_f32(15.0f)), x), vdupq_n_f32(10.0f)), x), x), x);
+        float32x4_t n[8];
+
+        for (int c = 0; c < 8; c++) n[c] = vaddq_f32(vaddq_f32(vmulq_f32(vld1q_f32(terms[c][0]), (c < 4)? x : x1), vld1q_f32(terms[c][1])), vld1q_f32(terms[c][2]));
+
+        #define PERLIN_LERP4(a, b, t) vaddq_f32((a), vmulq_f32(vsubq_f32((b), (a)), (t)))
+        float32x4_t vw = vdupq_n_f32(w), vv = vdupq_n_f32(v);
+        float32x4_t n0 = PERLIN_LERP4(PERLIN_LERP4(n[0], n[1], vw), PERLIN_LERP4(n[2], n[3], vw), vv);
+        float32x4_t n1 = PERLIN_LERP4(PERLIN_LERP4(n[4], n[5], vw), PERLIN_LERP4(n[6], n[7], vw), vv);
+        vst1q_f32(values + i, PERLIN_LERP4(n0, n1, u));
+        #undef PERLIN_LERP4
+    #endif
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = positions[i];
+        int px = PERLIN_FLOOR(x);
+        int r0 = stb__perlin_randtab[(px & 255) + seed];
+        int r1 = stb__perlin_randtab[((px + 1) & 255) + seed];
+        int r[4] = { stb__perlin_randtab[r0 + y0], stb__perlin_randtab[r0 + y1], stb__perlin_randtab[r1 + y0], stb__perlin_randtab[r1 + y1] };
+        float n[8] = { 0 };
+
+        x -= px;
+        float u = PERLIN_EASE(x);
+
+        for (int c = 0; c < 8; c++)
+        {
+            int g = stb__perlin_randtab_grad_idx[r[c >> 1] + ((c & 1)? z1 : z0)];
+            n[c] = gradX[g]*((c < 4)? x : (x - 1)) + termY[(c >> 1) & 1][g] + termZ[c & 1][g];
+        }
+
+        float n0 = PERLIN_LERP(PERLIN_LERP(n[0], n[1], w), PERLIN_LERP(n[2], n[3], w), v);
+        float n1 = PERLIN_LERP(PERLIN_LERP(n[4], n[5], w), PERLIN_LERP(n[6], n[7], w), v);
+        values[i] = PERLIN_LERP(n0, n1, u);
+    }
+
+    #undef PERLIN_FLOOR
+    #undef PERLIN_EASE
+    #undef PERLIN_LERP
+}
+#endif
+
+// Init span writer for image, returns false if image can not be drawn
+// NOTE: Spans are blended only if requested and color is translucent, other spans replace destination pixels
+static bool InitImageSpanWriter(ImageSpanWriter *writer, Image *dst, Color color)
+{
+    if ((dst == NULL) || (dst->data == NULL) || (dst->width <= 0) || (dst->height <= 0) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return false;
+
+    writer->image = dst;
+    writer->bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    writer->blend = ((imageDrawFlags & IMAGE_DRAW_BLEND) != 0) && (color.a < 255);
+    writer->color = color;
+    writer->shaded = false;
+
+    SetPixelColor(writer->pixel, color, dst->format);
+
+    return (writer->bytesPerPixel > 0);
+}
+
+// Draw a span of image row pixels, optional pixels coverage (0..255)
+// NOTE: Span must be inside image bounds, spans not blended nor covered partially are filled directly
+static void DrawImageSpan(const ImageSpanWriter *writer, int x, int y, int count, const unsigned char *coverage)
+{
+    const int bytesPerPixel = writer->bytesPerPixel;
+    unsigned char *dst = (unsigned char *)writer->image->data + ((size_t)y*writer->image->width + x)*bytesPerPixel;
+
+    if (writer->shaded)
+    {
+        // Interpolate vertex colors at pixels centers, by chunks of pixels
+        Color colors[64] = { 0 };
+
+        for (int i = 0; i < count; i += 64)
+        {
+            int chunk = ((count - i) < 64)? (count - i) : 64;
+            float values[4] = { 0 };
+
+            for (int c = 0; c < 4; c++) values[c] = ((float)(x + i) + 0.5f)*writer->shade[c][0] + ((float)y + 0.5f)*writer->shade[c][1] + writer->shade[c][2] + 0.5f;
+
+            for (int k = 0; k < chunk; k++)
+            {
+                unsigned char *channels = (unsigned char *)&colors[k];
+
+                for (int c = 0; c < 4; c++)
+                {
+                    channels[c] = (values[c] <= 0.0f)? 0 : ((values[c] >= 255.0f)? 255 : (unsigned char)values[c]);
+                    values[c] += writer->shade[c][0];
+                }
+            }
+
+            DrawImageSpanPixels(writer, dst + i*bytesPerPixel, colors, (coverage != NULL)? (coverage + i) : NULL, chunk);
+        }
+    }
+    else if ((coverage == NULL) && !writer->blend)
+    {
+        // Fill span with color encoded in destination format
+        if (bytesPerPixel == 1) memset(dst, *(const unsigned char *)writer->pixel, count);
+        else if (bytesPerPixel == 4)
+        {
+            for (int i = 0; i < count; i++) memcpy(dst + i*4, writer->pixel, 4);
+        }
+        else
+        {
+            size_t size = (size_t)count*bytesPerPixel;
+
+            memcpy(dst, writer->pixel, bytesPerPixel);
+            for (size_t filled = bytesPerPixel; filled < size; filled *= 2) memcpy(dst + filled, dst, ((size - filled) < filled)? (size - filled) : filled);
+        }
+    }
+    else DrawImageSpanPixels(writer, dst, NULL, coverage, count);
+}
+
+// Draw span pixels one by one, pixels are blended if required or partially covered
+// NOTE: Blending is computed on RGBA8 colors, other formats pixels are converted
+static void DrawImageSpanPixels(const ImageSpanWriter *writer, unsigned char *dst, const Color *colors, const unsigned char *coverage, int count)
+{
+    const int format = writer->image->format;
+    const int bytesPerPixel = writer->bytesPerPixel;
+
+    if ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (colors == NULL))
+    {
+        // Uniform color over RGBA8 pixels, blending terms updated on coverage changes
+        // NOTE: Results match BlendPixelRGBA8(), opaque destination pixels avoid the division by output alpha
+        const unsigned char *src = (const unsigned char *)&writer->color;
+        unsigned int tintFactor[4] = { 256, 256, 256, 256 };
+        unsigned int lastCover = 256;
+        unsigned int alpha = 0;
+        unsigned int srcTerms[3] = { 0 };
+        unsigned int dstFactor = 0;
+
+        for (int i = 0; i < count; i++, dst += 4)
+        {
+            unsigned int cover = (coverage != NULL)? coverage[i] : 255;
+
+            if (cover == 0) continue;
+            if (!writer->blend && (cover == 255)) { memcpy(dst, writer->pixel, 4); continue; }
+
+            if (cover != lastCover)
+            {
+                lastCover = cover;
+                tintFactor[3] = cover + 1;
+                alpha = ((src[3]*tintFactor[3]) >> 8) + 1;
+                dstFactor = 255*(256 - alpha);
+                for (int c = 0; c < 3; c++) srcTerms[c] = src[c]*alpha*256;
+            }
+
+            if (alpha == 1) continue;
+            else if (alpha == 256) memcpy(dst, src, 4);
+            else if (dst[3] == 255)
+            {
+                dst[0] = (unsigned char)((srcTerms[0] + dst[0]*dstFactor)/65280);
+                dst[1] = (unsigned char)((srcTerms[1] + dst[1]*dstFactor)/65280);
+                dst[2] = (unsigned char)((srcTerms[2] + dst[2]*dstFactor)/65280);
+            }
+            else BlendPixelRGBA8(dst, src, tintFactor);
+        }
+
+        return;
+    }
+
+    for (int i = 0; i < count; i++, dst += bytesPerPixel)
+    {
+        Color color = (colors != NULL)? colors[i] : writer->color;
+        unsigned int cover = (coverage != NULL)? coverage[i] : 255;
+
+        if (cover == 0) continue;
+
+        if (!writer->blend && (cover == 255))
+        {
+            if (colors == NULL) memcpy(dst, writer->pixel, bytesPerPixel);
+            else if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) memcpy(dst, &color, 4);
+            else SetPixelColor(dst, color, format);
+        }
+        else
+        {
+            // Source alpha scaled by coverage, tint factors are (tint + 1)
+            const unsigned int tintFactor[4] = { 256, 256, 256, cover + 1 };
+
+            if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) BlendPixelRGBA8(dst, (const unsigned char *)&color, tintFactor);
+            else
+            {
+                Color pixel = GetPixelColor(dst, format);
+
+                BlendPixelRGBA8((unsigned char *)&pixel, (const unsigned char *)&color, tintFactor);
+                SetPixelColor(dst, pixel, format);
+            }
+        }
+    }
+}
+
+// Init rasterizer edges list, edges stored locally until list grows
+static void InitRasterEdges(RasterEdgeList *list)
+{
+    list->edges = list->local;
+    list->count = 0;
+    list->capacity = RASTER_LOCAL_EDGES;
+}
+
+// Add outline edge to rasterizer edges list, horizontal edges ignored
+static void AddRasterEdge(RasterEdgeList *list, Vector2 start, Vector2 end)
+{
+    // Horizontal edges never cross sample rows
+    if (start.y == end.y) return;
+
+    if (list->count == list->capacity)
+    {
+        RasterEdge *edges = (RasterEdge *)RL_MALLOC(2*list->capacity*sizeof(RasterEdge));
+
+        memcpy(edges, list->edges, list->count*sizeof(RasterEdge));
+        if (list->edges != list->local) RL_FREE(list->edges);
+
+        list->edges = edges;
+        list->capacity *= 2;
+    }
+
+    RasterEdge *edge = &list->edges[list->count];
+    edge->winding = 1;
+
+    if (start.y > end.y)
+    {
+        Vector2 temp = start;
+        start = end;
+        end = temp;
+        edge->winding = -1;
+    }
+
+    edge->x = start.x;
+    edge->y0 = start.y;
+    edge->y1 = end.y;
+    edge->dxdy = (end.x - start.x)/(end.y - start.y);
+
+    float minX = (start.x < end.x)? start.x : end.x;
+    float maxX = (start.x < end.x)? end.x : start.x;
+
+    if (list->count == 0)
+    {
+        list->bounds[0] = minX;
+        list->bounds[1] = start.y;
+        list->bounds[2] = maxX;
+        list->bounds[3] = end.y;
+    }
+    else
+    {
+        if (minX < list->bounds[0]) list->bounds[0] = minX;
+        if (start.y < list->bounds[1]) list->bounds[1] = start.y;
+        if (maxX > list->bounds[2]) list->bounds[2] = maxX;
+        if (end.y > list->bounds[3]) list->bounds[3] = end.y;
+    }
+
+    list->count++;
+}
+
+// Add closed polygon outline to rasterizer edges list
+// NOTE: Orientation is forced if not 0 (1-Positive, -1-Negative signed area), outlines with the
+// same orientation are merged by non-zero winding rule, opposite orientation outlines are holes
+static void AddRasterPolygon(RasterEdgeList *list, const Vector2 *points, int pointCount, int orientation)
+{
+    bool reverse = false;
+
+    if (orientation != 0)
+    {
+        float area = 0.0f;
+        for (int i = 0, j = pointCount - 1; i < pointCount; j = i++) area += points[j].x*points[i].y - points[i].x*points[j].y;
+
+        reverse = ((area*(float)orientation) < 0.0f);
+    }
+
+    for (int i = 0, j = pointCount - 1; i < pointCount; j = i++)
+    {
+        if (reverse) AddRasterEdge(list, points[i], points[j]);
+        else AddRasterEdge(list, points[j], points[i]);
+    }
+}
+
+// Add circle outline to rasterizer edges list, orientation: -1-Negative, otherwise positive
+// NOTE: Segments count keeps polygon within 1/8 pixel of the circle, polygon radius keeps circle area
+static void AddRasterCircle(RasterEdgeList *list, Vector2 center, float radius, int orientation)
+{
+    if (radius <= 0.0f) return;
+
+    int segments = 8;
+
+    if (radius > 0.125f)
+    {
+        segments = (int)ceilf(PI/acosf(1.0f - 0.125f/radius));
+
+        if (segments < 8) segments = 8;
+        if (segments > 1024) segments = 1024;
+    }
+
+    float step = ((orientation < 0)? -2.0f : 2.0f)*PI/(float)segments;
+    radius *= sqrtf(fabsf(step)/sinf(fabsf(step)));
+
+    Vector2 first = { center.x + radius, center.y };
+    Vector2 previous = first;
+
+    for (int i = 1; i <= segments; i++)
+    {
+        Vector2 point = first;
+
+        if (i < segments)
+        {
+            point.x = center.x + radius*cosf(step*(float)i);
+            point.y = center.y + radius*sinf(step*(float)i);
+        }
+
+        AddRasterEdge(list, previous, point);
+        previous = point;
+    }
+}
+
+// Add thick lines outlines to rasterizer edges list, butt caps and round joins
+// NOTE: Points are pixels positions, lines are centered on pixels centers
+static void AddRasterPolyline(RasterEdgeList *list, const Vector2 *points, int pointCount, float thick, bool closed)
+{
+    float halfThick = thick*0.5f;
+    int segments = closed? pointCount : (pointCount - 1);
+
+    if (halfThick <= 0.0f) return;
+
+    for (int i = 0; i < segments; i++)
+    {
+        Vector2 start = { points[i].x + 0.5f, points[i].y + 0.5f };
+        Vector2 end = { points[(i + 1)%pointCount].x + 0.5f, points[(i + 1)%pointCount].y + 0.5f };
+
+        float dx = end.x - start.x;
+        float dy = end.y - start.y;
+        float length = sqrtf(dx*dx + dy*dy);
+
+        if (length <= 0.0f) continue;
+
+        // Segment normal scaled to half thickness
+        float nx = -dy/length*halfThick;
+        float ny = dx/length*halfThick;
+
+        // Segments and joins are added with the same orientation, overlaps are drawn once
+        Vector2 quad[4] = { { start.x + nx, start.y + ny }, { end.x + nx, end.y + ny }, { end.x - nx, end.y - ny }, { start.x - nx, start.y - ny } };
+        AddRasterPolygon(list, quad, 4, 1);
+
+        if (closed || (i < (segments - 1))) AddRasterCircle(list, end, halfThick, 1);
+    }
+}
+
+// Rasterize edges list with non-zero winding rule, list is unloaded
+// NOTE: Aliased primitives fill pixels with center inside the outlines, anti-aliased primitives
+// accumulate RASTER_AA_SAMPLES rows per pixel row, spans coverage along rows is computed exactly
+static void RasterizeEdges(const ImageSpanWriter *writer, RasterEdgeList *list, bool antialias)
+{
+    const int width = writer->image->width;
+    const int height = writer->image->height;
+
+    // Rows and columns covered by edges, clipped to image bounds
+    int xStart = (int)fmaxf(0.0f, fminf(list->bounds[0], (float)width));
+    int yStart = (int)fmaxf(0.0f, fminf(list->bounds[1], (float)height));
+    int xEnd = (int)ceilf(fmaxf(0.0f, fminf(list->bounds[2], (float)width)));
+    int yEnd = (int)ceilf(fmaxf(0.0f, fminf(list->bounds[3], (float)height)));
+
+    if ((list->count > 0) && (xStart < xEnd) && (yStart < yEnd))
+    {
+        const int samples = antialias? RASTER_AA_SAMPLES : 1;
+        const float sampleWeight = 1.0f/(float)samples;
+        const int spanWidth = xEnd - xStart;
+
+        qsort(list->edges, list->count, sizeof(RasterEdge), CompareRasterEdges);
+
+        // Active edges, sorted by crossing position on sample row
+        int localActive[RASTER_LOCAL_EDGES];
+        float localCrossings[RASTER_LOCAL_EDGES];
+        int *active = (list->count <= RASTER_LOCAL_EDGES)? localActive : (int *)RL_MALLOC(list->count*sizeof(int));
+        float *crossings = (list->count <= RASTER_LOCAL_EDGES)? localCrossings : (float *)RL_MALLOC(list->count*sizeof(float));
+        int activeCount = 0;
+        int next = 0;
+
+        // Anti-aliasing accumulation: partially covered pixels areas and fully covered pixels runs deltas
+        float localAccumulation[2*(RASTER_LOCAL_WIDTH + 2)];
+        unsigned char localCoverage[RASTER_LOCAL_WIDTH];
+        float *areas = NULL;
+        float *deltas = NULL;
+        unsigned char *coverage = NULL;
+
+        if (antialias)
+        {
+            areas = (spanWidth <= RASTER_LOCAL_WIDTH)? localAccumulation : (float *)RL_MALLOC(2*(spanWidth + 2)*sizeof(float));
+            deltas = areas + spanWidth + 2;
+            coverage = (spanWidth <= RASTER_LOCAL_WIDTH)? localCoverage : (unsigned char *)RL_MALLOC(spanWidth);
+
+            memset(areas, 0, 2*(spanWidth + 2)*sizeof(float));
+        }
+
+        for (int y = yStart; y < yEnd; y++)
+        {
+            int rowMin = spanWidth;
+            int rowMax = -1;
+
+            for (int s = 0; s < samples; s++)
+            {
+                float sampleY = (float)y + ((float)s + 0.5f)*sampleWeight;
+                int count = 0;
+
+                // Remove edges ending above sample row, add edges starting above it
+                for (int i = 0; i < activeCount; i++)
+                {
+                    const RasterEdge *edge = &list->edges[active[i]];
+
+                    if (edge->y1 > sampleY)
+                    {
+                        active[count] = active[i];
+                        crossings[count] = edge->x + (sampleY - edge->y0)*edge->dxdy;
+                        count++;
+                    }
+                }
+
+                for (; (next < list->count) && (list->edges[next].y0 <= sampleY); next++)
+                {
+                    const RasterEdge *edge = &list->edges[next];
+
+                    if (edge->y1 > sampleY)
+                    {
+                        active[count] = next;
+                        crossings[count] = edge->x + (sampleY - edge->y0)*edge->dxdy;
+                        count++;
+                    }
+                }
+
+                activeCount = count;
+
+                // Sort active edges by crossing position, order is mostly kept between sample rows
+                for (int i = 1; i < count; i++)
+                {
+                    int index = active[i];
+                    float crossing = crossings[i];
+                    int k = i - 1;
+
+                    for (; (k >= 0) && (crossings[k] > crossing); k--)
+                    {
+                        active[k + 1] = active[k];
+                        crossings[k + 1] = crossings[k];
+                    }
+
+                    active[k + 1] = index;
+                    crossings[k + 1] = crossing;
+                }
+
+                // Spans between crossings with non-zero winding
+                int winding = 0;
+                float spanStart = 0.0f;
+
+                for (int i = 0; i < count; i++)
+                {
+                    int previous = winding;
+                    winding += list->edges[active[i]].winding;
+
+                    if (previous == 0) spanStart = crossings[i];
+                    else if (winding == 0)
+                    {
+                        float x0 = fmaxf((float)xStart, fminf(spanStart, (float)xEnd));
+                        float x1 = fmaxf((float)xStart, fminf(crossings[i], (float)xEnd));
+
+                        if (x1 <= x0) continue;
+
+                        if (antialias)
+                        {
+                            int i0 = (int)x0 - xStart;
+                            int i1 = (int)x1 - xStart;
+
+                            if (i0 == i1) areas[i0] += (x1 - x0)*sampleWeight;
+                            else
+                            {
+                                areas[i0] += ((float)(i0 + xStart + 1) - x0)*sampleWeight;
+                                deltas[i0 + 1] += sampleWeight;
+                                deltas[i1] -= sampleWeight;
+                                areas[i1] += (x1 - (float)(i1 + xStart))*sampleWeight;
+                            }
+
+                            if (i0 < rowMin) rowMin = i0;
+                            if (i1 > rowMax) rowMax = i1;
+                        }
+                        else
+                        {
+                            // Pixels with center inside the span
+                            int left = (int)ceilf(x0 - 0.5f);
+                            int right = (int)ceilf(x1 - 0.5f);
+
+                            if (right > left) DrawImageSpan(writer, left, y, right - left, NULL);
+                        }
+                    }
+                }
+            }
+
+            if (antialias && (rowMax >= rowMin))
+            {
+                int last = (rowMax < spanWidth)? rowMax : (spanWidth - 1);
+                float cover = 0.0f;
+
+                for (int i = rowMin; i <= last; i++)
+                {
+                    cover += deltas[i];
+                    float value = cover + areas[i];
+
+                    coverage[i] = (value >= 1.0f)? 255 : ((value <= 0.0f)? 0 : (unsigned char)(value*255.0f + 0.5f));
+                }
+
+                memset(areas + rowMin, 0, (rowMax - rowMin + 2)*sizeof(float));
+                memset(deltas + rowMin, 0, (rowMax - rowMin + 2)*sizeof(float));
+
+                // Fully covered pixels runs are drawn as solid spans, partially covered runs with coverage
+                for (int i = rowMin; i <= last;)
+                {
+                    int start = i;
+
+                    if (coverage[i] == 0) i++;
+                    else if (coverage[i] == 255)
+                    {
+                        while ((i <= last) && (coverage[i] == 255)) i++;
+                        DrawImageSpan(writer, xStart + start, y, i - start, NULL);
+                    }
+                    else
+                    {
+                        while ((i <= last) && (coverage[i] > 0) && (coverage[i] < 255)) i++;
+                        DrawImageSpan(writer, xStart + start, y, i - start, coverage + start);
+                    }
+                }
+            }
+        }
+
+        if (active != localActive) RL_FREE(active);
+        if (crossings != localCrossings) RL_FREE(crossings);
+        if (areas != localAccumulation) RL_FREE(areas);
+        if (coverage != localCoverage) RL_FREE(coverage);
+    }
+
+    if (list->edges != list->local) RL_FREE(list->edges);
+    InitRasterEdges(list);
+}
+
+// Compare rasterizer edges top (qsort() callback)
+static int CompareRasterEdges(const void *a, const void *b)
+{
+    float y0 = ((const RasterEdge *)a)->y0;
+    float y1 = ((const RasterEdge *)b)->y0;
+
+    return (y0 > y1) - (y0 < y1);
+}
+
+// Init color adjustments pass, lookup tables are computed for image format
+static void InitAdjustPass(AdjustPass *pass, const Image *image, const ImageAdjustments *adjustments)
+{
+    pass->data = image->data;
+    pass->width = image->width;
+    pass->format = image->format;
+
+    // Mipmap levels are adjusted too, adjustments do not depend on pixels position
+    for (int i = 0, width = image->width, height = image->height; i < ((image->mipmaps > 1)? image->mipmaps : 1); i++)
+    {
+        pass->pixelCount += width*height;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    // BLANK tint is considered no tint, zero initialized adjustments keep image unchanged
+    Color tint = adjustments->tint;
+    if ((tint.r == 0) && (tint.g == 0) && (tint.b == 0) && (tint.a == 0)) tint = (Color){ 255, 255, 255, 255 };
+
+    pass->tint = tint;
+    pass->tintFactor[0] = (float)tint.r/255.0f;
+    pass->tintFactor[1] = (float)tint.g/255.0f;
+    pass->tintFactor[2] = (float)tint.b/255.0f;
+    pass->tintFactor[3] = (float)tint.a/255.0f;
+
+    pass->brightness = adjustments->brightness;
+    if (pass->brightness < -255) pass->brightness = -255;
+    if (pass->brightness > 255) pass->brightness = 255;
+
+    float contrast = adjustments->contrast;
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+    pass->contrast = (100.0f + contrast)/100.0f;
+    pass->contrast *= pass->contrast;
+
+    pass->gamma = (adjustments->gamma > 0.0f)? 1.0f/adjustments->gamma : 1.0f;
+
+    pass->hue = fmodf(adjustments->hue, 360.0f);
+    pass->saturation = 1.0f + adjustments->saturation;
+    pass->value = 1.0f + adjustments->value;
+    if (pass->saturation < 0.0f) pass->saturation = 0.0f;
+    if (pass->value < 0.0f) pass->value = 0.0f;
+
+    pass->hsv = (pass->hue != 0.0f) || (pass->saturation != 1.0f) || (pass->value != 1.0f);
+    pass->invert = adjustments->invert;
+    pass->grayscale = adjustments->grayscale;
+
+    // Per channel adjustments lookup tables, same integer and float operations as single adjustment functions
+    for (int c = 0; c < 4; c++)
+    {
+        int factor = (c == 0)? tint.r : (c == 1)? tint.g : (c == 2)? tint.b : tint.a;
+
+        for (int i = 0; i < 256; i++)
+        {
+            int value = (i*factor)/255;
+
+            if (c < 3)
+            {
+                value += pass->brightness;
+                if (value < 0) value = 0;
+                if (value > 255) value = 255;
+
+                if (pass->contrast != 1.0f)
+                {
+                    float v = (((float)value/255.0f - 0.5f)*pass->contrast + 0.5f)*255.0f;
+                    if (v < 0) v = 0;
+                    if (v > 255) v = 255;
+                    value = (int)v;
+                }
+
+                if (pass->gamma != 1.0f) value = (int)(powf((float)value/255.0f, pass->gamma)*255.0f + 0.5f);
+                if (pass->invert && !pass->hsv) value = 255 - value;
+            }
+
+            pass->lut[c][i] = (unsigned char)value;
+        }
+    }
+
+    // Grayscale formats are expanded to RGB and converted back to luminance, a gray lookup table covers the whole chain
+    Color grays[256] = { 0 };
+    for (int i = 0; i < 256; i++) grays[i] = (Color){ (unsigned char)i, (unsigned char)i, (unsigned char)i, 255 };
+
+    AdjustColors(grays, 256, pass);
+
+    for (int i = 0; i < 256; i++)
+    {
+        pass->grayLut[i] = (unsigned char)(((float)grays[i].r/255.0f*0.299f + (float)grays[i].g/255.0f*0.587f + (float)grays[i].b/255.0f*0.114f)*255.0f);
+    }
+
+    // Packed formats have 65536 possible pixel values, for big images a lookup table of all values is cheaper
+    if (((pass->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+         (pass->format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+         (pass->format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)) && (pass->pixelCount > 65536))
+    {
+        unsigned short *values = (unsigned short *)RL_MALLOC(65536*sizeof(unsigned short));
+        for (int i = 0; i < 65536; i++) values[i] = (unsigned short)i;
+
+        AdjustPackedPixels(values, 65536, pass);
+        pass->packedLut = values;
+    }
+}
+
+// Apply color adjustments chain to 8 bit per channel colors
+// NOTE: Per channel adjustments come from lookup tables, HSV shift and grayscale mix channels
+static void AdjustColors(Color *colors, int count, const AdjustPass *pass)
+{
+    float red[ADJUST_CHUNK_PIXELS] = { 0 };
+    float green[ADJUST_CHUNK_PIXELS] = { 0 };
+    float blue[ADJUST_CHUNK_PIXELS] = { 0 };
+
+    for (int i = 0; i < count; i += ADJUST_CHUNK_PIXELS)
+    {
+        int chunk = ((count - i) < ADJUST_CHUNK_PIXELS)? (count - i) : ADJUST_CHUNK_PIXELS;
+        Color *chunkColors = colors + i;
+
+        for (int k = 0; k < chunk; k++)
+        {
+            chunkColors[k].r = pass->lut[0][chunkColors[k].r];
+            chunkColors[k].g = pass->lut[1][chunkColors[k].g];
+            chunkColors[k].b = pass->lut[2][chunkColors[k].b];
+            chunkColors[k].a = pass->lut[3][chunkColors[k].a];
+        }
+
+        if (pass->hsv)
+        {
+            for (int k = 0; k < chunk; k++)
+            {
+                red[k] = (float)chunkColors[k].r*(1.0f/255.0f);
+                green[k] = (float)chunkColors[k].g*(1.0f/255.0f);
+                blue[k] = (float)chunkColors[k].b*(1.0f/255.0f);
+            }
+
+            ShiftColorsHSV(red, green, blue, chunk, pass->hue, pass->saturation, pass->value);
+
+            // Invert applied after HSV shift, values are rounded and clamped (saturation and value can overflow)
+            int invert = pass->invert? 255 : 0;
+
+            for (int k = 0; k < chunk; k++)
+            {
+                float r = red[k]*255.0f + 0.5f;
+                float g = green[k]*255.0f + 0.5f;
+                float b = blue[k]*255.0f + 0.5f;
+
+                chunkColors[k].r = (unsigned char)(invert ^ ((r < 0.0f)? 0 : (r > 255.0f)? 255 : (int)r));
+                chunkColors[k].g = (unsigned char)(invert ^ ((g < 0.0f)? 0 : (g > 255.0f)? 255 : (int)g));
+                chunkColors[k].b = (unsigned char)(invert ^ ((b < 0.0f)? 0 : (b > 255.0f)? 255 : (int)b));
+            }
+        }
+
+        if (pass->grayscale)
+        {
+            for (int k = 0; k < chunk; k++)
+            {
+                unsigned char gray = (unsigned char)(((float)chunkColors[k].r/255.0f*0.299f + (float)chunkColors[k].g/255.0f*0.587f + (float)chunkColors[k].b/255.0f*0.114f)*255.0f);
+                chunkColors[k].r = chunkColors[k].g = chunkColors[k].b = gray;
+            }
+        }
+    }
+}
+
+// Apply color adjustments chain to 16 bit packed pixels, decoded to 8 bit per channel colors
+static void AdjustPackedPixels(unsigned short *values, int count, const AdjustPass *pass)
+{
+    Color colors[ADJUST_CHUNK_PIXELS] = { 0 };
+
+    for (int i = 0; i < count; i += ADJUST_CHUNK_PIXELS)
+    {
+        int chunk = ((count - i) < ADJUST_CHUNK_PIXELS)? (count - i) : ADJUST_CHUNK_PIXELS;
+
+        for (int k = 0; k < chunk; k++) colors[k] = GetPixelColor(&values[i + k], pass->format);
+        AdjustColors(colors, chunk, pass);
+        for (int k = 0; k < chunk; k++) SetPixelColor(&values[i + k], colors[k], pass->format);
+    }
+}
+
+// Apply color adjustments chain to RGBA32F color
+// NOTE: Colors are clamped to 0 but not to 1, high dynamic range data is kept
+static void AdjustColorFloat(float *color, const AdjustPass *pass)
+{
+    for (int c = 0; c < 3; c++)
+    {
+        // NOTE: Clamped after brightness and after contrast, same as 8 bit lookup tables
+        float value = color[c]*pass->tintFactor[c] + (float)pass->brightness/255.0f;
+        if (value < 0.0f) value = 0.0f;
+        value = (value - 0.5f)*pass->contrast + 0.5f;
+        if (value < 0.0f) value = 0.0f;
+        if (pass->gamma != 1.0f) value = (value > 0.0f)? powf(value, pass->gamma) : 0.0f;
+        color[c] = value;
+    }
+
+    color[3] *= pass->tintFactor[3];
+
+    if (pass->hsv) ShiftColorsHSV(&color[0], &color[1], &color[2], 1, pass->hue, pass->saturation, pass->value);
+    if (pass->invert) for (int c = 0; c < 3; c++) color[c] = (color[c] < 1.0f)? (1.0f - color[c]) : 0.0f;
+    if (pass->grayscale) color[0] = color[1] = color[2] = color[0]*0.299f + color[1]*0.587f + color[2]*0.114f;
+}
+
+// Shift RGB colors (normalized) in HSV space: hue offset (degrees), saturation and value factors
+// NOTE: Conversions match ColorToHSV() and ColorFromHSV(), saturation is clamped to [0..1],
+// SIMD and scalar paths compute the same operations (hue in sextants, branches as selects)
+static void ShiftColorsHSV(float *red, float *green, float *blue, int count, float hue, float saturation, float value)
+{
+    int i = 0;
+    float shift = hue/60.0f;    // Hue shift in sextants, in [-6..6]
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 six = _mm_set1_ps(6.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 r = _mm_loadu_ps(red + i);
+        __m128 g = _mm_loadu_ps(green + i);
+        __m128 b = _mm_loadu_ps(blue + i);
+
+        __m128 max = _mm_max_ps(r, _mm_max_ps(g, b));
+        __m128 min = _mm_min_ps(r, _mm_min_ps(g, b));
+        __m128 delta = _mm_sub_ps(max, min);
+        __m128 chroma = _mm_and_ps(_mm_cmpgt_ps(delta, _mm_set1_ps(0.00001f)), _mm_cmpgt_ps(max, zero));
+        __m128 inverse = _mm_and_ps(chroma, _mm_div_ps(one, delta));
+
+        // Hue sextant from maximum channel: red, green or blue
+        __m128 hr = _mm_mul_ps(_mm_sub_ps(g, b), inverse);
+        __m128 hg = _mm_add_ps(_mm_set1_ps(2.0f), _mm_mul_ps(_mm_sub_ps(b, r), inverse));
+        __m128 hb = _mm_add_ps(_mm_set1_ps(4.0f), _mm_mul_ps(_mm_sub_ps(r, g), inverse));
+        __m128 isRed = _mm_cmpge_ps(r, max);
+        __m128 isGreen = _mm_andnot_ps(isRed, _mm_cmpge_ps(g, max));
+        __m128 h = _mm_or_ps(_mm_and_ps(isRed, hr), _mm_or_ps(_mm_and_ps(isGreen, hg), _mm_andnot_ps(_mm_or_ps(isRed, isGreen), hb)));
+        h = _mm_and_ps(chroma, h);
+
+        h = _mm_add_ps(h, _mm_set1_ps(shift));
+        h = _mm_add_ps(h, _mm_and_ps(_mm_cmplt_ps(h, zero), six));
+        h = _mm_add_ps(h, _mm_and_ps(_mm_cmplt_ps(h, zero), six));
+        h = _mm_sub_ps(h, _mm_and_ps(_mm_cmpge_ps(h, six), six));
+
+        __m128 s = _mm_and_ps(chroma, _mm_div_ps(delta, max));
+        s = _mm_min_ps(_mm_mul_ps(s, _mm_set1_ps(saturation)), one);
+        __m128 v = _mm_mul_ps(max, _mm_set1_ps(value));
+        __m128 vs = _mm_mul_ps(v, s);
+
+        __m128 rgb[3] = { 0 };
+        for (int c = 0; c < 3; c++)
+        {
+            __m128 k = _mm_add_ps(h, _mm_set1_ps((float)(5 - 2*c)));
+            k = _mm_sub_ps(k, _mm_and_ps(_mm_cmpge_ps(k, six), six));
+            k = _mm_min_ps(k, _mm_sub_ps(_mm_set1_ps(4.0f), k));
+            k = _mm_max_ps(_mm_min_ps(k, one), zero);
+            rgb[c] = _mm_sub_ps(v, _mm_mul_ps(vs, k));
+        }
+
+        _mm_storeu_ps(red + i, rgb[0]);
+        _mm_storeu_ps(green + i, rgb[1]);
+        _mm_storeu_ps(blue + i, rgb[2]);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float r = red[i], g = green[i], b = blue[i];
+        float max = (r > g)? r : g;
+        float min = (r < g)? r : g;
+        if (b > max) max = b;
+        if (b < min) min = b;
+
+        float delta = max - min;
+        float h = 0.0f;
+        float s = 0.0f;
+
+        if ((delta > 0.00001f) && (max > 0.0f))
+        {
+            float inverse = 1.0f/delta;
+
+            if (r >= max) h = (g - b)*inverse;
+            else if (g >= max) h = 2.0f + (b - r)*inverse;
+            else h = 4.0f + (r - g)*inverse;
+
+            s = delta/max;
+        }
+
+        h += shift;
+        if (h < 0.0f) h += 6.0f;
+        if (h < 0.0f) h += 6.0f;
+        if (h >= 6.0f) h -= 6.0f;
+
+        s *= saturation;
+        if (s > 1.0f) s = 1.0f;
+        float v = max*value;
+
+        // Red, green and blue channels, ColorFromHSV() formula
+        float rgb[3] = { 0 };
+        for (int c = 0; c < 3; c++)
+        {
+            float k = (float)(5 - 2*c) + h;
+            if (k >= 6.0f) k -= 6.0f;
+            float t = 4.0f - k;
+            k = (t < k)? t : k;
+            k = (k < 1)? k : 1;
+            k = (k > 0)? k : 0;
+            rgb[c] = v - v*s*k;
+        }
+
+        red[i] = rgb[0];
+        green[i] = rgb[1];
+        blue[i] = rgb[2];
+    }
+}
+
+// Apply color adjustments to a range of image rows (ParallelFor() task)
+// NOTE: Rows are processed as a flat pixels range, the last row covers the remaining mipmap levels pixels
+static void AdjustImageRows(int start, int end, void *userData)
+{
+    const AdjustPass *pass = (const AdjustPass *)userData;
+    int bytesPerPixel = GetPixelDataSize(1, 1, pass->format);
+    int first = start*pass->width;
+    int count = ((end*pass->width < pass->pixelCount)? end*pass->width : pass->pixelCount) - first;
+    unsigned char *pixels = (unsigned char *)pass->data + (size_t)first*bytesPerPixel;
+
+    switch (pass->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: for (int i = 0; i < count; i++) pixels[i] = pass->grayLut[pixels[i]]; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                pixels[i*2] = pass->grayLut[pixels[i*2]];
+                pixels[i*2 + 1] = pass->lut[3][pixels[i*2 + 1]];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            if (pass->hsv || pass->grayscale) AdjustColors((Color *)pixels, count, pass);
+            else
+            {
+                for (int i = 0; i < count*4; i += 4)
+                {
+                    pixels[i] = pass->lut[0][pixels[i]];
+                    pixels[i + 1] = pass->lut[1][pixels[i + 1]];
+                    pixels[i + 2] = pass->lut[2][pixels[i + 2]];
+                    pixels[i + 3] = pass->lut[3][pixels[i + 3]];
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            if (pass->hsv || pass->grayscale)
+            {
+                Color colors[ADJUST_CHUNK_PIXELS] = { 0 };
+
+                for (int i = 0; i < count; i += ADJUST_CHUNK_PIXELS)
+                {
+                    int chunk = ((count - i) < ADJUST_CHUNK_PIXELS)? (count - i) : ADJUST_CHUNK_PIXELS;
+                    unsigned char *chunkPixels = pixels + i*3;
+
+                    for (int k = 0; k < chunk; k++) colors[k] = (Color){ chunkPixels[k*3], chunkPixels[k*3 + 1], chunkPixels[k*3 + 2], 255 };
+                    AdjustColors(colors, chunk, pass);
+                    for (int k = 0; k < chunk; k++) memcpy(chunkPixels + k*3, &colors[k], 3);
+                }
+            }
+            else
+            {
+                for (int i = 0; i < count*3; i += 3)
+                {
+                    pixels[i] = pass->lut[0][pixels[i]];
+                    pixels[i + 1] = pass->lut[1][pixels[i + 1]];
+                    pixels[i + 2] = pass->lut[2][pixels[i + 2]];
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *values = (unsigned short *)pixels;
+
+            if (pass->packedLut != NULL) for (int i = 0; i < count; i++) values[i] = pass->packedLut[values[i]];
+            else AdjustPackedPixels(values, count, pass);
+        } break;
+        default:
+        {
+            // Float and half-float formats, processed in chunks of RGBA32F pixels
+            float colors[ADJUST_CHUNK_PIXELS*4] = { 0 };
+            int channels = bytesPerPixel/(((pass->format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+                (pass->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) || (pass->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))? 2 : 4);
+
+            for (int i = 0; i < count; i += ADJUST_CHUNK_PIXELS)
+            {
+                int chunk = ((count - i) < ADJUST_CHUNK_PIXELS)? (count - i) : ADJUST_CHUNK_PIXELS;
+                unsigned char *chunkPixels = pixels + (size_t)i*bytesPerPixel;
+
+                LoadImageRowNormalized(chunkPixels, pass->format, colors, chunk);
+
+                // Adjusted colors are packed in place to image channels count, single channel formats store luminance
+                for (int k = 0; k < chunk; k++)
+                {
+                    float *color = colors + k*4;
+                    AdjustColorFloat(color, pass);
+
+                    if (channels == 1) colors[k] = color[0]*0.299f + color[1]*0.587f + color[2]*0.114f;
+                    else for (int c = 0; c < channels; c++) colors[k*channels + c] = color[c];
+                }
+
+                if (bytesPerPixel/channels == 2) FloatToHalfArray(colors, (unsigned short *)chunkPixels, chunk*channels);
+                else memcpy(chunkPixels, colors, chunk*channels*sizeof(float));
+            }
+        } break;
+    }
+}
+
+// Init image comparison pass, returns false if images can not be compared
+static bool InitComparePass(ComparePass *pass, Image image, Image reference)
+{
+    if ((image.data == NULL) || (reference.data == NULL) || (image.width == 0) || (image.height == 0)) return false;
+
+    if ((image.width != reference.width) || (image.height != reference.height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Images with different sizes can not be compared (%ix%i vs %ix%i)", image.width, image.height, reference.width, reference.height);
+        return false;
+    }
+
+    if ((image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (reference.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Comparison not supported for compressed image formats");
+        return false;
+    }
+
+    pass->image = image;
+    pass->reference = reference;
+    pass->native = (image.format == reference.format) &&
+        ((image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+         (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+
+    if (pass->native) pass->channels = GetPixelDataSize(1, 1, image.format);
+    else
+    {
+        // Normalized rows are RGBA, alpha compared only if any image has alpha, grayscale values are replicated in RGB
+        int formats[2] = { image.format, reference.format };
+        pass->channels = 3;
+
+        for (int i = 0; i < 2; i++)
+        {
+            if ((formats[i] == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) || (formats[i] == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                (formats[i] == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) || (formats[i] == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+                (formats[i] == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) || (formats[i] == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) pass->channels = 4;
+        }
+    }
+
+    return true;
+}
+
+// Compare a range of bands of image rows, SSIM blocks included (ParallelFor() task)
+// NOTE: Bands are SSIM_BLOCK_SIZE rows high, partial blocks at right and bottom borders are not used by SSIM
+static void CompareImageBands(int start, int end, void *userData)
+{
+    ComparePass *pass = (ComparePass *)userData;
+    int width = pass->image.width;
+    int bytesPerPixel = GetPixelDataSize(1, 1, pass->image.format);
+    int refBytesPerPixel = GetPixelDataSize(1, 1, pass->reference.format);
+
+    // Luminance rows of a band for both images, RGBA32F rows for normalized comparison
+    float *luma = (float *)RL_MALLOC(2*SSIM_BLOCK_SIZE*width*sizeof(float));
+    float *rows = pass->native? NULL : (float *)RL_MALLOC(2*4*width*sizeof(float));
+
+    for (int band = start; band < end; band++)
+    {
+        CompareStats *stats = &pass->bands[band];
+        int y0 = band*SSIM_BLOCK_SIZE;
+        int rowCount = ((pass->image.height - y0) < SSIM_BLOCK_SIZE)? (pass->image.height - y0) : SSIM_BLOCK_SIZE;
+
+        for (int k = 0; k < rowCount; k++)
+        {
+            const unsigned char *a = (const unsigned char *)pass->image.data + (size_t)(y0 + k)*width*bytesPerPixel;
+            const unsigned char *b = (const unsigned char *)pass->reference.data + (size_t)(y0 + k)*width*refBytesPerPixel;
+            float *lumaA = luma + k*width;
+            float *lumaB = luma + (SSIM_BLOCK_SIZE + k)*width;
+
+            if (pass->native)
+            {
+                CompareRowBytes(a, b, width, bytesPerPixel, (int)(pass->tolerance*255.0f), stats);
+                LoadImageRowLuminance(a, pass->image.format, lumaA, width);
+                LoadImageRowLuminance(b, pass->reference.format, lumaB, width);
+            }
+            else
+            {
+                float *rowA = rows;
+                float *rowB = rows + 4*width;
+
+                LoadImageRowNormalized(a, pass->image.format, rowA, width);
+                LoadImageRowNormalized(b, pass->reference.format, rowB, width);
+                CompareRowFloat(rowA, rowB, width, pass->channels, pass->tolerance, stats);
+
+                for (int x = 0; x < width; x++)
+                {
+                    lumaA[x] = rowA[x*4]*0.299f + rowA[x*4 + 1]*0.587f + rowA[x*4 + 2]*0.114f;
+                    lumaB[x] = rowB[x*4]*0.299f + rowB[x*4 + 1]*0.587f + rowB[x*4 + 2]*0.114f;
+                }
+            }
+
+            if (pass->blocks == NULL)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    stats->luma[0] += lumaA[x];
+                    stats->luma[1] += lumaB[x];
+                    stats->luma[2] += lumaA[x]*lumaA[x] + lumaB[x]*lumaB[x];
+                    stats->luma[3] += lumaA[x]*lumaB[x];
+                }
+            }
+        }
+
+        if ((pass->blocks == NULL) || (rowCount < SSIM_BLOCK_SIZE)) continue;
+
+        // Blocks luminance sums: a, b, a^2 + b^2, a*b
+        for (int bx = 0; bx < pass->blocksX; bx++)
+        {
+            float *block = pass->blocks + (band*pass->blocksX + bx)*4;
+
+        #if defined(RTEXTURES_SIMD_SSE2)
+            __m128 sumA = _mm_setzero_ps();
+            __m128 sumB = _mm_setzero_ps();
+            __m128 sumSquares = _mm_setzero_ps();
+            __m128 sumProducts = _mm_setzero_ps();
+
+            for (int k = 0; k < SSIM_BLOCK_SIZE; k++)
+            {
+                __m128 va = _mm_loadu_ps(luma + k*width + bx*SSIM_BLOCK_SIZE);
+                __m128 vb = _mm_loadu_ps(luma + (SSIM_BLOCK_SIZE + k)*width + bx*SSIM_BLOCK_SIZE);
+
+                sumA = _mm_add_ps(sumA, va);
+                sumB = _mm_add_ps(sumB, vb);
+                sumSquares = _mm_add_ps(sumSquares, _mm_add_ps(_mm_mul_ps(va, va), _mm_mul_ps(vb, vb)));
+                sumProducts = _mm_add_ps(sumProducts, _mm_mul_ps(va, vb));
+            }
+
+            // Transposed sums add the four lanes of each sum into one lane
+            _MM_TRANSPOSE4_PS(sumA, sumB, sumSquares, sumProducts);
+            _mm_storeu_ps(block, _mm_add_ps(_mm_add_ps(sumA, sumB), _mm_add_ps(sumSquares, sumProducts)));
+        #else
+            block[0] = block[1] = block[2] = block[3] = 0.0f;
+
+            for (int k = 0; k < SSIM_BLOCK_SIZE; k++)
+            {
+                for (int i = 0; i < SSIM_BLOCK_SIZE; i++)
+                {
+                    float va = luma[k*width + bx*SSIM_BLOCK_SIZE + i];
+                    float vb = luma[(SSIM_BLOCK_SIZE + k)*width + bx*SSIM_BLOCK_SIZE + i];
+
+                    block[0] += va;
+                    block[1] += vb;
+                    block[2] += va*va + vb*vb;
+                    block[3] += va*vb;
+                }
+            }
+        #endif
+        }
+    }
+
+    RL_FREE(luma);
+    RL_FREE(rows);
+}
+
+// Compare rows of 8 bit channels: absolute and squared differences sums, maximum difference and differing pixels
+// NOTE: Differing pixels are only counted for rows with differences over threshold
+static void CompareRowBytes(const unsigned char *a, const unsigned char *b, int width, int bytesPerPixel, int threshold, CompareStats *stats)
+{
+    int size = width*bytesPerPixel;
+    int i = 0;
+    unsigned long long sumError = 0;
+    unsigned long long sumSquares = 0;
+    int maxError = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sad = _mm_setzero_si128();
+    __m128i max = _mm_setzero_si128();
+    unsigned int lanes[4] = { 0 };
+
+    while (i + 16 <= size)
+    {
+        // Squares are accumulated in 32 bit lanes, flushed before they can overflow
+        __m128i squares = _mm_setzero_si128();
+
+        for (int n = 0; (n < 4096) && (i + 16 <= size); n++, i += 16)
+        {
+            __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+            __m128i d = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+            __m128i lo = _mm_unpacklo_epi8(d, zero);
+            __m128i hi = _mm_unpackhi_epi8(d, zero);
+
+            sad = _mm_add_epi64(sad, _mm_sad_epu8(d, zero));
+            squares = _mm_add_epi32(squares, _mm_add_epi32(_mm_madd_epi16(lo, lo), _mm_madd_epi16(hi, hi)));
+            max = _mm_max_epu8(max, d);
+        }
+
+        _mm_storeu_si128((__m128i *)lanes, squares);
+        sumSquares += (unsigned long long)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    unsigned long long sums[2] = { 0 };
+    unsigned char maxBytes[16] = { 0 };
+    _mm_storeu_si128((__m128i *)sums, sad);
+    _mm_storeu_si128((__m128i *)maxBytes, max);
+
+    sumError = sums[0] + sums[1];
+    for (int k = 0; k < 16; k++) if (maxBytes[k] > maxError) maxError = maxBytes[k];
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint32x4_t sad = vdupq_n_u32(0);
+    uint8x16_t max = vdupq_n_u8(0);
+    unsigned int lanes[4] = { 0 };
+
+    while (i + 16 <= size)
+    {
+        // Squares are accumulated in 32 bit lanes, flushed before they can overflow
+        uint32x4_t squares = vdupq_n_u32(0);
+
+        for (int n = 0; (n < 4096) && (i + 16 <= size); n++, i += 16)
+        {
+            uint8x16_t d = vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+
+            sad = vpadalq_u16(sad, vpaddlq_u8(d));
+            squares = vpadalq_u16(squares, vmull_u8(vget_low_u8(d), vget_low_u8(d)));
+            squares = vpadalq_u16(squares, vmull_u8(vget_high_u8(d), vget_high_u8(d)));
+            max = vmaxq_u8(max, d);
+        }
+
+        vst1q_u32(lanes, squares);
+        sumSquares += (unsigned long long)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    unsigned char maxBytes[16] = { 0 };
+    vst1q_u32(lanes, sad);
+    vst1q_u8(maxBytes, max);
+
+    sumError = (unsigned long long)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (int k = 0; k < 16; k++) if (maxBytes[k] > maxError) maxError = maxBytes[k];
+#endif
+
+    for (; i < size; i++)
+    {
+        int d = (a[i] > b[i])? (a[i] - b[i]) : (b[i] - a[i]);
+
+        sumError += d;
+        sumSquares += d*d;
+        if (d > maxError) maxError = d;
+    }
+
+    if (maxError > threshold)
+    {
+        for (int x = 0; x < size; x += bytesPerPixel)
+        {
+            for (int c = 0; c < bytesPerPixel; c++)
+            {
+                int d = (a[x + c] > b[x + c])? (a[x + c] - b[x + c]) : (b[x + c] - a[x + c]);
+                if (d > threshold) { stats->diffPixels++; break; }
+            }
+        }
+    }
+
+    stats->sumError += (double)sumError/255.0;
+    stats->sumSquares += (double)sumSquares/(255.0*255.0);
+    if ((float)maxError/255.0f > stats->maxError) stats->maxError = (float)maxError/255.0f;
+}
+
+// Compare rows of RGBA32F pixels, first channels only (3 or 4)
+static void CompareRowFloat(const float *a, const float *b, int width, int channels, float tolerance, CompareStats *stats)
+{
+    double sumError = 0.0;
+    double sumSquares = 0.0;
+    float maxError = stats->maxError;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(0x7fffffff, 0x7fffffff, 0x7fffffff, (channels == 4)? 0x7fffffff : 0));
+    const __m128 limit = _mm_set1_ps(tolerance);
+    __m128 max = _mm_set1_ps(maxError);
+
+    for (int x = 0; x < width; x++)
+    {
+        // Absolute value and unused alpha channel from the same mask
+        __m128 d = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(a + x*4), _mm_loadu_ps(b + x*4)), mask);
+        __m128 squares = _mm_mul_ps(d, d);
+        float sums[4] = { 0 };
+
+        max = _mm_max_ps(max, d);
+        if (_mm_movemask_ps(_mm_cmpgt_ps(d, limit)) != 0) stats->diffPixels++;
+
+        _mm_storeu_ps(sums, _mm_add_ps(_mm_unpacklo_ps(d, squares), _mm_unpackhi_ps(d, squares)));
+        sumError += (double)sums[0] + sums[2];
+        sumSquares += (double)sums[1] + sums[3];
+    }
+
+    float maxLanes[4] = { 0 };
+    _mm_storeu_ps(maxLanes, max);
+    for (int c = 0; c < 4; c++) if (maxLanes[c] > maxError) maxError = maxLanes[c];
+#else
+    for (int x = 0; x < width; x++)
+    {
+        bool differs = false;
+
+        for (int c = 0; c < channels; c++)
+        {
+            float d = fabsf(a[x*4 + c] - b[x*4 + c]);
+
+            sumError += d;
+            sumSquares += d*d;
+            if (d > maxError) maxError = d;
+            if (d > tolerance) differs = true;
+        }
+
+        if (differs) stats->diffPixels++;
+    }
+#endif
+
+    stats->sumError += sumError;
+    stats->sumSquares += sumSquares;
+    stats->maxError = maxError;
+}
+
+// Load a row of 8 bit per channel pixels luminance (normalized)
+static void LoadImageRowLuminance(const unsigned char *src, int format, float *dst, int count)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: for (int i = 0; i < count; i++) dst[i] = (float)src[i]*(1.0f/255.0f); break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: for (int i = 0; i < count; i++) dst[i] = (float)src[i*2]*(1.0f/255.0f); break;
+        default:
+        {
+            int stride = GetPixelDataSize(1, 1, format);
+            for (int i = 0; i < count; i++) dst[i] = ((float)src[i*stride]*0.299f + (float)src[i*stride + 1]*0.587f + (float)src[i*stride + 2]*0.114f)*(1.0f/255.0f);
+        } break;
+    }
+}
+
+// Compute SSIM from luminance sums: a, b, a^2 + b^2, a*b
+// NOTE: Standard constants for normalized values, C1 = (0.01)^2 and C2 = (0.03)^2
+static float ComputeSSIM(const double *sums, double count)
+{
+    const double c1 = 0.0001;
+    const double c2 = 0.0009;
+
+    double meanA = sums[0]/count;
+    double meanB = sums[1]/count;
+    double variances = sums[2]/count - meanA*meanA - meanB*meanB;     // Variance a + variance b
+    double covariance = sums[3]/count - meanA*meanB;
+
+    return (float)(((2.0*meanA*meanB + c1)*(2.0*covariance + c2))/((meanA*meanA + meanB*meanB + c1)*(variances + c2)));
+}
+
+// Compute absolute differences for a range of image rows (ParallelFor() task)
+// NOTE: Differences image is opaque, alpha differences are shown as gray (max with color differences)
+static void DiffImageRows(int start, int end, void *userData)
+{
+    ComparePass *pass = (ComparePass *)userData;
+    int width = pass->image.width;
+    int bytesPerPixel = GetPixelDataSize(1, 1, pass->image.format);
+    int refBytesPerPixel = GetPixelDataSize(1, 1, pass->reference.format);
+    float *rows = pass->native? NULL : (float *)RL_MALLOC(2*4*width*sizeof(float));
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *a = (const unsigned char *)pass->image.data + (size_t)y*width*bytesPerPixel;
+        const unsigned char *b = (const unsigned char *)pass->reference.data + (size_t)y*width*refBytesPerPixel;
+
+        if (pass->native)
+        {
+            unsigned char *dst = pass->diff + (size_t)y*width*bytesPerPixel;
+            int x = 0;
+
+            if (pass->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+            {
+            #if defined(RTEXTURES_SIMD_SSE2)
+                const __m128i opaque = _mm_set1_epi32((int)0xff000000);
+
+                for (; x + 4 <= width; x += 4)
+                {
+                    __m128i va = _mm_loadu_si128((const __m128i *)(a + x*4));
+                    __m128i vb = _mm_loadu_si128((const __m128i *)(b + x*4));
+                    __m128i d = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+
+                    // Alpha difference broadcast to color channels
+                    __m128i alpha = _mm_srli_epi32(d, 24);
+                    alpha = _mm_or_si128(alpha, _mm_or_si128(_mm_slli_epi32(alpha, 8), _mm_slli_epi32(alpha, 16)));
+
+                    _mm_storeu_si128((__m128i *)(dst + x*4), _mm_or_si128(_mm_max_epu8(d, alpha), opaque));
+                }
+            #endif
+            }
+
+            for (; x < width; x++)
+            {
+                unsigned char d[4] = { 0 };
+                for (int c = 0; c < bytesPerPixel; c++) d[c] = (a[x*bytesPerPixel + c] > b[x*bytesPerPixel + c])? (a[x*bytesPerPixel + c] - b[x*bytesPerPixel + c]) : (b[x*bytesPerPixel + c] - a[x*bytesPerPixel + c]);
+
+                switch (pass->image.format)
+                {
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    {
+                        dst[x*2] = (d[0] > d[1])? d[0] : d[1];
+                        dst[x*2 + 1] = 255;
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                    {
+                        for (int c = 0; c < 3; c++) dst[x*4 + c] = (d[c] > d[3])? d[c] : d[3];
+                        dst[x*4 + 3] = 255;
+                    } break;
+                    default: memcpy(dst + x*bytesPerPixel, d, bytesPerPixel); break;
+                }
+            }
+        }
+        else
+        {
+            float *dst = (float *)pass->diff + (size_t)y*width*4;
+            float *rowA = rows;
+            float *rowB = rows + 4*width;
+
+            LoadImageRowNormalized(a, pass->image.format, rowA, width);
+            LoadImageRowNormalized(b, pass->reference.format, rowB, width);
+
+            for (int x = 0; x < width; x++)
+            {
+                float alpha = fabsf(rowA[x*4 + 3] - rowB[x*4 + 3]);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    float d = fabsf(rowA[x*4 + c] - rowB[x*4 + c]);
+                    dst[x*4 + c] = (d > alpha)? d : alpha;
+                }
+
+                dst[x*4 + 3] = 1.0f;
+            }
+        }
+    }
+
+    RL_FREE(rows);
+}
+
+// Init virtual texture levels and tiles layout, returns false if not valid
+// NOTE: Levels sizes are halved (rounding up) until the level fits in one tile
+static bool InitVirtualTextureLayout(VirtualTextureData *texture, int width, int height, int tileSize, int border)
+{
+    if ((width <= 0) || (height <= 0) || (tileSize < 8) || (border < 0) || (border >= tileSize)) return false;
+
+    texture->width = width;
+    texture->height = height;
+    texture->tileSize = tileSize;
+    texture->border = border;
+    texture->tileDataSize = (tileSize + 2*border)*(tileSize + 2*border)*4;
+    texture->tileCount = 0;
+    texture->levels = 0;
+
+    for (int w = width, h = height; texture->levels < VIRTUAL_TEXTURE_MAX_LEVELS; w = (w + 1)/2, h = (h + 1)/2)
+    {
+        int level = texture->levels;
+
+        texture->levelSize[level][0] = w;
+        texture->levelSize[level][1] = h;
+        texture->levelTiles[level][0] = (w + tileSize - 1)/tileSize;
+        texture->levelTiles[level][1] = (h + tileSize - 1)/tileSize;
+        texture->levelOffset[level] = texture->tileCount;
+        texture->tileCount += texture->levelTiles[level][0]*texture->levelTiles[level][1];
+        texture->levels++;
+
+        if ((w <= tileSize) && (h <= tileSize)) break;
+    }
+
+    return ((texture->levelSize[texture->levels - 1][0] <= tileSize) && (texture->levelSize[texture->levels - 1][1] <= tileSize));
+}
+
+// Export a range of virtual texture level tiles (ParallelFor() task)
+// NOTE: Tiles borders replicate level edges, smaller levels are 2x2 box filtered from previous level tiles
+static void ExportVirtualTextureTiles(int start, int end, void *userData)
+{
+    const VirtualTextureExport *pass = (const VirtualTextureExport *)userData;
+    const VirtualTextureData *texture = pass->texture;
+    int level = pass->level;
+    int tileSize = texture->tileSize;
+    int slotSize = tileSize + 2*texture->border;
+    int width = texture->levelSize[level][0];
+    int height = texture->levelSize[level][1];
+
+    for (int i = start; i < end; i++)
+    {
+        unsigned char *dst = texture->fileData + VIRTUAL_TEXTURE_HEADER_SIZE + (size_t)(texture->levelOffset[level] + i)*texture->tileDataSize;
+        int x0 = (i%texture->levelTiles[level][0])*tileSize - texture->border;
+        int y0 = (i/texture->levelTiles[level][0])*tileSize - texture->border;
+
+        if (level == 0)
+        {
+            // Tile region clipped to image, converted to RGBA8
+            int cx0 = (x0 > 0)? x0 : 0;
+            int cy0 = (y0 > 0)? y0 : 0;
+            int cx1 = (x0 + slotSize < width)? x0 + slotSize : width;
+            int cy1 = (y0 + slotSize < height)? y0 + slotSize : height;
+
+            Image region = LoadImageRegion(pass->source, (Rectangle){ (float)cx0, (float)cy0, (float)(cx1 - cx0), (float)(cy1 - cy0) });
+            ImageFormat(&region, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            for (int y = 0; y < slotSize; y++)
+            {
+                int sy = (y0 + y < cy0)? cy0 : (y0 + y >= cy1)? cy1 - 1 : y0 + y;
+
+                for (int x = 0; x < slotSize; x++)
+                {
+                    int sx = (x0 + x < cx0)? cx0 : (x0 + x >= cx1)? cx1 - 1 : x0 + x;
+                    memcpy(dst + (y*slotSize + x)*4, (unsigned char *)region.data + ((sy - cy0)*region.width + (sx - cx0))*4, 4);
+                }
+            }
+
+            UnloadImage(region);
+        }
+        else
+        {
+            // Previous level texels are read from previous level tiles (inner area)
+            int previous = level - 1;
+            int previousWidth = texture->levelSize[previous][0];
+            int previousHeight = texture->levelSize[previous][1];
+
+            for (int y = 0; y < slotSize; y++)
+            {
+                int py = (y0 + y < 0)? 0 : (y0 + y >= height)? height - 1 : y0 + y;
+                int sy[2] = { 2*py, (2*py + 1 < previousHeight)? 2*py + 1 : previousHeight - 1 };
+
+                for (int x = 0; x < slotSize; x++)
+                {
+                    int px = (x0 + x < 0)? 0 : (x0 + x >= width)? width - 1 : x0 + x;
+                    int sx[2] = { 2*px, (2*px + 1 < previousWidth)? 2*px + 1 : previousWidth - 1 };
+                    int sum[4] = { 2, 2, 2, 2 };
+
+                    for (int k = 0; k < 4; k++)
+                    {
+                        int tx = sx[k%2]/tileSize;
+                        int ty = sy[k/2]/tileSize;
+                        const unsigned char *tile = texture->fileData + VIRTUAL_TEXTURE_HEADER_SIZE +
+                            (size_t)(texture->levelOffset[previous] + ty*texture->levelTiles[previous][0] + tx)*texture->tileDataSize;
+                        const unsigned char *texel = tile + ((sy[k/2] - ty*tileSize + texture->border)*slotSize + (sx[k%2] - tx*tileSize + texture->border))*4;
+
+                        for (int c = 0; c < 4; c++) sum[c] += texel[c];
+                    }
+
+                    for (int c = 0; c < 4; c++) dst[(y*slotSize + x)*4 + c] = (unsigned char)(sum[c]/4);
+                }
+            }
+        }
+    }
+}
+
+// Request virtual texture tile async load, ignored if resident, loading or too many loads in flight
+static void RequestVirtualTextureTile(VirtualTextureData *texture, int tile)
+{
+    if ((texture->tileSlots[tile] != -1) || (texture->loadCount >= MAX_VIRTUAL_TEXTURE_LOADS)) return;
+
+    VirtualTileLoad *request = (VirtualTileLoad *)RL_CALLOC(1, sizeof(VirtualTileLoad));
+    request->texture = texture;
+    request->tile = tile;
+
+    texture->tileSlots[tile] = VIRTUAL_TILE_LOADING;
+    texture->loadCount++;
+
+    LoadAsync(LoadVirtualTextureTile, FinishVirtualTextureTile, ReleaseVirtualTextureTile, request);
+}
+
+// Copy virtual texture tile pixels from tiles file (async load step, worker thread)
+// NOTE: Mapped file pages are read from disk here, main thread only uploads pixels
+static void LoadVirtualTextureTile(void *userData)
+{
+    VirtualTileLoad *request = (VirtualTileLoad *)userData;
+    const VirtualTextureData *texture = request->texture;
+
+    request->pixels = (unsigned char *)RL_MALLOC(texture->tileDataSize);
+    memcpy(request->pixels, texture->fileData + VIRTUAL_TEXTURE_HEADER_SIZE + (size_t)request->tile*texture->tileDataSize, texture->tileDataSize);
+}
+
+// Upload loaded virtual texture tile into cache (async finish step, main thread)
+static void FinishVirtualTextureTile(void *userData)
+{
+    VirtualTileLoad *request = (VirtualTileLoad *)userData;
+    VirtualTextureData *texture = request->texture;
+
+    texture->loadCount--;
+
+    if (!texture->unloading)
+    {
+        texture->tileSlots[request->tile] = -1;
+        if (request->pixels != NULL) UploadVirtualTextureTile(texture, request->tile, request->pixels, false);
+    }
+    else if (texture->loadCount == 0) UnloadVirtualTextureData(texture);
+
+    RL_FREE(request->pixels);
+    RL_FREE(request);
+}
+
+// Free loaded virtual texture tile of cancelled load (async release step, main thread)
+// NOTE: Tile is not uploaded, it can be requested again
+static void ReleaseVirtualTextureTile(void *userData)
+{
+    VirtualTileLoad *request = (VirtualTileLoad *)userData;
+    VirtualTextureData *texture = request->texture;
+
+    texture->loadCount--;
+
+    if (!texture->unloading) texture->tileSlots[request->tile] = -1;
+    else if (texture->loadCount == 0) UnloadVirtualTextureData(texture);
+
+    RL_FREE(request->pixels);
+    RL_FREE(request);
+}
+
+// Upload tile into a cache slot: free slot or least recently used slot (tiles used on last draw are kept)
+// NOTE: Pending draws are flushed before slot update, tile is dropped if no slot is available
+static void UploadVirtualTextureTile(VirtualTextureData *texture, int tile, const unsigned char *pixels, bool pinned)
+{
+    int slot = -1;
+
+    for (int i = 0; i < texture->slotCount; i++)
+    {
+        if (texture->slotTiles[i] < 0) { slot = i; break; }
+
+        if ((texture->slotUsed[i] != UINT_MAX) && (texture->slotUsed[i] != texture->useStamp) &&
+            ((slot < 0) || (texture->slotUsed[i] < texture->slotUsed[slot]))) slot = i;
+    }
+
+    if (slot < 0) return;
+
+    if (texture->slotTiles[slot] >= 0) texture->tileSlots[texture->slotTiles[slot]] = -1;
+
+    int slotSize = texture->tileSize + 2*texture->border;
+    Rectangle rec = { (float)((slot%texture->slotsPerRow)*slotSize), (float)((slot/texture->slotsPerRow)*slotSize), (float)slotSize, (float)slotSize };
+
+    rlDrawRenderBatchActive();
+    UpdateTextureRec(texture->cache, rec, pixels);
+
+    texture->tileSlots[tile] = slot;
+    texture->slotTiles[slot] = tile;
+    texture->slotUsed[slot] = pinned? UINT_MAX : texture->useStamp;
+}
+
+// Unload virtual texture internal data (tiles file mapping, cache state)
+static void UnloadVirtualTextureData(VirtualTextureData *texture)
+{
+    UnmapFileData(texture->fileData, texture->fileSize, texture->fileHandle);
+
+    RL_FREE(texture->tileSlots);
+    RL_FREE(texture->slotTiles);
+    RL_FREE(texture->slotUsed);
+    RL_FREE(texture);
+}
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Scan GIF frames delays (milliseconds) and disposal modes without decoding, returns frames count
+// NOTE: Frames delay and disposal mode come from last graphic control extension, same as stb_image decoder
+static int ScanAnimatedImageGIF(const unsigned char *fileData, int dataSize, int **delays, int **disposals)
+{
+    stbi__context context = { 0 };
+    stbi__gif *gif = (stbi__gif *)RL_CALLOC(1, sizeof(stbi__gif));
+    int comp = 0;
+    int count = 0;
+    int capacity = 0;
+    int delay = 0;
+    int flags = 0;
+
+    stbi__start_mem(&context, fileData, dataSize);
+
+    if (stbi__gif_header(&context, gif, &comp, 0))
+    {
+        for (int tag = stbi__get8(&context); (tag == 0x2c) || (tag == 0x21); tag = stbi__get8(&context))
+        {
+            if (tag == 0x2c)
+            {
+                // Image descriptor: position and size, local color table, LZW minimum code size and data sub-blocks
+                stbi__skip(&context, 8);
+                int localFlags = stbi__get8(&context);
+                if (localFlags & 0x80) stbi__skip(&context, 3*(2 << (localFlags & 7)));
+                stbi__get8(&context);
+
+                for (int length = stbi__get8(&context); length != 0; length = stbi__get8(&context)) stbi__skip(&context, length);
+                if (context.img_buffer >= context.img_buffer_end) break;     // Truncated frame data
+
+                if (count == capacity)
+                {
+                    capacity = (capacity > 0)? capacity*2 : 64;
+                    *delays = (int *)RL_REALLOC(*delays, capacity*sizeof(int));
+                    *disposals = (int *)RL_REALLOC(*disposals, capacity*sizeof(int));
+                }
+
+                (*delays)[count] = delay;
+                (*disposals)[count] = (flags & 0x1c) >> 2;
+                count++;
+            }
+            else
+            {
+                // Extension, graphic control extension defines following frames delay and disposal mode
+                if (stbi__get8(&context) == 0xf9)
+                {
+                    int length = stbi__get8(&context);
+
+                    if (length == 4)
+                    {
+                        flags = stbi__get8(&context);
+                        delay = 10*stbi__get16le(&context);
+                        stbi__skip(&context, 1);
+                    }
+                    else stbi__skip(&context, length);
+                }
+
+                for (int length = stbi__get8(&context); length != 0; length = stbi__get8(&context)) stbi__skip(&context, length);
+            }
+        }
+    }
+
+    RL_FREE(gif);
+
+    return count;
+}
+
+// Decode next GIF frame into decoder canvas, optionally restarting from first frame
+// NOTE: Restore to previous disposal uses the canvas before previous frame was drawn (decoder background)
+static bool DecodeAnimatedImageFrame(AnimatedImageDecoder *decoder, bool rewind)
+{
+    if (rewind)
+    {
+        RL_FREE(decoder->gif.out);
+        RL_FREE(decoder->gif.background);
+        RL_FREE(decoder->gif.history);
+        memset(&decoder->gif, 0, sizeof(stbi__gif));
+
+        stbi__start_mem(&decoder->context, decoder->fileData, decoder->dataSize);
+    }
+
+    int comp = 0;
+    stbi_uc *result = stbi__gif_load_next(&decoder->context, &decoder->gif, &comp, 4, decoder->gif.background);
+
+    return ((result != NULL) && (result != (stbi_uc *)&decoder->context));
+}
+#endif
+
+// Load texture from mapped GPU texture file (DDS, PKM, KTX, PVR, ASTC), levels data is uploaded from mapped file
+// NOTE: Returns false if file is not a GPU texture file, it can not be mapped or its data requires conversion,
+// KTX levels data is interleaved with levels size, multiple levels are gathered into one buffer (single copy)
+static bool LoadTextureFromMappedFile(const char *fileName, Texture2D *texture)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if (!IsFileExtension(fileName, ".dds;.pkm;.ktx;.pvr;.astc")) return false;
+
+    int fileSize = GetFileLength(fileName);
+    void *handle = NULL;
+    unsigned char *fileData = (fileSize > 0)? MapFileData(fileName, fileSize, false, &handle) : NULL;
+    TextureFileLayout layout = { 0 };
+
+    if ((fileData != NULL) && GetTextureFileLayout(fileName, fileData, fileSize, &layout))
+    {
+        const unsigned char *pixels = fileData + layout.offset + (layout.sizePrefixed? 4 : 0);
+        unsigned char *levels = NULL;
+
+        if (!layout.contiguous)
+        {
+            // Gather levels data skipping levels size, small levels are zero padded to expected size
+            int dataSize = 0;
+            for (int i = 0; i < layout.mipmaps; i++) dataSize += GetPixelDataSize((layout.width >> i) > 1? layout.width >> i : 1, (layout.height >> i) > 1? layout.height >> i : 1, layout.format);
+
+            levels = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+            for (int i = 0, offset = layout.offset, position = 0; i < layout.mipmaps; i++)
+            {
+                int levelSize = GetPixelDataSize((layout.width >> i) > 1? layout.width >> i : 1, (layout.height >> i) > 1? layout.height >> i : 1, layout.format);
+                unsigned int imageSize = 0;
+
+                memcpy(&imageSize, fileData + offset, 4);
+                memcpy(levels + position, fileData + offset + 4, ((int)imageSize < levelSize)? (int)imageSize : levelSize);
+                position += levelSize;
+                offset += 4 + (((int)imageSize + 3) & ~3);
+            }
+
+            pixels = levels;
+        }
+
+        texture->id = rlLoadTexture(pixels, layout.width, layout.height, layout.format, layout.mipmaps);
+        texture->width = layout.width;
+        texture->height = layout.height;
+        texture->mipmaps = layout.mipmaps;
+        texture->format = layout.format;
+
+        RL_FREE(levels);
+        result = true;
+    }
+
+    UnmapFileData(fileData, fileSize, handle);
+#endif
+
+    return result;
+}
+
+// Get GPU texture file data layout, returns false if not valid, not supported or data requires conversion
+// NOTE: Formats and header fields are interpreted as rl_gputex loaders, levels data must fit in file data
+static bool GetTextureFileLayout(const char *fileName, const unsigned char *fileData, int fileSize, TextureFileLayout *layout)
+{
+    unsigned int header[31] = { 0 };
+
+    memset(layout, 0, sizeof(TextureFileLayout));
+    layout->mipmaps = 1;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds") && (fileSize >= 128) && (memcmp(fileData, "DDS ", 4) == 0))
+    {
+        // DDS header: height [2], width [3], mipmaps [6], pixel format flags [19], fourcc [20], bits per pixel [21]
+        // NOTE: Formats with alpha come in ARGB order, they are converted by rl_load_dds_from_memory()
+        memcpy(header, fileData + 4, 124);
+
+        layout->width = (int)header[3];
+        layout->height = (int)header[2];
+        layout->mipmaps = (header[6] > 0)? (int)header[6] : 1;
+        layout->offset = 128;
+
+        if ((header[21] == 16) && (header[19] == 0x40)) layout->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        else if ((header[21] == 24) && (header[19] == 0x40)) layout->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+        else if ((header[19] == 0x04) || (header[19] == 0x05))
+        {
+            if (header[20] == 0x31545844) layout->format = (header[19] == 0x04)? PIXELFORMAT_COMPRESSED_DXT1_RGB : PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+            else if (header[20] == 0x33545844) layout->format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+            else if (header[20] == 0x35545844) layout->format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PKM)
+    else if (IsFileExtension(fileName, ".pkm") && (fileSize >= 16) && (memcmp(fileData, "PKM ", 4) == 0))
+    {
+        // PKM header: format, width and height (big-endian), single level
+        int format = (fileData[6] << 8) | fileData[7];
+
+        layout->width = (fileData[8] << 8) | fileData[9];
+        layout->height = (fileData[10] << 8) | fileData[11];
+        layout->offset = 16;
+
+        if (format == 0) layout->format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+        else if (format == 1) layout->format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+        else if (format == 3) layout->format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (IsFileExtension(fileName, ".ktx") && (fileSize >= 64) && (memcmp(fileData + 1, "KTX 11", 6) == 0))
+    {
+        // KTX 1.1 header: internal format [4], width [6], height [7], array elements [9], faces [10], mipmaps [11], key/value data size [12]
+        memcpy(header, fileData + 12, 52);
+
+        layout->width = (int)header[6];
+        layout->height = (int)header[7];
+        layout->mipmaps = (header[11] > 0)? (int)header[11] : 1;
+        layout->offset = 64 + (int)header[12];
+        layout->sizePrefixed = true;
+
+        if ((header[9] <= 1) && (header[10] <= 1) && (header[12] <= (unsigned int)fileSize))
+        {
+            if (header[4] == 0x8D64) layout->format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+            else if (header[4] == 0x9274) layout->format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+            else if (header[4] == 0x9278) layout->format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_PVR)
+    else if (IsFileExtension(fileName, ".pvr") && (fileSize >= 52) && (memcmp(fileData, "PVR\3", 4) == 0))
+    {
+        // PVR 3 header: channels [2], channels depth [3], height [6], width [7], surfaces [9], faces [10], mipmaps [11], metadata size [12]
+        // NOTE: Levels are contiguous for a single surface and face
+        const unsigned char *channels = fileData + 8;
+        const unsigned char *depth = fileData + 12;
+        memcpy(header, fileData, 52);
+
+        layout->width = (int)header[7];
+        layout->height = (int)header[6];
+        layout->mipmaps = (header[11] > 0)? (int)header[11] : 1;
+        layout->offset = 52 + (int)header[12];
+
+        if ((header[9] <= 1) && (header[10] <= 1) && (header[12] <= (unsigned int)fileSize))
+        {
+            if ((channels[0] == 'l') && (channels[1] == 0) && (depth[0] == 8)) layout->format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+            else if ((channels[0] == 'l') && (channels[1] == 'a') && (depth[0] == 8) && (depth[1] == 8)) layout->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+            else if ((channels[0] == 'r') && (channels[1] == 'g') && (channels[2] == 'b'))
+            {
+                if ((channels[3] == 'a') && (depth[0] == 5) && (depth[1] == 5) && (depth[2] == 5) && (depth[3] == 1)) layout->format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                else if ((channels[3] == 'a') && (depth[0] == 4) && (depth[1] == 4) && (depth[2] == 4) && (depth[3] == 4)) layout->format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                else if ((channels[3] == 'a') && (depth[0] == 8) && (depth[1] == 8) && (depth[2] == 8) && (depth[3] == 8)) layout->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                else if ((channels[3] == 0) && (depth[0] == 5) && (depth[1] == 6) && (depth[2] == 5)) layout->format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                else if ((channels[3] == 0) && (depth[0] == 8) && (depth[1] == 8) && (depth[2] == 8)) layout->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            }
+            else if (channels[0] == 2) layout->format = PIXELFORMAT_COMPRESSED_PVRT_RGB;
+            else if (channels[0] == 3) layout->format = PIXELFORMAT_COMPRESSED_PVRT_RGBA;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+    else if (IsFileExtension(fileName, ".astc") && (fileSize >= 16) && (fileData[0] == 0x13) && (fileData[1] == 0xab) && (fileData[2] == 0xa1) && (fileData[3] == 0x5c))
+    {
+        // ASTC header: block size [4..6], width [7..9], height [10..12] (24 bit values), single level
+        layout->width = fileData[7] | (fileData[8] << 8) | (fileData[9] << 16);
+        layout->height = fileData[10] | (fileData[11] << 8) | (fileData[12] << 16);
+        layout->offset = 16;
+
+        if ((fileData[4] == 4) && (fileData[5] == 4)) layout->format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA;
+        else if ((fileData[4] == 8) && (fileData[5] == 8)) layout->format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
+    }
+#endif
+
+    if ((layout->format == 0) || (layout->width <= 0) || (layout->height <= 0) || (layout->mipmaps > 32)) return false;
+
+    // Levels data must fit in file data, KTX levels size is read from file (it can differ from expected size)
+    long long dataEnd = layout->offset;
+    layout->contiguous = !layout->sizePrefixed || (layout->mipmaps == 1);
+
+    for (int i = 0; (i < layout->mipmaps) && (dataEnd <= (long long)fileSize); i++)
+    {
+        int levelSize = GetPixelDataSize((layout->width >> i) > 1? layout->width >> i : 1, (layout->height >> i) > 1? layout->height >> i : 1, layout->format);
+
+        if (layout->sizePrefixed)
+        {
+            unsigned int imageSize = 0;
+
+            if ((dataEnd + 4) <= (long long)fileSize) memcpy(&imageSize, fileData + dataEnd, 4);
+            else return false;
+
+            if (imageSize < (unsigned int)levelSize) layout->contiguous = false;
+
+            dataEnd += 4 + imageSize;
+            if (i < (layout->mipmaps - 1)) dataEnd = (dataEnd + 3) & ~3LL;
+        }
+        else dataEnd += levelSize;
+    }
+
+    return (dataEnd <= (long long)fileSize);
+}
+
+// Load image base level pixels as RGBA32F normalized values
+static float *LoadImageFloatPixels(Image image)
+{
+    float *pixels = (float *)RL_MALLOC((size_t)image.width*image.height*4*sizeof(float));
+    int rowSize = GetPixelDataSize(image.width, 1, image.format);
+
+    for (int y = 0; y < image.height; y++) LoadImageRowNormalized((unsigned char *)image.data + (size_t)y*rowSize, image.format, pixels + (size_t)y*image.width*4, image.width);
+
+    return pixels;
+}
+
+// Load cubemap image (vertical line) for generated levels, levels data is stored with StoreCubemapLevel()
+static Image LoadCubemapImage(int size, int mipmaps, int format)
+{
+    Image image = { 0 };
+
+    int dataSize = 0;
+    for (int i = 0; i < mipmaps; i++) dataSize += GetPixelDataSize(size >> i, 6*(size >> i), format);
+
+    image.data = RL_MALLOC(dataSize);
+    image.width = size;
+    image.height = 6*size;
+    image.mipmaps = mipmaps;
+    image.format = format;
+
+    return image;
+}
+
+// Store generated cubemap level pixels (RGBA32F) into cubemap image
+static void StoreCubemapLevel(Image *image, int level, const float *pixels)
+{
+    unsigned char *data = (unsigned char *)image->data;
+    for (int i = 0; i < level; i++) data += GetPixelDataSize(image->width >> i, 6*(image->width >> i), image->format);
+
+    int count = 6*(image->width >> level)*(image->width >> level)*4;
+
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) memcpy(data, pixels, count*sizeof(float));
+    else
+    {
+        // Values are clamped to [0..1] and rounded
+        float *clamped = (float *)RL_MALLOC(count*sizeof(float));
+        for (int i = 0; i < count; i++) clamped[i] = (pixels[i] < 0.0f)? 0.0f : (pixels[i] > 1.0f)? 1.0f : pixels[i] + 0.5f/255.0f;
+
+        FloatToUnorm8Array(clamped, data, count);
+        RL_FREE(clamped);
+    }
+}
+
+// Load source cubemap levels down to minimum size (0 for base level only), returns levels count
+// NOTE: Cubemap is expected as faces in a vertical line, levels are 2x2 box downsampled per face
+static int LoadCubemapLevels(CubemapPass *pass, Image cubemap, int minSize)
+{
+    if ((cubemap.data == NULL) || (cubemap.width <= 0) || (cubemap.height != 6*cubemap.width) || (cubemap.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Cubemap processing requires an uncompressed cubemap image with faces in a vertical line");
+        return 0;
+    }
+
+    pass->levels[0] = LoadImageFloatPixels(cubemap);
+    pass->levelSizes[0] = cubemap.width;
+    pass->levelCount = 1;
+    pass->type = CUBEMAP_PASS_DOWNSAMPLE;
+
+    while ((pass->levelCount < CUBEMAP_MAX_LEVELS) && (pass->levelSizes[pass->levelCount - 1] > minSize) && (minSize > 0) && (pass->levelSizes[pass->levelCount - 1] > 1))
+    {
+        int size = pass->levelSizes[pass->levelCount - 1]/2;
+
+        pass->size = size;
+        pass->output = (float *)RL_MALLOC((size_t)6*size*size*4*sizeof(float));
+
+        int minRows = GENERATION_BATCH_PIXELS/size;
+        ParallelFor(6*size, (minRows > 1)? minRows : 1, GenCubemapRows, pass);
+
+        pass->levels[pass->levelCount] = pass->output;
+        pass->levelSizes[pass->levelCount] = size;
+        pass->levelCount++;
+    }
+
+    pass->output = NULL;
+
+    return pass->levelCount;
+}
+
+// Generate a range of cubemap faces rows (ParallelFor() task)
+// NOTE: Texels directions are face normal + s*(face s direction) + t*(face t direction), s and t in [-1..1]
+static void GenCubemapRows(int start, int end, void *userData)
+{
+    CubemapPass *pass = (CubemapPass *)userData;
+    const int size = pass->size;
+    const float scale = 2.0f/(float)size;
+
+    for (int row = start; row < end; row++)
+    {
+        const float *axes = cubemapFaceAxes[row/size];
+        float t = ((float)(row%size) + 0.5f)*scale - 1.0f;
+        float *dst = (pass->output != NULL)? pass->output + (size_t)row*size*4 : NULL;
+
+        switch (pass->type)
+        {
+            case CUBEMAP_PASS_PANORAMA:
+            {
+                // Direction angles don't require normalized directions
+                float baseX = axes[0] + t*axes[6];
+                float baseY = axes[1] + t*axes[7];
+                float baseZ = axes[2] + t*axes[8];
+                float scaleU = (float)pass->panoramaWidth/(2.0f*PI);
+                float scaleV = (float)pass->panoramaHeight/PI;
+                int x = 0;
+
+            #if defined(RTEXTURES_SIMD_SSE2)
+                for (; x + 4 <= size; x += 4)
+                {
+                    const __m128 signMask = _mm_set1_ps(-0.0f);
+                    __m128 s = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(_mm_setr_epi32(x, x + 1, x + 2, x + 3)), _mm_set1_ps(0.5f)), _mm_set1_ps(scale)), _mm_set1_ps(1.0f));
+                    __m128 dx = _mm_add_ps(_mm_set1_ps(baseX), _mm_mul_ps(s, _mm_set1_ps(axes[3])));
+                    __m128 dy = _mm_add_ps(_mm_set1_ps(baseY), _mm_mul_ps(s, _mm_set1_ps(axes[4])));
+                    __m128 dz = _mm_add_ps(_mm_set1_ps(baseZ), _mm_mul_ps(s, _mm_set1_ps(axes[5])));
+                    __m128 horizontal = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz)));
+                    __m128 angles[2] = { 0 };
+
+                    // Longitude atan2(z, x) and latitude atan2(y, horizontal), same approximation as Atan2Approx()
+                    for (int k = 0; k < 2; k++)
+                    {
+                        __m128 ay = _mm_andnot_ps(signMask, (k == 0)? dz : dy);
+                        __m128 ax = _mm_andnot_ps(signMask, (k == 0)? dx : horizontal);
+                        __m128 mx = _mm_max_ps(ax, ay);
+                        __m128 a = _mm_and_ps(_mm_div_ps(_mm_min_ps(ax, ay), mx), _mm_cmpgt_ps(mx, _mm_setzero_ps()));
+                        __m128 a2 = _mm_mul_ps(a, a);
+                        __m128 r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(-0.0464964749f), a2), _mm_set1_ps(0.15931422f)), a2), _mm_set1_ps(0.327622764f)), a2), a), a);
+                        __m128 swap = _mm_cmpgt_ps(ay, ax);
+                        r = _mm_or_ps(_mm_and_ps(swap, _mm_sub_ps(_mm_set1_ps(1.57079637f), r)), _mm_andnot_ps(swap, r));
+                        __m128 back = _mm_cmplt_ps((k == 0)? dx : horizontal, _mm_setzero_ps());
+                        r = _mm_or_ps(_mm_and_ps(back, _mm_sub_ps(_mm_set1_ps(3.14159274f), r)), _mm_andnot_ps(back, r));
+                        __m128 negative = _mm_cmplt_ps((k == 0)? dz : dy, _mm_setzero_ps());
+                        angles[k] = _mm_or_ps(_mm_and_ps(negative, _mm_sub_ps(_mm_setzero_ps(), r)), _mm_andnot_ps(negative, r));
+                    }
+
+                    float u[4], v[4];
+                    _mm_storeu_ps(u, _mm_sub_ps(_mm_add_ps(_mm_mul_ps(angles[0], _mm_set1_ps(scaleU)), _mm_set1_ps(0.5f*pass->panoramaWidth)), _mm_set1_ps(0.5f)));
+                    _mm_storeu_ps(v, _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f*pass->panoramaHeight), _mm_mul_ps(angles[1], _mm_set1_ps(scaleV))), _mm_set1_ps(0.5f)));
+
+                    for (int k = 0; k < 4; k++) SamplePanorama(pass, u[k], v[k], dst + (x + k)*4);
+                }
+            #endif
+                for (; x < size; x++)
+                {
+                    float s = ((float)x + 0.5f)*scale - 1.0f;
+                    float dx = baseX + s*axes[3];
+                    float dy = baseY + s*axes[4];
+                    float dz = baseZ + s*axes[5];
+
+                    float u = Atan2Approx(dz, dx)*scaleU + 0.5f*pass->panoramaWidth - 0.5f;
+                    float v = 0.5f*pass->panoramaHeight - Atan2Approx(dy, sqrtf(dx*dx + dz*dz))*scaleV - 0.5f;
+
+                    SamplePanorama(pass, u, v, dst + x*4);
+                }
+            } break;
+            case CUBEMAP_PASS_DOWNSAMPLE:
+            {
+                const float *src = pass->levels[pass->levelCount - 1];
+                int srcSize = pass->levelSizes[pass->levelCount - 1];
+                int face = row/size;
+                int y0 = 2*(row%size);
+                int y1 = (y0 + 1 < srcSize)? y0 + 1 : srcSize - 1;
+                const float *row0 = src + ((size_t)face*srcSize + y0)*srcSize*4;
+                const float *row1 = src + ((size_t)face*srcSize + y1)*srcSize*4;
+
+                for (int x = 0; x < size; x++)
+                {
+                    int x0 = 2*x*4;
+                    int x1 = (2*x + 1 < srcSize)? x0 + 4 : x0;
+
+                    for (int c = 0; c < 4; c++) dst[x*4 + c] = (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c])*0.25f;
+                }
+            } break;
+            case CUBEMAP_PASS_PROJECT:
+            {
+                // Texels are weighted by solid angle: texel area/(1 + s^2 + t^2)^(3/2)
+                const float *src = pass->levels[0] + (size_t)row*size*4;
+                float *sums = pass->projection + (size_t)row*36;
+                float basis[9] = { 0 };
+
+                memset(sums, 0, 36*sizeof(float));
+
+                for (int x = 0; x < size; x++)
+                {
+                    float s = ((float)x + 0.5f)*scale - 1.0f;
+                    float lengthSqr = 1.0f + s*s + t*t;
+                    float invLength = 1.0f/sqrtf(lengthSqr);
+                    float solidAngle = scale*scale*invLength/lengthSqr;
+                    float direction[3] = {
+                        (axes[0] + s*axes[3] + t*axes[6])*invLength,
+                        (axes[1] + s*axes[4] + t*axes[7])*invLength,
+                        (axes[2] + s*axes[5] + t*axes[8])*invLength };
+
+                    GetSHBasis(direction, basis);
+
+                    for (int k = 0; k < 9; k++)
+                    {
+                        float weight = basis[k]*solidAngle;
+                        for (int c = 0; c < 4; c++) sums[k*4 + c] += src[x*4 + c]*weight;
+                    }
+                }
+            } break;
+            case CUBEMAP_PASS_IRRADIANCE:
+            {
+                float basis[9] = { 0 };
+
+                for (int x = 0; x < size; x++)
+                {
+                    float s = ((float)x + 0.5f)*scale - 1.0f;
+                    float invLength = 1.0f/sqrtf(1.0f + s*s + t*t);
+                    float direction[3] = {
+                        (axes[0] + s*axes[3] + t*axes[6])*invLength,
+                        (axes[1] + s*axes[4] + t*axes[7])*invLength,
+                        (axes[2] + s*axes[5] + t*axes[8])*invLength };
+
+                    GetSHBasis(direction, basis);
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        float value = 0.0f;
+                        for (int k = 0; k < 9; k++) value += pass->sh[k][c]*basis[k];
+                        dst[x*4 + c] = (value > 0.0f)? value : 0.0f;
+                    }
+
+                    dst[x*4 + 3] = 1.0f;
+                }
+            } break;
+            case CUBEMAP_PASS_PREFILTER:
+            {
+                for (int x = 0; x < size; x++)
+                {
+                    float s = ((float)x + 0.5f)*scale - 1.0f;
+                    float invLength = 1.0f/sqrtf(1.0f + s*s + t*t);
+                    float normal[3] = {
+                        (axes[0] + s*axes[3] + t*axes[6])*invLength,
+                        (axes[1] + s*axes[4] + t*axes[7])*invLength,
+                        (axes[2] + s*axes[5] + t*axes[8])*invLength };
+
+                    // Tangent frame around normal
+                    float up[3] = { 0.0f, 0.0f, 1.0f };
+                    if (fabsf(normal[2]) >= 0.999f) { up[0] = 1.0f; up[2] = 0.0f; }
+
+                    float tangent[3] = { up[1]*normal[2] - up[2]*normal[1], up[2]*normal[0] - up[0]*normal[2], up[0]*normal[1] - up[1]*normal[0] };
+                    float invTangentLength = 1.0f/sqrtf(tangent[0]*tangent[0] + tangent[1]*tangent[1] + tangent[2]*tangent[2]);
+                    for (int k = 0; k < 3; k++) tangent[k] *= invTangentLength;
+                    float bitangent[3] = { normal[1]*tangent[2] - normal[2]*tangent[1], normal[2]*tangent[0] - normal[0]*tangent[2], normal[0]*tangent[1] - normal[1]*tangent[0] };
+
+                    float sum[4] = { 0 };
+                    float weight = 0.0f;
+
+                    for (int i = 0; i < pass->sampleCount; i++)
+                    {
+                        const float *sample = pass->samples + i*5;
+                        float direction[3] = { 0 };
+                        float color[4] = { 0 };
+
+                        for (int k = 0; k < 3; k++) direction[k] = tangent[k]*sample[0] + bitangent[k]*sample[1] + normal[k]*sample[2];
+
+                        SampleCubemap(pass, direction, sample[4], color);
+
+                        for (int c = 0; c < 4; c++) sum[c] += color[c]*sample[3];
+                        weight += sample[3];
+                    }
+
+                    for (int c = 0; c < 4; c++) dst[x*4 + c] = sum[c]/weight;
+                }
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Compute atan2() approximation (max error 1e-5 radians), minimax polynomial on [0..1] octant
+static float Atan2Approx(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float mx = (ax > ay)? ax : ay;
+    float a = (mx > 0.0f)? ((ax > ay)? ay : ax)/mx : 0.0f;
+    float a2 = a*a;
+    float result = ((-0.0464964749f*a2 + 0.15931422f)*a2 - 0.327622764f)*a2*a + a;
+
+    if (ay > ax) result = 1.57079637f - result;
+    if (x < 0.0f) result = 3.14159274f - result;
+    if (y < 0.0f) result = -result;
+
+    return result;
+}
+
+// Blend RGBA32F texels (bilinear)
+static void BlendTexelsBilinear(const float *t00, const float *t10, const float *t01, const float *t11, float wx, float wy, float *color)
+{
+#if defined(RTEXTURES_SIMD_SSE2)
+    __m128 a = _mm_loadu_ps(t00);
+    __m128 b = _mm_loadu_ps(t01);
+    __m128 top = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(t10), a), _mm_set1_ps(wx)));
+    __m128 bottom = _mm_add_ps(b, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(t11), b), _mm_set1_ps(wx)));
+
+    _mm_storeu_ps(color, _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(wy))));
+#elif defined(RTEXTURES_SIMD_NEON)
+    float32x4_t a = vld1q_f32(t00);
+    float32x4_t b = vld1q_f32(t01);
+    float32x4_t top = vaddq_f32(a, vmulq_n_f32(vsubq_f32(vld1q_f32(t10), a), wx));
+    float32x4_t bottom = vaddq_f32(b, vmulq_n_f32(vsubq_f32(vld1q_f32(t11), b), wx));
+
+    vst1q_f32(color, vaddq_f32(top, vmulq_n_f32(vsubq_f32(bottom, top), wy)));
+#else
+    for (int c = 0; c < 4; c++)
+    {
+        float top = t00[c] + (t10[c] - t00[c])*wx;
+        float bottom = t01[c] + (t11[c] - t01[c])*wx;
+
+        color[c] = top + (bottom - top)*wy;
+    }
+#endif
+}
+
+// Sample panorama (bilinear, horizontal wrap, vertical clamp), u and v in pixels
+static void SamplePanorama(const CubemapPass *pass, float u, float v, float *color)
+{
+    const int width = pass->panoramaWidth;
+    const int height = pass->panoramaHeight;
+    float fx = floorf(u);
+    float fy = floorf(v);
+
+    int x0 = (int)fx%width;
+    if (x0 < 0) x0 += width;
+    int x1 = (x0 + 1 < width)? x0 + 1 : 0;
+    int y0 = (int)fy;
+    int y1 = (y0 + 1 < height)? y0 + 1 : height - 1;
+    if (y0 < 0) y0 = 0;
+    if (y1 < 0) y1 = 0;
+    if (y0 > height - 1) y0 = height - 1;
+
+    const float *row0 = pass->panorama + (size_t)y0*width*4;
+    const float *row1 = pass->panorama + (size_t)y1*width*4;
+
+    BlendTexelsBilinear(row0 + x0*4, row0 + x1*4, row1 + x0*4, row1 + x1*4, u - fx, v - fy, color);
+}
+
+// Sample source cubemap by direction (trilinear between source levels, bilinear clamped at faces edges)
+static void SampleCubemap(const CubemapPass *pass, const float *direction, float level, float *color)
+{
+    float ax = fabsf(direction[0]);
+    float ay = fabsf(direction[1]);
+    float az = fabsf(direction[2]);
+    int face = 0;
+    float ma = 0.0f, s = 0.0f, t = 0.0f;
+
+    // Face selection by major axis, s and t following cubemapFaceAxes
+    if ((ax >= ay) && (ax >= az)) { face = (direction[0] > 0.0f)? 0 : 1; ma = ax; s = (direction[0] > 0.0f)? -direction[2] : direction[2]; t = -direction[1]; }
+    else if (ay >= az) { face = (direction[1] > 0.0f)? 2 : 3; ma = ay; s = direction[0]; t = (direction[1] > 0.0f)? direction[2] : -direction[2]; }
+    else { face = (direction[2] > 0.0f)? 4 : 5; ma = az; s = (direction[2] > 0.0f)? direction[0] : -direction[0]; t = -direction[1]; }
+
+    if (level > (float)(pass->levelCount - 1)) level = (float)(pass->levelCount - 1);
+    int level0 = (int)level;
+    float levelWeight = level - (float)level0;
+
+    for (int i = 0; i < ((levelWeight > 0.0f)? 2 : 1); i++)
+    {
+        const int size = pass->levelSizes[level0 + i];
+        float u = (s/ma + 1.0f)*0.5f*size - 0.5f;
+        float v = (t/ma + 1.0f)*0.5f*size - 0.5f;
+        if (u < 0.0f) u = 0.0f;
+        if (v < 0.0f) v = 0.0f;
+        if (u > (float)(size - 1)) u = (float)(size - 1);
+        if (v > (float)(size - 1)) v = (float)(size - 1);
+
+        int x0 = (int)u;
+        int y0 = (int)v;
+        int x1 = (x0 + 1 < size)? x0 + 1 : x0;
+        int y1 = (y0 + 1 < size)? y0 + 1 : y0;
+        const float *texels = pass->levels[level0 + i] + (size_t)face*size*size*4;
+        float texel[4] = { 0 };
+
+        BlendTexelsBilinear(texels + (y0*size + x0)*4, texels + (y0*size + x1)*4, texels + (y1*size + x0)*4, texels + (y1*size + x1)*4, u - (float)x0, v - (float)y0, texel);
+
+        if (i == 0) memcpy(color, texel, 4*sizeof(float));
+        else for (int c = 0; c < 4; c++) color[c] += (texel[c] - color[c])*levelWeight;
+    }
+}
+
+// Get spherical harmonics basis (9 coefficients, bands 0 to 2) for normalized direction
+static void GetSHBasis(const float *direction, float *basis)
+{
+    float x = direction[0];
+    float y = direction[1];
+    float z = direction[2];
+
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f*y;
+    basis[2] = 0.488603f*z;
+    basis[3] = 0.488603f*x;
+    basis[4] = 1.092548f*x*y;
+    basis[5] = 1.092548f*y*z;
+    basis[6] = 0.315392f*(3.0f*z*z - 1.0f);
+    basis[7] = 1.092548f*x*z;
+    basis[8] = 0.546274f*(x*x - y*y);
+}
+
+// Premultiply RGBA8 pixels color by alpha, rounded: (color*alpha + 127)/255
+static void PremultiplyColors(unsigned char *pixels, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i colorLanes = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i half = _mm_set1_epi16(128);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + i*4));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+        // Multiply color by alpha and alpha by 255 (alpha kept)
+        __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, _mm_or_si128(_mm_and_si128(alphaLo, colorLanes), alphaLanes)), half);
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, _mm_or_si128(_mm_and_si128(alphaHi, colorLanes), alphaLanes)), half);
+
+        // Divide by 255: (value + (value >> 8)) >> 8, value already including rounding
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t v = vld4_u8(pixels + i*4);
+
+        // Divide by 255 rounded: (value + ((value + 128) >> 8) + 128) >> 8
+        uint16x8_t r = vmull_u8(v.val[0], v.val[3]);
+        uint16x8_t g = vmull_u8(v.val[1], v.val[3]);
+        uint16x8_t b = vmull_u8(v.val[2], v.val[3]);
+        v.val[0] = vraddhn_u16(r, vrshrq_n_u16(r, 8));
+        v.val[1] = vraddhn_u16(g, vrshrq_n_u16(g, 8));
+        v.val[2] = vraddhn_u16(b, vrshrq_n_u16(b, 8));
+
+        vst4_u8(pixels + i*4, v);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned char *pixel = pixels + i*4;
+
+        for (int c = 0; c < 3; c++)
+        {
+            int value = pixel[c]*pixel[3] + 128;
+            pixel[c] = (unsigned char)((value + (value >> 8)) >> 8);
+        }
+    }
+}
+
+// Unpremultiply RGBA8 pixels color by alpha, rounded: (color*255 + alpha/2)/alpha
+// NOTE: Division is replaced by reciprocals lookup table: (color*((255 << 16)/alpha + 1) + 0x8000) >> 16, exact for 8 bit values
+static void UnpremultiplyColors(unsigned char *pixels, int count)
+{
+    unsigned int reciprocals[256] = { 0 };
+    for (int a = 1; a < 256; a++) reciprocals[a] = (255u << 16)/a + 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char *pixel = pixels + i*4;
+
+        if ((pixel[3] > 0) && (pixel[3] < 255))
+        {
+            unsigned int reciprocal = reciprocals[pixel[3]];
+
+            for (int c = 0; c < 3; c++)
+            {
+                unsigned int value = (pixel[c]*reciprocal + 0x8000) >> 16;
+                pixel[c] = (unsigned char)((value > 255)? 255 : value);
+            }
+        }
+    }
+}
+
+// Set RGBA8 pixels with alpha under or equal threshold to color
+static void ClearAlphaColors(unsigned char *pixels, int count, Color color, unsigned char threshold)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    // NOTE: Alpha over threshold is checked with saturated subtraction, color channels saturated to 0
+    const __m128i limit = _mm_set1_epi32((int)(0x00ffffffu | ((unsigned int)threshold << 24)));
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i fill = _mm_set1_epi32(0);
+    memcpy(&fill, &color, sizeof(Color));
+    fill = _mm_shuffle_epi32(fill, _MM_SHUFFLE(0, 0, 0, 0));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + i*4));
+        __m128i clear = _mm_cmpeq_epi32(_mm_and_si128(_mm_subs_epu8(v, limit), alphaMask), zero);
+
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_or_si128(_mm_and_si128(clear, fill), _mm_andnot_si128(clear, v)));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    uint32_t fillValue = 0;
+    memcpy(&fillValue, &color, sizeof(Color));
+    const uint32x4_t fill = vdupq_n_u32(fillValue);
+    const uint32x4_t limit = vdupq_n_u32(threshold);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t v = vreinterpretq_u32_u8(vld1q_u8(pixels + i*4));
+        uint32x4_t clear = vcleq_u32(vshrq_n_u32(v, 24), limit);
+
+        vst1q_u8(pixels + i*4, vreinterpretq_u8_u32(vbslq_u32(clear, fill, v)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (pixels[i*4 + 3] <= threshold) memcpy(pixels + i*4, &color, sizeof(Color));
+    }
+}
+
+// Set pixels alpha from grayscale mask, alpha is the last of pixel channels (GRAY_ALPHA or RGBA8)
+static void MergeAlphaMask(unsigned char *pixels, const unsigned char *mask, int count, int channels)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    if (channels == 4)
+    {
+        const __m128i colorMask = _mm_set1_epi32(0x00ffffff);
+
+        for (; i + 16 <= count; i += 16)
+        {
+            // Mask values moved to pixels alpha bytes: value << 24
+            __m128i m = _mm_loadu_si128((const __m128i *)(mask + i));
+            __m128i lo = _mm_unpacklo_epi8(zero, m);
+            __m128i hi = _mm_unpackhi_epi8(zero, m);
+            __m128i alpha[4] = { _mm_unpacklo_epi16(zero, lo), _mm_unpackhi_epi16(zero, lo), _mm_unpacklo_epi16(zero, hi), _mm_unpackhi_epi16(zero, hi) };
+
+            for (int k = 0; k < 4; k++)
+            {
+                __m128i *dst = (__m128i *)(pixels + (i + k*4)*4);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(dst), colorMask), alpha[k]));
+            }
+        }
+    }
+    else
+    {
+        const __m128i colorMask = _mm_set1_epi16(0x00ff);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i *dst = (__m128i *)(pixels + i*2);
+            __m128i alpha = _mm_unpacklo_epi8(zero, _mm_loadl_epi64((const __m128i *)(mask + i)));
+
+            _mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(dst), colorMask), alpha));
+        }
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    if (channels == 4)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x4_t v = vld4q_u8(pixels + i*4);
+            v.val[3] = vld1q_u8(mask + i);
+            vst4q_u8(pixels + i*4, v);
+        }
+    }
+    else
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x2_t v = vld2q_u8(pixels + i*2);
+            v.val[1] = vld1q_u8(mask + i);
+            vst2q_u8(pixels + i*2, v);
+        }
+    }
+#endif
+
+    for (; i < count; i++) pixels[i*channels + channels - 1] = mask[i];
+}
+
+// Find first pixel in image row range [start, end) with alpha over threshold, range is scanned backwards if start > end
+// NOTE: Returns pixel x position, -1 if not found
+static int FindImageAlphaPixel(Image image, int y, int start, int end, unsigned char threshold)
+{
+    int step = (end > start)? 1 : -1;
+    int x = start;
+    int offset = y*image.width;
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        const unsigned char *pixels = (const unsigned char *)image.data + offset*4;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+        // NOTE: Alpha over threshold is checked with saturated subtraction, color channels saturated to 0
+        const __m128i limit = _mm_set1_epi32((int)(0x00ffffffu | ((unsigned int)threshold << 24)));
+        const __m128i zero = _mm_setzero_si128();
+
+        // Blocks of 4 pixels are checked, pixel found in block scalar loop
+        for (; (step > 0)? (x + 4 <= end) : (x - 4 >= end); x += step*4)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(pixels + ((step > 0)? x : x - 3)*4));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(v, limit), zero)) != 0xffff) break;
+        }
+#elif defined(RTEXTURES_SIMD_NEON)
+        const uint32x4_t limit = vdupq_n_u32(threshold);
+
+        for (; (step > 0)? (x + 4 <= end) : (x - 4 >= end); x += step*4)
+        {
+            uint32x4_t found = vcgtq_u32(vshrq_n_u32(vreinterpretq_u32_u8(vld1q_u8(pixels + ((step > 0)? x : x - 3)*4)), 24), limit);
+            uint32x2_t any = vorr_u32(vget_low_u32(found), vget_high_u32(found));
+            if ((vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) != 0) break;
+        }
+#endif
+        for (; x != end; x += step) if (pixels[x*4 + 3] > threshold) return x;
+    }
+    else
+    {
+        for (; x != end; x += step) if (GetPixelAlpha(image.data, image.format, offset + x) > threshold) return x;
+    }
+
+    return -1;
+}
+
+// Get pixel alpha (8 bit) from uncompressed pixel data, formats without alpha channel are opaque
+// NOTE: Alpha is converted as LoadImageColors() does
+static unsigned char GetPixelAlpha(const void *data, int format, int index)
+{
+    unsigned char alpha = 255;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: alpha = ((const unsigned char *)data)[index*2 + 1]; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: alpha = (((const unsigned short *)data)[index] & 0x0001)? 255 : 0; break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: alpha = (unsigned char)((((const unsigned short *)data)[index] & 0x000f)*17); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: alpha = ((const unsigned char *)data)[index*4 + 3]; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            float value = ((const float *)data)[index*4 + 3];
+            alpha = (unsigned char)(((value < 0.0f)? 0.0f : (value > 1.0f)? 1.0f : value)*255.0f);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            float value = HalfToFloat(((const unsigned short *)data)[index*4 + 3]);
+            alpha = (unsigned char)(((value < 0.0f)? 0.0f : (value > 1.0f)? 1.0f : value)*255.0f);
+        } break;
+        default: break;
+    }
+
+    return alpha;
+}
+
+// Compute median cut box bounds and pixels count
+static void QuantizeBoxBounds(QuantizeBox *box, const unsigned short *bins, const unsigned int *histogram)
+{
+    const int mask = (1 << QUANTIZE_HISTOGRAM_BITS) - 1;
+
+    box->pixels = 0;
+    for (int c = 0; c < 3; c++) { box->min[c] = (unsigned char)mask; box->max[c] = 0; }
+
+    for (int i = box->start; i < (box->start + box->count); i++)
+    {
+        unsigned char coord[3] = { (unsigned char)(bins[i] >> (2*QUANTIZE_HISTOGRAM_BITS)), (unsigned char)((bins[i] >> QUANTIZE_HISTOGRAM_BITS) & mask), (unsigned char)(bins[i] & mask) };
+
+        for (int c = 0; c < 3; c++)
+        {
+            if (coord[c] < box->min[c]) box->min[c] = coord[c];
+            if (coord[c] > box->max[c]) box->max[c] = coord[c];
+        }
+
+        box->pixels += histogram[bins[i]*4];
+    }
+}
+
+// Find nearest palette color for a range of histogram bins (ParallelFor() task)
+// NOTE: Bins are compared by their center color
+static void QuantizeLookup(int start, int end, void *userData)
+{
+    QuantizePass *pass = (QuantizePass *)userData;
+    const int shift = 8 - QUANTIZE_HISTOGRAM_BITS;
+    const int mask = (1 << QUANTIZE_HISTOGRAM_BITS) - 1;
+
+    for (int i = start; i < end; i++)
+    {
+        int r = (((i >> (2*QUANTIZE_HISTOGRAM_BITS)) & mask) << shift) + (1 << (shift - 1));
+        int g = (((i >> QUANTIZE_HISTOGRAM_BITS) & mask) << shift) + (1 << (shift - 1));
+        int b = ((i & mask) << shift) + (1 << (shift - 1));
+
+        int nearest = 0;
+        int minDistance = 0x7fffffff;
+
+        for (int j = 0; j < pass->paletteSize; j++)
+        {
+            int dr = r - pass->palette[j].r;
+            int dg = g - pass->palette[j].g;
+            int db = b - pass->palette[j].b;
+            int distance = dr*dr + dg*dg + db*db;
+
+            if (distance < minDistance)
+            {
+                minDistance = distance;
+                nearest = j;
+            }
+        }
+
+        pass->lookup[i] = (unsigned char)nearest;
+    }
+}
+
+// Map a range of image rows to palette colors (ParallelFor() task)
+static void QuantizeRows(int start, int end, void *userData)
+{
+    QuantizePass *pass = (QuantizePass *)userData;
+    const int shift = 8 - QUANTIZE_HISTOGRAM_BITS;
+
+    for (int i = start*pass->width; i < end*pass->width; i++)
+    {
+        Color *pixel = &pass->pixels[i];
+        Color color = pass->palette[pass->lookup[((pixel->r >> shift) << (2*QUANTIZE_HISTOGRAM_BITS)) | ((pixel->g >> shift) << QUANTIZE_HISTOGRAM_BITS) | (pixel->b >> shift)]];
+
+        pixel->r = color.r;
+        pixel->g = color.g;
+        pixel->b = color.b;
+    }
+}
+
+// Allocate async image load request, file name is stored after request data
+static AsyncImageLoad *LoadAsyncImageRequest(const char *fileName)
+{
+    int length = (int)strlen(fileName);
+    AsyncImageLoad *request = (AsyncImageLoad *)RL_CALLOC(1, sizeof(AsyncImageLoad) + length + 1);
+
+    request->fileName = (char *)(request + 1);
+    memcpy(request->fileName, fileName, length);
+
+    return request;
+}
+
+// Load image file (async load step, worker thread)
+static void LoadAsyncImage(void *userData)
+{
+    AsyncImageLoad *request = (AsyncImageLoad *)userData;
+
+    request->image = LoadImage(request->fileName);
+}
+
+// Deliver loaded image or upload it as texture (async finish step, main thread)
+static void FinishAsyncImage(void *userData)
+{
+    AsyncImageLoad *request = (AsyncImageLoad *)userData;
+
+    if (request->dstTexture != NULL)
+    {
+        *request->dstTexture = (Texture2D){ 0 };
+
+        if (request->image.data != NULL) *request->dstTexture = LoadTextureFromImage(request->image);
+        UnloadImage(request->image);
+    }
+    else if (request->dstImage != NULL) *request->dstImage = request->image;
+
+    RL_FREE(request);
+}
+
+// Free loaded image of cancelled load (async release step, main thread)
+// NOTE: Destination is not modified, load did not finish
+static void ReleaseAsyncImage(void *userData)
+{
+    AsyncImageLoad *request = (AsyncImageLoad *)userData;
+
+    UnloadImage(request->image);
+    RL_FREE(request);
+}
+
+// Encode image pixels as PNG file data, using current export options
+// NOTE: Image is encoded in parts (rows ranges) filtered and compressed in parallel, every part is stored as an
+// IDAT chunk, deflate streams are continued across parts and Adler-32 checksums combined for the zlib stream
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    unsigned char *fileData = NULL;
+    *dataSize = 0;
+
+#if defined(RTEXTURES_PNG_ENCODER)
+    static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };   // Grayscale, gray-alpha, RGB, RGBA
+
+    PngEncodePass pass = { 0 };
+    pass.pixels = pixels;
+    pass.width = width;
+    pass.height = height;
+    pass.channels = channels;
+    pass.level = pngCompressionLevel;
+    pass.filter = pngFilterMode;
+
+    long long filteredSize = (long long)(width*channels + 1)*height;
+    pass.partCount = 1;
+    if (pngThreaded)
+    {
+        pass.partCount = GetThreadingWorkerCount();
+        if (pass.partCount > filteredSize/PNG_PART_MIN_SIZE) pass.partCount = (int)(filteredSize/PNG_PART_MIN_SIZE);
+        if (pass.partCount > height) pass.partCount = height;
+        if (pass.partCount < 1) pass.partCount = 1;
+    }
+
+    pass.parts = (PngEncodePart *)RL_CALLOC(pass.partCount, sizeof(PngEncodePart));
+
+    ParallelFor(pass.partCount, 1, EncodePNGParts, &pass);
+
+    // Combine parts Adler-32 checksums (same method as zlib adler32_combine())
+    bool valid = true;
+    unsigned int adler = 1;
+    int size = 8 + 25 + 14 + 16 + 12;   // Signature, IHDR, zlib header IDAT, Adler-32 IDAT, IEND
+
+    for (int i = 0; i < pass.partCount; i++)
+    {
+        if (pass.parts[i].chunk == NULL) { valid = false; continue; }
+
+        unsigned int rem = (unsigned int)(pass.parts[i].filteredSize%65521);
+        unsigned int sum1 = adler & 0xffff;
+        unsigned int sum2 = (rem*sum1)%65521;
+        sum1 += (pass.parts[i].adler & 0xffff) + 65521 - 1;
+        sum2 += (adler >> 16) + (pass.parts[i].adler >> 16) + 65521 - rem;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum2 >= (65521 << 1)) sum2 -= (65521 << 1);
+        if (sum2 >= 65521) sum2 -= 65521;
+        adler = sum1 | (sum2 << 16);
+
+        size += pass.parts[i].chunkSize;
+    }
+
+    if (valid) fileData = (unsigned char *)RL_MALLOC(size);
+
+    if (fileData != NULL)
+    {
+        unsigned char *ptr = fileData;
+        unsigned char header[13] = {
+            (unsigned char)(width >> 24), (unsigned char)(width >> 16), (unsigned char)(width >> 8), (unsigned char)width,
+            (unsigned char)(height >> 24), (unsigned char)(height >> 16), (unsigned char)(height >> 8), (unsigned char)height,
+            8, colorTypes[channels], 0, 0, 0 };
+        unsigned char zlibHeader[2] = { 0x78, 0x01 };
+        unsigned char zlibAdler[4] = { (unsigned char)(adler >> 24), (unsigned char)(adler >> 16), (unsigned char)(adler >> 8), (unsigned char)adler };
+
+        memcpy(ptr, signature, 8); ptr += 8;
+        stbiw__wp32(ptr, 13); stbiw__wptag(ptr, "IHDR"); memcpy(ptr, header, 13); ptr += 13; stbiw__wpcrc(&ptr, 13);
+        stbiw__wp32(ptr, 2); stbiw__wptag(ptr, "IDAT"); memcpy(ptr, zlibHeader, 2); ptr += 2; stbiw__wpcrc(&ptr, 2);
+
+        for (int i = 0; i < pass.partCount; i++)
+        {
+            memcpy(ptr, pass.parts[i].chunk, pass.parts[i].chunkSize);
+            ptr += pass.parts[i].chunkSize;
+        }
+
+        stbiw__wp32(ptr, 4); stbiw__wptag(ptr, "IDAT"); memcpy(ptr, zlibAdler, 4); ptr += 4; stbiw__wpcrc(&ptr, 4);
+        stbiw__wp32(ptr, 0); stbiw__wptag(ptr, "IEND"); stbiw__wpcrc(&ptr, 0);
+
+        *dataSize = size;
+    }
+
+    for (int i = 0; i < pass.partCount; i++) RL_FREE(pass.parts[i].chunk);
+    RL_FREE(pass.parts);
+#else
+    // Fallback to stb_image_write encoder, single threaded
+    stbi_write_png_compression_level = pngCompressionLevel;
+    stbi_write_force_png_filter = (pngFilterMode == PNG_FILTER_NONE)? 0 : ((pngFilterMode == PNG_FILTER_FAST)? 1 : -1);
+
+    fileData = stbi_write_png_to_mem(pixels, width*channels, width, height, channels, dataSize);
+#endif
+
+    return fileData;
+}
+
+#if defined(RTEXTURES_PNG_ENCODER)
+// Filter and compress a range of PNG parts (ParallelFor() task)
+static void EncodePNGParts(int start, int end, void *userData)
+{
+    PngEncodePass *pass = (PngEncodePass *)userData;
+    int rowSize = pass->width*pass->channels;
+
+    struct sdefl *compressor = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+    unsigned char *zeroRow = (unsigned char *)RL_CALLOC(rowSize, 1);
+    unsigned char *trial = (unsigned char *)RL_MALLOC(rowSize + 1);
+
+    for (int p = start; p < end; p++)
+    {
+        PngEncodePart *part = &pass->parts[p];
+        int startRow = (int)((long long)pass->height*p/pass->partCount);
+        int endRow = (int)((long long)pass->height*(p + 1)/pass->partCount);
+
+        part->filteredSize = (rowSize + 1)*(endRow - startRow);
+        unsigned char *filtered = (unsigned char *)RL_MALLOC(part->filteredSize);
+
+        // Filter rows, filters are computed from source pixels so every part is independent
+        for (int y = startRow; y < endRow; y++)
+        {
+            const unsigned char *row = pass->pixels + (size_t)y*rowSize;
+            const unsigned char *prev = (y > 0)? row - rowSize : zeroRow;
+            unsigned char *dst = filtered + (size_t)(y - startRow)*(rowSize + 1);
+
+            if (pass->filter == PNG_FILTER_NONE) FilterPNGRow(row, prev, rowSize, pass->channels, 0, dst);
+            else
+            {
+                // Choose filter with minimum sum of absolute differences: Sub and Up (fast) or all filters (full)
+                int firstFilter = (pass->filter == PNG_FILTER_FAST)? 1 : 0;
+                int lastFilter = (pass->filter == PNG_FILTER_FAST)? 2 : 4;
+                int bestCost = FilterPNGRow(row, prev, rowSize, pass->channels, firstFilter, dst);
+
+                for (int filter = firstFilter + 1; filter <= lastFilter; filter++)
+                {
+                    int cost = FilterPNGRow(row, prev, rowSize, pass->channels, filter, trial);
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        memcpy(dst, trial, rowSize + 1);
+                    }
+                }
+            }
+        }
+
+        // Adler-32 checksum of filtered data (combined for the full zlib stream)
+        unsigned int sum1 = 1, sum2 = 0;
+        for (int i = 0; i < part->filteredSize; )
+        {
+            int blockEnd = ((i + 5552) < part->filteredSize)? (i + 5552) : part->filteredSize;
+            for (; i < blockEnd; i++) { sum1 += filtered[i]; sum2 += sum1; }
+            sum1 %= 65521;
+            sum2 %= 65521;
+        }
+        part->adler = (sum2 << 16) | sum1;
+
+        // Compress filtered data as IDAT chunk: [length][tag][data][crc]
+        part->chunk = (unsigned char *)RL_MALLOC(sdefl_bound(part->filteredSize) + 16);
+        if (part->chunk != NULL)
+        {
+            int compSize = sdeflate_part(compressor, part->chunk + 8, filtered, part->filteredSize, pass->level, (p == (pass->partCount - 1)));
+            unsigned char *ptr = part->chunk;
+
+            stbiw__wp32(ptr, compSize);
+            stbiw__wptag(ptr, "IDAT");
+            ptr += compSize;
+            stbiw__wpcrc(&ptr, compSize);
+
+            part->chunkSize = compSize + 12;
+        }
+
+        RL_FREE(filtered);
+    }
+
+    RL_FREE(trial);
+    RL_FREE(zeroRow);
+    RL_FREE(compressor);
+}
+
+// Filter PNG row (filter type stored as first byte), returns filtered data estimated cost (sum of absolute values)
+static int FilterPNGRow(const unsigned char *row, const unsigned char *prev, int size, int bpp, int filter, unsigned char *dst)
+{
+    int cost = 0;
+    dst[0] = (unsigned char)filter;
+    dst++;
+
+    switch (filter)
+    {
+        case 0: memcpy(dst, row, size); break;
+        case 1:     // Sub
+        {
+            for (int i = 0; i < bpp; i++) dst[i] = row[i];
+            for (int i = bpp; i < size; i++) dst[i] = (unsigned char)(row[i] - row[i - bpp]);
+        } break;
+        case 2:     // Up
+        {
+            for (int i = 0; i < size; i++) dst[i] = (unsigned char)(row[i] - prev[i]);
+        } break;
+        case 3:     // Average
+        {
+            for (int i = 0; i < bpp; i++) dst[i] = (unsigned char)(row[i] - (prev[i] >> 1));
+            for (int i = bpp; i < size; i++) dst[i] = (unsigned char)(row[i] - ((row[i - bpp] + prev[i]) >> 1));
+        } break;
+        case 4:     // Paeth
+        {
+            for (int i = 0; i < bpp; i++) dst[i] = (unsigned char)(row[i] - prev[i]);
+            for (int i = bpp; i < size; i++)
+            {
+                int a = row[i - bpp], b = prev[i], c = prev[i - bpp];
+                int pa = abs(b - c), pb = abs(a - c), pc = abs(a + b - 2*c);
+                int predictor = ((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c);
+                dst[i] = (unsigned char)(row[i] - predictor);
+            }
+        } break;
+        default: break;
+    }
+
+    for (int i = 0; i < size; i++) cost += abs((signed char)dst[i]);
+
+    return cost;
+}
+#endif
+
+// Allocate pixel buffer, reusing a pooled buffer of the same size if available
+static void *LoadImageBuffer(size_t size)
+{
+    void *data = NULL;
+
+    AcquireSpinLock(&imagePool.lock);
+
+    // Most recently released buffers first, they are more likely to be in cache
+    for (int i = imagePool.count - 1; i >= 0; i--)
+    {
+        if ((size_t)imagePool.sizes[i] == size)
+        {
+            data = imagePool.buffers[i];
+            imagePool.count--;
+            for (int k = i; k < imagePool.count; k++)
+            {
+                imagePool.buffers[k] = imagePool.buffers[k + 1];
+                imagePool.sizes[k] = imagePool.sizes[k + 1];
+            }
+            break;
+        }
+    }
+
+    ReleaseSpinLock(&imagePool.lock);
+
+    if (data == NULL) data = RL_MALLOC(size);
+
+    return data;
+}
+
+// Get image pixel buffer size for image pool, 0 if buffer can not be pooled
+// NOTE: Only single level uncompressed images are pooled, buffer size is known for them
+static int GetImageBufferSize(Image image)
+{
+    int size = 0;
+
+    if ((image.data != NULL) && (image.mipmaps == 1) && (image.format > 0) &&
+        (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)) size = GetPixelDataSize(image.width, image.height, image.format);
+
+    return size;
+}
+
+// Release pixel buffer into image pool, buffer is freed if pool is full or size is 0
+// NOTE: Reserved buffers are accepted over pool size limit, used to offer a buffer to the next allocation
+static void UnloadImageBuffer(void *data, int size, bool reserved)
+{
+    if (data == NULL) return;
+
+    bool pooled = false;
+
+    if (size > 0)
+    {
+        AcquireSpinLock(&imagePool.lock);
+
+        if (imagePool.count < (reserved? MAX_IMAGE_POOL_BUFFERS : imagePool.maxCount))
+        {
+            imagePool.buffers[imagePool.count] = data;
+            imagePool.sizes[imagePool.count] = size;
+            imagePool.count++;
+            pooled = true;
+        }
+
+        ReleaseSpinLock(&imagePool.lock);
+    }
+
+    if (!pooled) RL_FREE(data);
+}
+
+// Remove pixel buffer from image pool, returns false if not available (i.e. already reused)
+static bool RemoveImageBuffer(void *data)
+{
+    bool removed = false;
+
+    AcquireSpinLock(&imagePool.lock);
+
+    for (int i = 0; i < imagePool.count; i++)
+    {
+        if (imagePool.buffers[i] == data)
+        {
+            imagePool.count--;
+            for (int k = i; k < imagePool.count; k++)
+            {
+                imagePool.buffers[k] = imagePool.buffers[k + 1];
+                imagePool.sizes[k] = imagePool.sizes[k + 1];
+            }
+            removed = true;
+            break;
+        }
+    }
+
+    ReleaseSpinLock(&imagePool.lock);
+
+    return removed;
+}
+
+// Decompose square kernel as outer product kernelY x kernelX (if rank 1)
+// NOTE: Kernel is factorized using its largest element as pivot, factorization is validated with a relative tolerance
+static bool DecomposeKernel(const float *kernel, int size, float *kernelX, float *kernelY)
+{
+    int pivot = 0;
+
+    for (int i = 1; i < size*size; i++)
+    {
+        if (fabsf(kernel[i]) > fabsf(kernel[pivot])) pivot = i;
+    }
+
+    float maxValue = fabsf(kernel[pivot]);
+    if (maxValue == 0.0f) return false;
+
+    int pivotRow = pivot/size;
+    int pivotCol = pivot%size;
+
+    for (int i = 0; i < size; i++)
+    {
+        kernelX[i] = kernel[pivotRow*size + i];
+        kernelY[i] = kernel[i*size + pivotCol]/kernel[pivot];
+    }
+
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            if (fabsf(kernel[y*size + x] - kernelY[y]*kernelX[x]) > maxValue*1e-5f) return false;
+        }
+    }
+
+    return true;
+}
+
+// Apply convolution pass to image (RGBA8 processing)
+static void ApplyConvolution(Image *image, const ConvolutionPass *pass)
+{
+    int format = image->format;
+    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Convolution not supported for compressed image formats");
+        return;
+    }
+
+    ConvolutionPass rows = *pass;
+    rows.src = (const Color *)image->data;
+    rows.dst = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+    rows.width = image->width;
+    rows.height = image->height;
+
+    ParallelFor(image->height, 16, ConvolveRows, &rows);
+
+    RL_FREE(image->data);
+    image->data = rows.dst;
+
+    // NOTE: Original mipmaps are replaced by new ones, ImageFormat() regenerates them if format changes
+    if ((image->mipmaps > 1) && (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        image->mipmaps = 1;
+    #if defined(SUPPORT_IMAGE_MANIPULATION)
+        ImageMipmaps(image);
+    #endif
+    }
+
+    ImageFormat(image, format);
+}
+
+// Accumulate weighted line of values: dst += src*weight
+static void AccumulateLine(float *dst, const float *src, float weight, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SIMD_SSE2)
+    const __m128 w = _mm_set1_ps(weight);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_loadu_ps(dst + i + 4), _mm_mul_ps(_mm_loadu_ps(src + i + 4), w)));
+    }
+#elif defined(RTEXTURES_SIMD_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        vst1q_f32(dst + i, vaddq_f32(vld1q_f32(dst + i), vmulq_n_f32(vld1q_f32(src + i), weight)));
+        vst1q_f32(dst + i + 4, vaddq_f32(vld1q_f32(dst + i + 4), vmulq_n_f32(vld1q_f32(src + i + 4), weight)));
+    }
+#endif
+
+    for (; i < count; i++) dst[i] += src[i]*weight;
+}
+
+// Convolve a range of image rows (ParallelFor() task)
+// NOTE: Source rows are converted to float and padded with zeros, so the inner loops have no bounds checks;
+// rows are cached in a ring buffer (horizontally filtered for separable kernels), every row is processed once
+static void ConvolveRows(int start, int end, void *userData)
+{
+    const ConvolutionPass *pass = (const ConvolutionPass *)userData;
+    const int width = pass->width;
+    const int kernelWidth = pass->kernelWidth;
+    const int kernelHeight = pass->kernelHeight;
+    const int paddedWidth = width + kernelWidth - 1;
+    const bool separable = (pass->kernel == NULL);
+
+    // Ring rows are padded for 2D kernels, horizontally filtered for separable kernels
+    const int rowSize = (separable? width : paddedWidth)*4;
+
+    float *padded = (float *)RL_CALLOC(paddedWidth*4, sizeof(float));
+    float *zeroRow = (float *)RL_CALLOC(rowSize, sizeof(float));
+    float *ring = (float *)RL_MALLOC(kernelHeight*rowSize*sizeof(float));
+    int *ringRows = (int *)RL_MALLOC(kernelHeight*sizeof(int));
+    const float **rows = (const float **)RL_MALLOC(kernelHeight*sizeof(const float *));
+    float *sums = (float *)RL_MALLOC(width*4*sizeof(float));
+
+    for (int i = 0; i < kernelHeight; i++) ringRows[i] = -1;
+
+    for (int y = start; y < end; y++)
+    {
+        // Gather source rows required for this row, loading the missing ones
+        for (int ky = 0; ky < kernelHeight; ky++)
+        {
+            int sy = y + ky - kernelHeight/2;
+
+            if ((sy < 0) || (sy >= pass->height)) rows[ky] = zeroRow;
+            else
+            {
+                float *slot = ring + (sy%kernelHeight)*rowSize;
+
+                if (ringRows[sy%kernelHeight] != sy)
+                {
+                    const unsigned char *src = (const unsigned char *)(pass->src + sy*width);
+                    float *row = separable? padded : slot;
+
+                    // Zero padding on both sides, kernel taps start at x - kernelWidth/2
+                    for (int i = 0; i < (kernelWidth/2)*4; i++) row[i] = 0.0f;
+                    for (int i = 0; i < width*4; i++) row[(kernelWidth/2)*4 + i] = (float)src[i];
+                    for (int i = (kernelWidth/2 + width)*4; i < paddedWidth*4; i++) row[i] = 0.0f;
+
+                    if (separable)
+                    {
+                        for (int i = 0; i < width*4; i++) slot[i] = 0.0f;
+                        for (int kx = 0; kx < kernelWidth; kx++) AccumulateLine(slot, padded + kx*4, pass->kernelX[kx], width*4);
+                    }
+
+                    ringRows[sy%kernelHeight] = sy;
+                }
+
+                rows[ky] = slot;
+            }
+        }
+
+        // Accumulate kernel taps: one weighted row per tap, vertical taps only for separable kernels
+        for (int i = 0; i < width*4; i++) sums[i] = 0.0f;
+
+        for (int ky = 0; ky < kernelHeight; ky++)
+        {
+            if (separable) AccumulateLine(sums, rows[ky], pass->kernelY[ky], width*4);
+            else
+            {
+                for (int kx = 0; kx < kernelWidth; kx++) AccumulateLine(sums, rows[ky] + kx*4, pass->kernel[ky*kernelWidth + kx], width*4);
+            }
+        }
+
+        // Round and saturate to [0..255]
+        unsigned char *dst = (unsigned char *)(pass->dst + y*width);
+        int i = 0;
+
+    #if defined(RTEXTURES_SIMD_SSE2)
+        for (; i + 16 <= width*4; i += 16)
+        {
+            __m128i v0 = _mm_cvtps_epi32(_mm_loadu_ps(sums + i));
+            __m128i v1 = _mm_cvtps_epi32(_mm_loadu_ps(sums + i + 4));
+            __m128i v2 = _mm_cvtps_epi32(_mm_loadu_ps(sums + i + 8));
+            __m128i v3 = _mm_cvtps_epi32(_mm_loadu_ps(sums + i + 12));
+
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+        }
+    #endif
+        for (; i < width*4; i++)
+        {
+            float value = sums[i] + 0.5f;
+            dst[i] = (value <= 0.0f)? 0 : ((value >= 255.0f)? 255 : (unsigned char)value);
+        }
+    }
+
+    RL_FREE(padded);
+    RL_FREE(zeroRow);
+    RL_FREE(ring);
+    RL_FREE(ringRows);
+    RL_FREE(rows);
+    RL_FREE(sums);
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
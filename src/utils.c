@@ -49,12 +49,82 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_THREADING)
+    #if defined(_WIN32)
+        // Win32 threads functions declaration, avoiding windows.h inclusion (symbols conflict with raylib)
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+        __declspec(dllimport) int __stdcall SwitchToThread(void);
+        __declspec(dllimport) unsigned long __stdcall GetCurrentThreadId(void);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void *lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void *lock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void *condition, void *lock, unsigned long milliseconds, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(void *condition);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void *condition);
+        #if defined(_MSC_VER)
+            #include <intrin.h>         // Required for: _InterlockedExchange()
+        #endif
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+        #include <sched.h>              // Required for: sched_yield()
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING)
+    #if defined(_WIN32)
+        // Win32 file mapping functions declaration, avoiding windows.h inclusion (symbols conflict with raylib)
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *attributes, unsigned long disposition, unsigned long flags, void *templateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    #elif !defined(__EMSCRIPTEN__)
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: ftruncate(), close()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_THREADING_WORKERS
+    #define MAX_THREADING_WORKERS        16         // Max number of threads used by ParallelFor(), including calling thread
+#endif
+#ifndef MAX_ASYNC_LOAD_REQUESTS
+    #define MAX_ASYNC_LOAD_REQUESTS     256         // Max number of async load requests in flight
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Parallel job, range is split in batches picked by pool workers and calling thread
+typedef struct ParallelJob {
+    ParallelTaskCallback task;          // Task callback
+    void *userData;                     // Task user data
+    int count;                          // Number of items to process, [0, count) range
+    int batchCount;                     // Number of batches, range is split evenly
+    int nextBatch;                      // Next batch to be picked
+    int pendingBatches;                 // Number of batches not finished yet
+} ParallelJob;
+
+// Async load request, load step runs on a worker thread and finish step on main thread
+typedef struct AsyncLoadRequest {
+    unsigned int id;                    // Request id, 0 for unused slots
+    int state;                          // Request state (AsyncLoadState)
+    AsyncLoadCallback load;             // Load step callback: file loading and CPU decoding (worker thread)
+    AsyncLoadCallback finish;           // Finish step callback: GPU upload and results delivery (main thread)
+    AsyncLoadCallback release;          // Release step callback: user data release for cancelled requests (main thread)
+    void *userData;                     // Callbacks user data
+} AsyncLoadRequest;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +137,53 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static int threadingWorkerCount = 0;                // Number of threading workers, computed on first use
+
+// Parallel workers pool, workers wait on parallelCondition for batches to pick
+// NOTE: Job is protected by parallelLock, calling thread waits on parallelDoneCondition for batches to finish
+static ParallelJob parallelJob = { 0 };
+static bool parallelBusy = false;                   // Pool is processing a job, other jobs run on calling thread
+static bool parallelStop = false;                   // Pool workers requested to stop
+static int parallelWorkerCount = 0;                 // Number of pool workers started, started on first job
+#if defined(SUPPORT_THREADING)
+    #if defined(_WIN32)
+static void *parallelLock = NULL;                   // SRWLOCK (zero initialized)
+static void *parallelCondition = NULL;              // CONDITION_VARIABLE (zero initialized)
+static void *parallelDoneCondition = NULL;          // CONDITION_VARIABLE (zero initialized)
+static void *parallelWorkers[MAX_THREADING_WORKERS] = { 0 };
+    #else
+static pthread_mutex_t parallelLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t parallelCondition = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t parallelDoneCondition = PTHREAD_COND_INITIALIZER;
+static pthread_t parallelWorkers[MAX_THREADING_WORKERS];
+    #endif
+#endif
+
+// Async loading state, requests are referenced by slot index in load and finish queues
+// NOTE: Queues and requests are protected by asyncLock, workers wait on asyncCondition for new requests
+static AsyncLoadRequest asyncRequests[MAX_ASYNC_LOAD_REQUESTS] = { 0 };
+static int asyncLoadQueue[MAX_ASYNC_LOAD_REQUESTS] = { 0 };     // Requests waiting for a worker (ring buffer)
+static int asyncFinishQueue[MAX_ASYNC_LOAD_REQUESTS] = { 0 };   // Requests waiting for main thread finish step (ring buffer)
+static int asyncLoadHead = 0, asyncLoadCount = 0;
+static int asyncFinishHead = 0, asyncFinishCount = 0;
+static int asyncRequestCount = 0;                   // Number of requests in flight
+static unsigned int asyncRequestCounter = 0;        // Requests counter, used to generate unique ids
+static int asyncWorkerCount = 0;                    // Number of async workers started, started on first request
+static bool asyncStop = false;                      // Async workers requested to stop
+#if defined(SUPPORT_THREADING)
+    #if defined(_WIN32)
+static void *asyncLock = NULL;                      // SRWLOCK (zero initialized)
+static void *asyncCondition = NULL;                 // CONDITION_VARIABLE (zero initialized)
+static void *asyncWorkers[MAX_THREADING_WORKERS] = { 0 };
+static unsigned long asyncWorkerIds[MAX_THREADING_WORKERS] = { 0 };
+    #else
+static pthread_mutex_t asyncLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t asyncCondition = PTHREAD_COND_INITIALIZER;
+static pthread_t asyncWorkers[MAX_THREADING_WORKERS];
+static pthread_t asyncWorkerIds[MAX_THREADING_WORKERS];
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -84,6 +201,28 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static void LockParallelWorkers(void);                      // Lock parallel workers pool
+static void UnlockParallelWorkers(void);                    // Unlock parallel workers pool
+static bool StartParallelWorkers(void);                     // Start parallel workers pool (if not already started)
+static void ProcessParallelBatches(void);                   // Process parallel job batches until none is left to pick
+#if defined(SUPPORT_THREADING)
+#if defined(_WIN32)
+static unsigned long __stdcall ParallelWorker(void *arg);   // Thread entry point, processes parallel job batches
+#else
+static void *ParallelWorker(void *arg);                     // Thread entry point, processes parallel job batches
+#endif
+#endif
+static void LockAsyncLoads(void);                           // Lock async loading queues
+static void UnlockAsyncLoads(void);                         // Unlock async loading queues
+static bool StartAsyncWorkers(void);                        // Start async loading workers (if not already started)
+#if defined(SUPPORT_THREADING)
+#if defined(_WIN32)
+static unsigned long __stdcall AsyncWorker(void *arg);      // Thread entry point, processes async load requests
+#else
+static void *AsyncWorker(void *arg);                        // Thread entry point, processes async load requests
+#endif
+#endif
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -438,6 +577,431 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Get number of workers available to ParallelFor()
+// NOTE: It matches the number of logical processors, limited by MAX_THREADING_WORKERS
+int GetThreadingWorkerCount(void)
+{
+    if (threadingWorkerCount == 0)
+    {
+        int count = 1;
+
+#if defined(SUPPORT_THREADING)
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #elif defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+        count = 1;
+    #else
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+#endif
+        if (count < 1) count = 1;
+        if (count > MAX_THREADING_WORKERS) count = MAX_THREADING_WORKERS;
+
+        threadingWorkerCount = count;
+    }
+
+    return threadingWorkerCount;
+}
+
+// Split [0, count) range in batches and process them in parallel
+// NOTE: Batches are processed by a persistent workers pool (started on first use) and calling thread,
+// minBatch sets the minimum number of items worth processing on a separate thread; calls from async workers,
+// from inside a parallel task or while pool is busy with another job run on calling thread
+void ParallelFor(int count, int minBatch, ParallelTaskCallback task, void *userData)
+{
+    if ((count <= 0) || (task == NULL)) return;
+    if (minBatch < 1) minBatch = 1;
+
+    int batchCount = GetThreadingWorkerCount();
+    if (batchCount > count/minBatch) batchCount = count/minBatch;
+
+#if defined(SUPPORT_THREADING)
+    // Async workers already keep processors busy, nested jobs would oversubscribe them
+    if ((batchCount > 1) && (GetAsyncWorkerIndex() < 0))
+    {
+        LockParallelWorkers();
+
+        // NOTE: Pool is busy while any batch task runs, so nested calls from pool workers end up inline
+        bool pooled = !parallelBusy && StartParallelWorkers();
+
+        if (pooled)
+        {
+            parallelBusy = true;
+            parallelJob = (ParallelJob){ task, userData, count, batchCount, 0, batchCount };
+
+        #if defined(_WIN32)
+            WakeAllConditionVariable(&parallelCondition);
+        #else
+            pthread_cond_broadcast(&parallelCondition);
+        #endif
+
+            // Calling thread picks batches too, then waits for the ones picked by workers
+            ProcessParallelBatches();
+
+            while (parallelJob.pendingBatches > 0)
+            {
+            #if defined(_WIN32)
+                SleepConditionVariableSRW(&parallelDoneCondition, &parallelLock, 0xffffffff, 0);     // INFINITE
+            #else
+                pthread_cond_wait(&parallelDoneCondition, &parallelLock);
+            #endif
+            }
+
+            parallelBusy = false;
+        }
+
+        UnlockParallelWorkers();
+
+        if (pooled) return;
+    }
+#endif
+
+    task(0, count, userData);
+}
+
+// Stop and join parallel workers pool, pool is started again on next ParallelFor() call
+// NOTE: Must not be called while a job is being processed
+void CloseParallelWorkers(void)
+{
+#if defined(SUPPORT_THREADING)
+    LockParallelWorkers();
+    int count = parallelWorkerCount;
+    parallelStop = true;
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&parallelCondition);
+    #else
+    pthread_cond_broadcast(&parallelCondition);
+    #endif
+    UnlockParallelWorkers();
+
+    for (int i = 0; i < count; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(parallelWorkers[i], 0xffffffff);     // INFINITE
+        CloseHandle(parallelWorkers[i]);
+    #else
+        pthread_join(parallelWorkers[i], NULL);
+    #endif
+    }
+
+    LockParallelWorkers();
+    if (parallelWorkerCount > 0) parallelWorkerCount = 0;
+    parallelStop = false;
+    UnlockParallelWorkers();
+
+    if (count > 0) TRACELOG(LOG_INFO, "THREADS: Stopped %i parallel workers", count);
+#endif
+}
+
+// Acquire spin lock, waiting for other threads to release it
+// NOTE: Lock must be zero initialized, only intended for short critical sections (shared pools and queues)
+void AcquireSpinLock(volatile int *lock)
+{
+#if defined(SUPPORT_THREADING)
+    #if defined(_MSC_VER)
+    while (_InterlockedExchange((volatile long *)lock, 1) != 0)
+    #else
+    while (__sync_lock_test_and_set(lock, 1) != 0)
+    #endif
+    {
+        // Wait for the lock to look free before retrying, yielding in case owner thread is not running
+        while (*lock != 0)
+        {
+        #if defined(_WIN32)
+            SwitchToThread();
+        #else
+            sched_yield();
+        #endif
+        }
+    }
+#else
+    *lock = 1;
+#endif
+}
+
+// Release spin lock acquired with AcquireSpinLock()
+void ReleaseSpinLock(volatile int *lock)
+{
+#if defined(SUPPORT_THREADING) && !defined(_MSC_VER)
+    __sync_lock_release(lock);
+#elif defined(SUPPORT_THREADING)
+    _InterlockedExchange((volatile long *)lock, 0);
+#else
+    *lock = 0;
+#endif
+}
+
+// Request asynchronous loading, load step runs on a worker thread and finish step on main thread
+// NOTE: Finish step is called from UpdateAsyncLoads(), also when load step fails, to deliver results and release
+// user data; if requests can not be queued (or threads are not available), load step runs on calling thread;
+// release step only frees user data of requests cancelled by CloseAsyncLoads(), finish step is not called for them
+unsigned int LoadAsync(AsyncLoadCallback load, AsyncLoadCallback finish, AsyncLoadCallback release, void *userData)
+{
+    unsigned int id = 0;
+    int slot = -1;
+
+    LockAsyncLoads();
+
+    if ((asyncRequestCount < MAX_ASYNC_LOAD_REQUESTS) && StartAsyncWorkers())
+    {
+        for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+        {
+            if (asyncRequests[i].id == 0) { slot = i; break; }
+        }
+
+        // Request id encodes slot index, counter makes ids unique for reused slots
+        asyncRequestCounter++;
+        id = asyncRequestCounter*MAX_ASYNC_LOAD_REQUESTS + slot + 1;
+        if (id <= MAX_ASYNC_LOAD_REQUESTS) id = slot + 1;   // Counter wrapped around
+
+        asyncRequests[slot] = (AsyncLoadRequest){ id, ASYNC_LOAD_QUEUED, load, finish, release, userData };
+        asyncLoadQueue[(asyncLoadHead + asyncLoadCount)%MAX_ASYNC_LOAD_REQUESTS] = slot;
+        asyncLoadCount++;
+        asyncRequestCount++;
+
+    #if defined(SUPPORT_THREADING) && defined(_WIN32)
+        WakeConditionVariable(&asyncCondition);
+    #elif defined(SUPPORT_THREADING)
+        pthread_cond_signal(&asyncCondition);
+    #endif
+    }
+
+    UnlockAsyncLoads();
+
+    if (slot < 0)
+    {
+        TRACELOG(LOG_DEBUG, "ASYNC: Request processed on calling thread");
+
+        if (load != NULL) load(userData);
+        if (finish != NULL) finish(userData);
+    }
+
+    return id;
+}
+
+// Get async load request state
+// NOTE: Finished (or unknown) requests return ASYNC_LOAD_DONE, loaded data must be checked for validity
+int GetAsyncLoadState(unsigned int id)
+{
+    int state = ASYNC_LOAD_DONE;
+
+    if (id > 0)
+    {
+        LockAsyncLoads();
+        AsyncLoadRequest *request = &asyncRequests[(id - 1)%MAX_ASYNC_LOAD_REQUESTS];
+        if (request->id == id) state = request->state;
+        UnlockAsyncLoads();
+    }
+
+    return state;
+}
+
+// Get number of async load requests not finished yet
+int GetAsyncLoadCount(void)
+{
+    LockAsyncLoads();
+    int count = asyncRequestCount;
+    UnlockAsyncLoads();
+
+    return count;
+}
+
+// Process async load requests finish step (GPU upload, results delivery), to be called once per frame
+// NOTE: Requests are processed until time budget (in seconds) is consumed, at least one request is processed
+void UpdateAsyncLoads(float timeBudget)
+{
+    // NOTE: No requests left after CloseAsyncLoads(), platform timer is not required
+    if (GetAsyncLoadCount() == 0) return;
+
+    double startTime = GetTime();
+
+    while (true)
+    {
+        int slot = -1;
+
+        LockAsyncLoads();
+        if (asyncFinishCount > 0)
+        {
+            slot = asyncFinishQueue[asyncFinishHead];
+            asyncFinishHead = (asyncFinishHead + 1)%MAX_ASYNC_LOAD_REQUESTS;
+            asyncFinishCount--;
+        }
+        UnlockAsyncLoads();
+
+        if (slot < 0) break;
+
+        // Request slot is only accessed by main thread once it is in finish queue
+        if (asyncRequests[slot].finish != NULL) asyncRequests[slot].finish(asyncRequests[slot].userData);
+
+        LockAsyncLoads();
+        asyncRequests[slot] = (AsyncLoadRequest){ 0 };
+        asyncRequestCount--;
+        UnlockAsyncLoads();
+
+        if ((GetTime() - startTime) >= timeBudget) break;
+    }
+}
+
+// Stop and join async loading workers, cancelling requests not finished yet
+// NOTE: Loads being processed are completed first, then user data of every request is freed by its release
+// step, finish steps (GPU upload) are not called; workers are started again on next LoadAsync() call
+void CloseAsyncLoads(void)
+{
+#if defined(SUPPORT_THREADING)
+    LockAsyncLoads();
+    int count = asyncWorkerCount;
+    asyncStop = true;
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&asyncCondition);
+    #else
+    pthread_cond_broadcast(&asyncCondition);
+    #endif
+    UnlockAsyncLoads();
+
+    for (int i = 0; i < count; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(asyncWorkers[i], 0xffffffff);     // INFINITE
+        CloseHandle(asyncWorkers[i]);
+    #else
+        pthread_join(asyncWorkers[i], NULL);
+    #endif
+    }
+#endif
+
+    // Workers are stopped, requests can be accessed without locking
+    int cancelled = 0;
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        if (asyncRequests[i].id == 0) continue;
+
+        if (asyncRequests[i].release != NULL) asyncRequests[i].release(asyncRequests[i].userData);
+        asyncRequests[i] = (AsyncLoadRequest){ 0 };
+        cancelled++;
+    }
+
+    LockAsyncLoads();
+    asyncLoadHead = 0;
+    asyncLoadCount = 0;
+    asyncFinishHead = 0;
+    asyncFinishCount = 0;
+    asyncRequestCount = 0;
+    if (asyncWorkerCount > 0) asyncWorkerCount = 0;
+    asyncStop = false;
+    UnlockAsyncLoads();
+
+    if (cancelled > 0) TRACELOG(LOG_INFO, "ASYNC: Cancelled %i loading requests", cancelled);
+#if defined(SUPPORT_THREADING)
+    if (count > 0) TRACELOG(LOG_INFO, "ASYNC: Stopped %i loading workers", count);
+#endif
+}
+
+// Get index of async loading worker running calling thread, -1 if calling thread is not an async worker
+int GetAsyncWorkerIndex(void)
+{
+    int index = -1;
+
+#if defined(SUPPORT_THREADING)
+    LockAsyncLoads();
+    for (int i = 0; i < asyncWorkerCount; i++)
+    {
+    #if defined(_WIN32)
+        if (asyncWorkerIds[i] == GetCurrentThreadId()) { index = i; break; }
+    #else
+        if (pthread_equal(asyncWorkerIds[i], pthread_self())) { index = i; break; }
+    #endif
+    }
+    UnlockAsyncLoads();
+#endif
+
+    return index;
+}
+
+// Map file data into memory, data pages are loaded on access
+// NOTE: Writable mappings create the file if required and extend it to size (zero filled),
+// read-only mappings fail if file is smaller than size, changes are written back to file
+unsigned char *MapFileData(const char *fileName, size_t size, bool writable, void **handle)
+{
+    unsigned char *data = NULL;
+    *handle = NULL;
+
+    if ((fileName == NULL) || (size == 0)) return NULL;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    #if defined(_WIN32)
+    void *file = CreateFileA(fileName, writable? (0x80000000 | 0x40000000) : 0x80000000,    // GENERIC_READ | GENERIC_WRITE
+        0x00000001, NULL, writable? 4 : 3, 0x80, NULL);    // FILE_SHARE_READ, OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)(long long)-1)  // INVALID_HANDLE_VALUE
+    {
+        long long fileSize = 0;
+        GetFileSizeEx(file, &fileSize);
+
+        if (writable || (fileSize >= (long long)size))
+        {
+            // NOTE: Mapping a writable file bigger than its size extends it
+            unsigned long long mappingSize = (unsigned long long)size;
+            void *mapping = CreateFileMappingA(file, NULL, writable? 0x04 : 0x02,    // PAGE_READWRITE : PAGE_READONLY
+                (unsigned long)(mappingSize >> 32), (unsigned long)(mappingSize & 0xffffffff), NULL);
+
+            if (mapping != NULL)
+            {
+                data = (unsigned char *)MapViewOfFile(mapping, writable? 0x0002 : 0x0004, 0, 0, size);   // FILE_MAP_WRITE : FILE_MAP_READ
+
+                if (data != NULL) *handle = mapping;
+                else CloseHandle(mapping);
+            }
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] File is smaller than requested mapping size", fileName);
+
+        CloseHandle(file);      // Mapping keeps its own reference to file
+    }
+    #elif !defined(__EMSCRIPTEN__)
+    int file = open(fileName, writable? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+
+    if (file >= 0)
+    {
+        struct stat info = { 0 };
+        bool sizeValid = (fstat(file, &info) == 0) && ((size_t)info.st_size >= size);
+
+        if (!sizeValid && writable) sizeValid = (ftruncate(file, (off_t)size) == 0);
+
+        if (sizeValid)
+        {
+            void *mapping = mmap(NULL, size, writable? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, file, 0);
+            if (mapping != MAP_FAILED) data = (unsigned char *)mapping;
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] File is smaller than requested mapping size", fileName);
+
+        close(file);            // Mapping keeps its own reference to file
+    }
+    #endif
+
+    if (data == NULL) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+    else TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: File mapping not supported, enable SUPPORT_FILE_MAPPING");
+#endif
+
+    return data;
+}
+
+// Unmap file data mapped with MapFileData()
+void UnmapFileData(unsigned char *data, size_t size, void *handle)
+{
+    if (data == NULL) return;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    #if defined(_WIN32)
+    UnmapViewOfFile(data);
+    CloseHandle(handle);
+    #elif !defined(__EMSCRIPTEN__)
+    munmap(data, size);
+    #endif
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -508,3 +1072,212 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_THREADING)
+// Thread entry point, processes parallel job batches
+// NOTE: Workers keep waiting for batches until CloseParallelWorkers() is called
+#if defined(_WIN32)
+static unsigned long __stdcall ParallelWorker(void *arg)
+#else
+static void *ParallelWorker(void *arg)
+#endif
+{
+    LockParallelWorkers();
+
+    while (true)
+    {
+        while (!parallelStop && (parallelJob.nextBatch >= parallelJob.batchCount))
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&parallelCondition, &parallelLock, 0xffffffff, 0);     // INFINITE
+        #else
+            pthread_cond_wait(&parallelCondition, &parallelLock);
+        #endif
+        }
+
+        if (parallelStop) break;
+
+        ProcessParallelBatches();
+    }
+
+    UnlockParallelWorkers();
+
+    return 0;
+}
+
+// Thread entry point, processes async load requests
+// NOTE: Workers keep waiting for requests until CloseAsyncLoads() is called
+#if defined(_WIN32)
+static unsigned long __stdcall AsyncWorker(void *arg)
+#else
+static void *AsyncWorker(void *arg)
+#endif
+{
+    int index = (int)(size_t)arg;
+
+    LockAsyncLoads();
+
+    // Worker registers its own id, GetAsyncWorkerIndex() can be called as soon as it processes requests
+#if defined(_WIN32)
+    asyncWorkerIds[index] = GetCurrentThreadId();
+#else
+    asyncWorkerIds[index] = pthread_self();
+#endif
+
+    while (true)
+    {
+        while (!asyncStop && (asyncLoadCount == 0))
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&asyncCondition, &asyncLock, 0xffffffff, 0);     // INFINITE
+        #else
+            pthread_cond_wait(&asyncCondition, &asyncLock);
+        #endif
+        }
+
+        if (asyncStop) break;
+
+        int slot = asyncLoadQueue[asyncLoadHead];
+        asyncLoadHead = (asyncLoadHead + 1)%MAX_ASYNC_LOAD_REQUESTS;
+        asyncLoadCount--;
+
+        AsyncLoadRequest request = asyncRequests[slot];
+        asyncRequests[slot].state = ASYNC_LOAD_LOADING;
+
+        UnlockAsyncLoads();
+
+        if (request.load != NULL) request.load(request.userData);
+
+        LockAsyncLoads();
+
+        asyncRequests[slot].state = ASYNC_LOAD_FINISHING;
+        asyncFinishQueue[(asyncFinishHead + asyncFinishCount)%MAX_ASYNC_LOAD_REQUESTS] = slot;
+        asyncFinishCount++;
+    }
+
+    UnlockAsyncLoads();
+
+    return 0;
+}
+#endif  // SUPPORT_THREADING
+
+// Lock parallel workers pool
+static void LockParallelWorkers(void)
+{
+#if defined(SUPPORT_THREADING) && defined(_WIN32)
+    AcquireSRWLockExclusive(&parallelLock);
+#elif defined(SUPPORT_THREADING)
+    pthread_mutex_lock(&parallelLock);
+#endif
+}
+
+// Unlock parallel workers pool
+static void UnlockParallelWorkers(void)
+{
+#if defined(SUPPORT_THREADING) && defined(_WIN32)
+    ReleaseSRWLockExclusive(&parallelLock);
+#elif defined(SUPPORT_THREADING)
+    pthread_mutex_unlock(&parallelLock);
+#endif
+}
+
+// Start parallel workers pool, returns false if no worker could be started
+// NOTE: Pool must be locked, one worker is started per available processor but the calling thread one
+static bool StartParallelWorkers(void)
+{
+#if defined(SUPPORT_THREADING)
+    if (parallelWorkerCount == 0)
+    {
+        int count = GetThreadingWorkerCount() - 1;
+
+        for (int i = 0; i < count; i++)
+        {
+        #if defined(_WIN32)
+            parallelWorkers[parallelWorkerCount] = CreateThread(NULL, 0, ParallelWorker, NULL, 0, NULL);
+            if (parallelWorkers[parallelWorkerCount] == NULL) break;
+        #else
+            if (pthread_create(&parallelWorkers[parallelWorkerCount], NULL, ParallelWorker, NULL) != 0) break;
+        #endif
+            parallelWorkerCount++;
+        }
+
+        if (parallelWorkerCount > 0) TRACELOG(LOG_INFO, "THREADS: Started %i parallel workers", parallelWorkerCount);
+        else parallelWorkerCount = -1;  // Threads not available, do not try again
+    }
+#endif
+
+    return (parallelWorkerCount > 0);
+}
+
+// Process parallel job batches until none is left to pick
+// NOTE: Pool must be locked, it is unlocked while batch tasks run
+static void ProcessParallelBatches(void)
+{
+    while (parallelJob.nextBatch < parallelJob.batchCount)
+    {
+        ParallelJob job = parallelJob;
+        int batch = parallelJob.nextBatch++;
+
+        UnlockParallelWorkers();
+        job.task((int)((long long)job.count*batch/job.batchCount), (int)((long long)job.count*(batch + 1)/job.batchCount), job.userData);
+        LockParallelWorkers();
+
+        parallelJob.pendingBatches--;
+
+    #if defined(SUPPORT_THREADING) && defined(_WIN32)
+        if (parallelJob.pendingBatches == 0) WakeConditionVariable(&parallelDoneCondition);
+    #elif defined(SUPPORT_THREADING)
+        if (parallelJob.pendingBatches == 0) pthread_cond_signal(&parallelDoneCondition);
+    #endif
+    }
+}
+
+// Lock async loading queues
+static void LockAsyncLoads(void)
+{
+#if defined(SUPPORT_THREADING) && defined(_WIN32)
+    AcquireSRWLockExclusive(&asyncLock);
+#elif defined(SUPPORT_THREADING)
+    pthread_mutex_lock(&asyncLock);
+#endif
+}
+
+// Unlock async loading queues
+static void UnlockAsyncLoads(void)
+{
+#if defined(SUPPORT_THREADING) && defined(_WIN32)
+    ReleaseSRWLockExclusive(&asyncLock);
+#elif defined(SUPPORT_THREADING)
+    pthread_mutex_unlock(&asyncLock);
+#endif
+}
+
+// Start async loading workers, returns false if no worker could be started
+// NOTE: One worker is started per available processor but the main thread one, at least one worker
+// is started on single processor systems so loading does not block the main thread
+static bool StartAsyncWorkers(void)
+{
+#if defined(SUPPORT_THREADING)
+    if (asyncWorkerCount == 0)
+    {
+        int count = GetThreadingWorkerCount() - 1;
+        if (count < 1) count = 1;
+
+        for (int i = 0; i < count; i++)
+        {
+        #if defined(_WIN32)
+            asyncWorkers[asyncWorkerCount] = CreateThread(NULL, 0, AsyncWorker, (void *)(size_t)asyncWorkerCount, 0, NULL);
+            if (asyncWorkers[asyncWorkerCount] == NULL) break;
+        #else
+            if (pthread_create(&asyncWorkers[asyncWorkerCount], NULL, AsyncWorker, (void *)(size_t)asyncWorkerCount) != 0) break;
+        #endif
+            asyncWorkerCount++;
+        }
+
+        if (asyncWorkerCount > 0) TRACELOG(LOG_INFO, "ASYNC: Started %i loading workers", asyncWorkerCount);
+        else asyncWorkerCount = -1;     // Threads not available, do not try again
+    }
+#endif
+
+    return (asyncWorkerCount > 0);
+}
@@ -27,6 +27,8 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stddef.h>                         // Required for: size_t
+
 #if defined(PLATFORM_ANDROID)
     #include <stdio.h>                      // Required for: FILE
     #include <android/asset_manager.h>      // Required for: AAssetManager
@@ -55,7 +57,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Parallel task callback, processes items in [start, end) range
+typedef void (*ParallelTaskCallback)(int start, int end, void *userData);
+
+// Async load step callback, load step runs on a worker thread and finish step on main thread
+typedef void (*AsyncLoadCallback)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +75,19 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+int GetThreadingWorkerCount(void);                                     // Get number of workers available to ParallelFor()
+void ParallelFor(int count, int minBatch, ParallelTaskCallback task, void *userData);  // Split [0, count) range in batches and process them in parallel (blocking)
+void CloseParallelWorkers(void);                                       // Stop and join parallel workers pool (started again on next ParallelFor() call)
+void AcquireSpinLock(volatile int *lock);                              // Acquire spin lock, waiting for other threads to release it
+void ReleaseSpinLock(volatile int *lock);                              // Release spin lock acquired with AcquireSpinLock()
+
+unsigned int LoadAsync(AsyncLoadCallback load, AsyncLoadCallback finish, AsyncLoadCallback release, void *userData);  // Request asynchronous loading, returns request id (0 if processed on calling thread)
+void CloseAsyncLoads(void);                                            // Stop and join async loading workers, cancelled requests user data is released
+int GetAsyncWorkerIndex(void);                                         // Get index of async loading worker running calling thread, -1 if not a worker
+
+unsigned char *MapFileData(const char *fileName, size_t size, bool writable, void **handle); // Map file data into memory (writable files are created/extended to size)
+void UnmapFileData(unsigned char *data, size_t size, void *handle);                          // Unmap file data mapped with MapFileData()
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!